@@ -1,6 +1,10 @@
 #include "btrdb.h"
 #include <grpc++/grpc++.h>
 #include "btrdb.pb.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <memory>
 #include <random>
 #include <string>
@@ -11,6 +15,14 @@
 
 namespace btrdb {
     BTrDB::~BTrDB() {
+        if (this->snapshot_writer_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(this->snapshot_lock_);
+                this->snapshot_stop_ = true;
+            }
+            this->snapshot_cond_.notify_all();
+            this->snapshot_writer_.join();
+        }
         this->completion_queue->Shutdown();
         /*
          * completion_queue is deleted in the event loop, after Next() or
@@ -18,44 +30,144 @@ namespace btrdb {
          */
     }
 
-    std::unique_ptr<grpcinterface::Mash> BTrDB::rawConnect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints) {
-        for (const std::string& hostport : endpoints) {
-            Endpoint ep;
-            const std::vector<std::string> hpv = { hostport };
+    /* ctx for asking a bootstrap endpoint for the MASH: wait for the connection to come up, but not forever. */
+    static void bootstrap_context(const std::function<void(grpc::ClientContext*)>& ctx, grpc::ClientContext* context) {
+        ctx(context);
+        context->set_wait_for_ready(true);
+        gpr_timespec deadline = context->raw_deadline();
+        if (gpr_time_cmp(deadline, gpr_inf_future(deadline.clock_type)) == 0) {
             gpr_timespec timeout;
             timeout.tv_sec = 10;
             timeout.tv_nsec = 0;
-            bool success = ep.connectBlocking(timeout, hpv);
-            if (!success) {
-                continue;
-            }
-            grpcinterface::InfoResponse ir;
-            Status stat = ep.info(ctx, &ir);
-            if (stat.isError()) {
-                continue;
-            }
-            // TODO disconnect ep
-            if (ir.has_mash()) {
-                return std::unique_ptr<grpcinterface::Mash>(ir.release_mash());
+            timeout.clock_type = GPR_TIMESPAN;
+            context->set_deadline(timeout);
+        }
+    }
+
+    std::unique_ptr<grpcinterface::Mash> BTrDB::rawConnect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, ConnectionRegistry& connections, std::shared_ptr<Endpoint>* winner, std::string* winner_hostport) {
+        /*
+         * Ask every bootstrap endpoint for the MASH at once, on a private
+         * completion queue, and take the first answer. The remaining
+         * requests are cancelled, so a dead bootstrap endpoint costs nothing
+         * as long as some other one is up.
+         */
+        grpc::CompletionQueue cq;
+        std::unique_ptr<grpcinterface::Mash> mash;
+        std::vector<std::shared_ptr<Endpoint>> eps(endpoints.size());
+        std::vector<grpc::ClientContext*> contexts(endpoints.size(), nullptr);
+        std::size_t pending = 0;
+
+        for (std::size_t i = 0; i != endpoints.size(); i++) {
+            eps[i] = connections.acquire(endpoints[i]);
+
+            auto bootstrap_ctx = [&contexts, i, ctx](grpc::ClientContext* context) {
+                bootstrap_context(ctx, context);
+                contexts[i] = context;
+            };
+
+            eps[i]->infoAsync(bootstrap_ctx, &cq, [&, i](Status stat, const grpcinterface::InfoResponse& response) {
+                /* The request is deleted once we return, so forget its context. */
+                contexts[i] = nullptr;
+                pending--;
+
+                if (mash || stat.isError() || !response.has_mash()) {
+                    return;
+                }
+                mash.reset(new grpcinterface::Mash(response.mash()));
+                if (winner != nullptr) {
+                    *winner = eps[i];
+                }
+                if (winner_hostport != nullptr) {
+                    *winner_hostport = endpoints[i];
+                }
+                for (grpc::ClientContext* context : contexts) {
+                    if (context != nullptr) {
+                        context->TryCancel();
+                    }
+                }
+            });
+            pending++;
+        }
+
+        void* tag;
+        bool ok;
+        while (pending != 0 && cq.Next(&tag, &ok)) {
+            BTrDB::handleEvent(tag, ok);
+        }
+        cq.Shutdown();
+        while (cq.Next(&tag, &ok)) {
+        }
+
+        return mash;
+    }
+
+    std::shared_ptr<BTrDB> BTrDB::connect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, const ConnectOptions& options) {
+        std::shared_ptr<BTrDB> b = BTrDB::warmConnect(ctx, endpoints, options);
+        if (!b) {
+            b = BTrDB::coldConnect(ctx, endpoints, options);
+            if (!b) {
+                return b;
             }
         }
-        return std::unique_ptr<grpcinterface::Mash>(nullptr);
+
+        std::thread event_loop(BTrDB::eventLoop, b->completion_queue, options);
+        event_loop.detach();
+        return b;
     }
 
-    std::shared_ptr<BTrDB> BTrDB::connect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints) {
-        std::unique_ptr<grpcinterface::Mash> mash = BTrDB::rawConnect(ctx, endpoints);
+    std::shared_ptr<BTrDB> BTrDB::coldConnect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, const ConnectOptions& options) {
+        std::shared_ptr<ConnectionRegistry> connections = BTrDB::newConnectionRegistry(options);
+        std::shared_ptr<Endpoint> ep;
+        std::string hostport;
+        std::unique_ptr<grpcinterface::Mash> mash = BTrDB::rawConnect(ctx, endpoints, *connections, &ep, &hostport);
         if (!mash) {
             return std::shared_ptr<BTrDB>(nullptr);
         }
 
-        std::shared_ptr<BTrDB> b(new BTrDB(MASH(*mash), endpoints));
-        std::thread event_loop(BTrDB::eventLoop, b->completion_queue);
-        event_loop.detach();
+        std::shared_ptr<BTrDB> b(new BTrDB(MASH(*mash), endpoints, options, connections));
+        b->adoptEndpoint(hostport, ep);
+        if (!options.snapshot_path.empty()) {
+            b->saveSnapshot();
+        }
+        return b;
+    }
+
+    std::shared_ptr<BTrDB> BTrDB::warmConnect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, const ConnectOptions& options) {
+        Snapshot snapshot;
+        if (options.snapshot_path.empty() || !load_snapshot(options.snapshot_path, &snapshot)) {
+            return std::shared_ptr<BTrDB>(nullptr);
+        }
+
+        std::shared_ptr<ConnectionRegistry> connections = BTrDB::newConnectionRegistry(options);
+        std::shared_ptr<BTrDB> b(new BTrDB(MASH(snapshot.mash), endpoints, options, connections));
+        for (auto& it : snapshot.lookups) {
+            b->snapshot_lookups_.put(it.first, std::move(it.second));
+        }
+
+        /*
+         * Route from the saved MASH right away, and fetch the current one in
+         * the background. If the saved MASH turns out to be stale before
+         * then, the 405 responses trigger a refresh (see handleEndpointStatus).
+         */
+        std::weak_ptr<BTrDB> weak = b;
+        std::thread validate([=]() {
+            std::shared_ptr<Endpoint> ep;
+            std::string hostport;
+            std::unique_ptr<grpcinterface::Mash> mash = BTrDB::rawConnect(ctx, endpoints, *connections, &ep, &hostport);
+            std::shared_ptr<BTrDB> b = weak.lock();
+            if (!mash || !b) {
+                return;
+            }
+            b->updateMash(*mash);
+            b->adoptEndpoint(hostport, ep);
+            b->saveSnapshot();
+        });
+        validate.detach();
         return b;
     }
 
-    void BTrDB::connectAsync(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, std::function<void(std::shared_ptr<BTrDB> btrdb)> on_done) {
-        std::thread event_loop(BTrDB::asyncConnectEventLoop, ctx, endpoints, on_done);
+    void BTrDB::connectAsync(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, std::function<void(std::shared_ptr<BTrDB> btrdb)> on_done, const ConnectOptions& options) {
+        std::thread event_loop(BTrDB::asyncConnectEventLoop, ctx, endpoints, on_done, options);
         event_loop.detach();
     }
 
@@ -67,11 +179,31 @@ namespace btrdb {
         return this->listCollectionsAsyncHelper(ctx, on_data, prefix, prefix);
     }
 
-    Status BTrDB::listCollectionsAsyncHelper(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, const std::vector<std::string>&)> on_data, const std::string& prefix, std::string from) {
-        const constexpr std::uint64_t max_results = 2;
+    static std::uint64_t collection_page_size(const ConnectOptions& options) {
+        /* A page of one could never make progress, since the next page starts with its last collection. */
+        return std::max<std::uint64_t>(options.collection_page_size, 2);
+    }
+
+    Status BTrDB::listCollectionsAsyncHelper(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, const std::vector<std::string>&)> on_data, const std::string& prefix, std::string from, bool prefetch) {
+        const std::uint64_t max_results = collection_page_size(this->options_);
+
+        /* asyncAnyEndpointOrError reports some errors before it returns; those are handed back when prefetching. */
+        struct issue {
+            std::mutex lock;
+            bool returned = false;
+            Status error;
+        };
+        std::shared_ptr<issue> state = std::make_shared<issue>();
 
         this->asyncAnyEndpointOrError(ctx, [=](Status stat, std::shared_ptr<Endpoint> ep) {
             if (stat.isError()) {
+                if (prefetch) {
+                    std::lock_guard<std::mutex> lock(state->lock);
+                    if (!state->returned) {
+                        state->error = stat;
+                        return;
+                    }
+                }
                 std::vector<std::string> dummy;
                 on_data(true, stat, dummy);
                 return;
@@ -85,60 +217,278 @@ namespace btrdb {
 
                 std::string new_from = new_collections.back();
                 new_collections.pop_back();
-                on_data(false, status, new_collections);
 
-
-                status = this->listCollectionsAsyncHelper(ctx, on_data, prefix, new_from);
-                if (status.isError()) {
-                    on_data(true, status, std::vector<std::string>());
+                /*
+                 * Ask for the next page before delivering this one, so the
+                 * RPC overlaps with on_data. Its completion is handled on
+                 * this (event loop) thread, so it cannot overtake us, and a
+                 * failure to send it comes back in next_status.
+                 */
+                Status next_status = this->listCollectionsAsyncHelper(ctx, on_data, prefix, new_from, true);
+                on_data(false, status, new_collections);
+                if (next_status.isError()) {
+                    on_data(true, next_status, std::vector<std::string>());
                 }
             };
 
             ep->listCollectionsAsync(ctx, this->completion_queue, data_callback, prefix, from, max_results);
         });
 
-        return Status();
+        std::lock_guard<std::mutex> lock(state->lock);
+        state->returned = true;
+        return state->error;
+    }
+
+    std::unique_ptr<CollectionIterator> BTrDB::iterateCollections(std::function<void(grpc::ClientContext*)> ctx, const std::string& prefix) {
+        return std::unique_ptr<CollectionIterator>(new CollectionIterator(shared_from_this(), ctx, prefix, collection_page_size(this->options_)));
     }
 
     Status BTrDB::listCollections(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<std::string>&)> on_data, const std::string& prefix) {
-        const constexpr std::uint64_t max_results = 10;
+        if (this->options_.sync_mode == SyncMode::Direct) {
+            return this->listCollectionsDirect(ctx, on_data, prefix);
+        }
 
+        std::unique_ptr<CollectionIterator> it = this->iterateCollections(ctx, prefix);
+        std::vector<std::string> collections;
         Status status;
-        std::string from = prefix;
-        std::vector<std::string>::size_type num_new_elements;
+        do {
+            status = it->nextPage(&collections);
+            on_data(it->done(), status, collections);
+        } while (!it->done());
+        return status;
+    }
 
+    Status BTrDB::listCollectionsDirect(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<std::string>&)> on_data, const std::string& prefix) {
+        const std::uint64_t max_results = collection_page_size(this->options_);
+        std::string from = prefix;
+        Status status;
         bool final_query = false;
         while (!final_query) {
             std::vector<std::string> collections;
+            std::int64_t revision;
             do {
+                revision = this->mashRevision();
+                collections.clear();
                 std::shared_ptr<Endpoint> ep;
                 status = this->anyEndpoint(ctx, &ep);
                 if (status.isError()) {
                     continue;
                 }
-                auto num_elements = collections.size();
                 status = ep->listCollections(ctx, prefix, from, max_results, &collections);
-                num_new_elements = collections.size() - num_elements;
-            } while (this->handleEndpointStatus(status));
+            } while (this->handleEndpointStatus(status, revision));
 
-            final_query = (num_new_elements != max_results) || status.isError();
+            final_query = collections.size() != max_results || status.isError();
             if (!final_query) {
-                // Prepare for the next query
                 from = collections.back();
                 collections.pop_back();
             }
-
             on_data(final_query, status, collections);
         }
-
         return status;
     }
 
+    CollectionIterator::CollectionIterator(const std::shared_ptr<BTrDB>& b, std::function<void(grpc::ClientContext*)> ctx, const std::string& prefix, std::uint64_t page_size)
+        : b_(b), ctx_(ctx), prefix_(prefix), page_size_(page_size), from_(prefix), position_(0) {
+        this->fetch();
+    }
+
+    void CollectionIterator::fetch() {
+        std::shared_ptr<page> p = std::make_shared<page>();
+        p->revision = this->b_->mashRevision();
+        this->pending_ = p;
+
+        /* The callbacks may outlive the iterator, so they hold only what they use. */
+        auto complete = [p](Status status, std::vector<std::string>& collections) {
+            std::lock_guard<std::mutex> lock(p->lock);
+            p->status = status;
+            p->collections.swap(collections);
+            p->ready = true;
+            p->ready_cond.notify_one();
+        };
+        std::shared_ptr<BTrDB> b = this->b_;
+        auto ctx = this->ctx_;
+        std::string prefix = this->prefix_;
+        std::string from = this->from_;
+        std::uint64_t page_size = this->page_size_;
+        b->asyncAnyEndpointOrError(ctx, [=](Status status, std::shared_ptr<Endpoint>& ep) {
+            if (status.isError()) {
+                std::vector<std::string> dummy;
+                complete(status, dummy);
+                return;
+            }
+            ep->listCollectionsAsync(ctx, b->completion_queue, complete, prefix, from, page_size);
+        });
+    }
+
+    void CollectionIterator::advance() {
+        std::vector<std::string> collections;
+        Status status;
+        std::int64_t revision;
+        {
+            std::unique_lock<std::mutex> lock(this->pending_->lock);
+            while (!this->pending_->ready) {
+                this->pending_->ready_cond.wait(lock);
+            }
+            status = this->pending_->status;
+            collections.swap(this->pending_->collections);
+            revision = this->pending_->revision;
+        }
+        this->pending_.reset();
+
+        /* A stale MASH is retried in the foreground; it is rare enough not to be worth prefetching. */
+        while (this->b_->handleEndpointStatus(status, revision)) {
+            collections.clear();
+            revision = this->b_->mashRevision();
+            std::shared_ptr<Endpoint> ep;
+            status = this->b_->anyEndpoint(this->ctx_, &ep);
+            if (status.isError()) {
+                continue;
+            }
+            status = ep->listCollections(this->ctx_, this->prefix_, this->from_, this->page_size_, &collections);
+        }
+
+        if (status.isError()) {
+            this->status_ = status;
+            collections.clear();
+        } else if (collections.size() == this->page_size_) {
+            this->from_ = collections.back();
+            collections.pop_back();
+            this->fetch();
+        }
+        this->current_ = std::move(collections);
+        this->position_ = 0;
+    }
+
+    bool CollectionIterator::next(std::string* collection) {
+        while (this->position_ == this->current_.size()) {
+            if (this->pending_ == nullptr) {
+                return false;
+            }
+            this->advance();
+        }
+        *collection = std::move(this->current_[this->position_++]);
+        return true;
+    }
+
+    Status CollectionIterator::nextPage(std::vector<std::string>* collections) {
+        if (this->position_ == this->current_.size() && this->pending_ != nullptr) {
+            this->advance();
+        }
+        collections->assign(std::make_move_iterator(this->current_.begin() + this->position_), std::make_move_iterator(this->current_.end()));
+        this->current_.clear();
+        this->position_ = 0;
+        return this->status_;
+    }
+
+    bool CollectionIterator::done() const {
+        return this->pending_ == nullptr && this->position_ == this->current_.size();
+    }
+
+    Status CollectionIterator::status() const {
+        return this->status_;
+    }
+
     Status BTrDB::lookupStreams(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> on_data, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
-        std::function<Status(std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)>)> callback = [=](std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> callback) {
-            return this->lookupStreamsAsync(ctx, callback, collection, is_prefix, tags, annotations);
+        if (this->options_.sync_mode == SyncMode::EventLoop) {
+            std::function<Status(std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)>)> callback = [=](std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> callback) {
+                return this->lookupStreamsAsync(ctx, callback, collection, is_prefix, tags, annotations);
+            };
+            return async_to_sync(std::move(callback), on_data);
+        }
+
+        auto self = shared_from_this();
+        bool delivered = false;
+        std::function<void()> restart_record;
+        on_data = this->recordLookup(lookup_streams_params(collection, is_prefix, tags, annotations), std::move(on_data), &restart_record);
+        std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> deliver = [&](bool finished, Status status, std::vector<std::unique_ptr<Stream>>& streams) {
+            if (BTrDB::isStaleMash(status)) {
+                // We will retry, so don't report this to the caller
+                return;
+            }
+            for (std::unique_ptr<Stream>& stream : streams) {
+                stream->attach(self);
+            }
+            delivered = finished;
+            on_data(finished, status, streams);
         };
-        return async_to_sync(std::move(callback), on_data);
+
+        Status status;
+        std::int64_t revision;
+        do {
+            revision = this->mashRevision();
+            /* A failed attempt may have recorded part of the result; the retry starts over. */
+            restart_record();
+            std::shared_ptr<Endpoint> ep;
+            status = this->anyEndpoint(ctx, &ep);
+            if (status.isError()) {
+                continue;
+            }
+            status = ep->lookupStreams(ctx, deliver, collection, is_prefix, tags, annotations);
+        } while (this->handleEndpointStatus(status, revision));
+
+        if (!delivered) {
+            std::vector<std::unique_ptr<Stream>> dummy;
+            on_data(true, status, dummy);
+        }
+        return status;
+    }
+
+    Status BTrDB::lookupStreams(std::function<void(grpc::ClientContext*)> ctx, StreamTable* table, std::vector<StreamHandle>* result, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
+        /*
+         * The table cannot take records back, so the descriptors are only
+         * added once we know the attempt that delivered them is not retried.
+         */
+        std::vector<grpcinterface::LookupStreamsResponse> responses;
+        Status status;
+        std::int64_t revision;
+        do {
+            revision = this->mashRevision();
+            responses.clear();
+            std::shared_ptr<Endpoint> ep;
+            status = this->anyEndpoint(ctx, &ep);
+            if (status.isError()) {
+                continue;
+            }
+            status = ep->lookupStreamDescriptors(ctx, [&](const grpcinterface::LookupStreamsResponse& response) {
+                responses.push_back(response);
+            }, collection, is_prefix, tags, annotations);
+        } while (this->handleEndpointStatus(status, revision));
+
+        std::size_t num_values = 0;
+        for (const grpcinterface::LookupStreamsResponse& response : responses) {
+            num_values += response.values_size();
+        }
+        result->reserve(result->size() + num_values);
+        for (const grpcinterface::LookupStreamsResponse& response : responses) {
+            for (int i = 0; i != response.values_size(); i++) {
+                result->push_back(table->add(response.values(i)));
+            }
+        }
+        return status;
+    }
+
+    Status BTrDB::lookupStreamDescriptors(std::function<void(grpc::ClientContext*)> ctx, std::function<void(const grpcinterface::StreamDescriptor&)> on_descriptor, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
+        Status status;
+        std::int64_t revision;
+        do {
+            revision = this->mashRevision();
+            std::shared_ptr<Endpoint> ep;
+            status = this->anyEndpoint(ctx, &ep);
+            if (status.isError()) {
+                continue;
+            }
+            status = ep->lookupStreamDescriptors(ctx, [&](const grpcinterface::LookupStreamsResponse& response) {
+                for (int i = 0; i != response.values_size(); i++) {
+                    on_descriptor(response.values(i));
+                }
+            }, collection, is_prefix, tags, annotations);
+        } while (this->handleEndpointStatus(status, revision));
+
+        return status;
+    }
+
+    std::unique_ptr<Stream> BTrDB::streamFromHandle(StreamTable* table, const StreamHandle& handle) {
+        return std::unique_ptr<Stream>(new Stream(shared_from_this(), handle.uuid, table->metadata(handle)));
     }
 
     Status BTrDB::listCollections(std::function<void(grpc::ClientContext*)> ctx, std::vector<std::string>* collections, const std::string& prefix) {
@@ -150,6 +500,7 @@ namespace btrdb {
     }
 
     Status BTrDB::lookupStreamsAsync(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> on_data, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
+        on_data = this->recordLookup(lookup_streams_params(collection, is_prefix, tags, annotations), std::move(on_data));
         this->asyncAnyEndpointOrError(ctx, [=](Status status, std::shared_ptr<Endpoint> ep) {
             if (status.isError()) {
                 std::vector<std::unique_ptr<Stream>> dummy;
@@ -160,7 +511,7 @@ namespace btrdb {
             auto self = shared_from_this();
             ep->lookupStreamsAsync(ctx, this->completion_queue, [self, on_data](bool finished, Status status, std::vector<std::unique_ptr<Stream>>& streams) {
                 for (std::unique_ptr<Stream>& stream : streams) {
-                    stream->b_ = self;
+                    stream->attach(self);
                 }
                 on_data(finished, status, streams);
             }, collection, is_prefix, tags, annotations);
@@ -174,85 +525,745 @@ namespace btrdb {
         const std::map<std::string, std::string>& tags,
         const std::map<std::string, std::string>& annotations) {
         Status status;
+        std::int64_t revision;
         do {
+            revision = this->mashRevision();
             std::shared_ptr<Endpoint> ep;
             status = this->endpointFor(ctx, uuid, &ep);
             if (status.isError()) {
                 continue;
             }
             status = ep->create(ctx, uuid, collection, tags, annotations);
-        } while (this->handleEndpointStatus(status));
+        } while (this->handleEndpointStatus(status, revision));
 
         return status;
     }
 
-    BTrDB::BTrDB(const MASH& activeMash, const std::vector<std::string>& bootstraps)
-        : activeMash_(activeMash), bootstraps_(bootstraps) {
-        this->completion_queue = new grpc::CompletionQueue;
+    Status BTrDB::cachedLookupStreams(std::function<void(grpc::ClientContext*)> ctx, std::vector<std::unique_ptr<Stream>>* result, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
+        std::string key = lookup_streams_params(collection, is_prefix, tags, annotations).SerializeAsString();
+        LookupResult recorded = this->snapshot_lookups_.get(key);
+        if (recorded != nullptr) {
+            auto self = shared_from_this();
+            result->reserve(result->size() + recorded->size());
+            for (const grpcinterface::StreamDescriptor& descriptor : *recorded) {
+                result->emplace_back(new Stream(self, descriptor));
+            }
+            return Status();
+        }
+
+        return this->lookupStreams(ctx, result, collection, is_prefix, tags, annotations);
     }
 
-    Status BTrDB::anyEndpoint(std::function<void(grpc::ClientContext*)> ctx, std::shared_ptr<Endpoint>* endpoint) {
+    MetadataCacheStats BTrDB::metadataCacheStats() {
+        return this->metadata_cache_.stats();
+    }
+
+    std::map<std::string, AdmissionStats> BTrDB::admissionStats() {
+        std::map<std::string, AdmissionStats> stats;
+        std::lock_guard<std::mutex> lock(this->epcache_lock_);
+        for (auto& entry : this->epcache_) {
+            stats[entry.second->hostport()] = entry.second->admissionStats();
+        }
+        return stats;
+    }
+
+    Status BTrDB::streamInfoBulk(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::unique_ptr<Stream>>& streams, bool omit_version, bool omit_descriptor, std::uint32_t concurrency, std::vector<Status>* statuses) {
+        std::vector<Stream*> raw(streams.size());
+        for (std::size_t i = 0; i != streams.size(); i++) {
+            raw[i] = streams[i].get();
+        }
+        return this->streamInfoBulk(ctx, raw, omit_version, omit_descriptor, concurrency, statuses);
+    }
+
+    Status BTrDB::streamInfoBulk(std::function<void(grpc::ClientContext*)> ctx, const std::vector<Stream*>& streams, bool omit_version, bool omit_descriptor, std::uint32_t concurrency, std::vector<Status>* statuses) {
+        std::vector<char> uuids(streams.size() * UUID_NUM_BYTES);
+        for (std::size_t i = 0; i != streams.size(); i++) {
+            std::memcpy(&uuids[i * UUID_NUM_BYTES], streams[i]->uuid_, UUID_NUM_BYTES);
+        }
+        return this->bulkRequest(ctx, uuids.data(), streams.size(), concurrency, statuses, [=, &streams](Endpoint* ep, std::size_t i, std::function<void(Status)> on_done) {
+            Stream* stream = streams[i];
+            ep->streamInfoAsync(ctx, this->completion_queue, [=](Status status, const grpcinterface::StreamInfoResponse& response) {
+                if (!status.isError()) {
+                    if (!omit_descriptor) {
+                        stream->updateFromDescriptor(response.streamdescriptor());
+                    }
+                    if (!omit_version) {
+                        stream->has_version_ = true;
+                        stream->version_ = response.versionmajor();
+                    }
+                }
+                on_done(status);
+            }, stream->uuid_, omit_version, omit_descriptor);
+        });
+    }
+
+    Status BTrDB::setAnnotationsBulk(std::function<void(grpc::ClientContext*)> ctx, const std::vector<AnnotationUpdate>& updates, std::uint32_t concurrency, std::vector<Status>* statuses) {
+        std::vector<char> uuids(updates.size() * UUID_NUM_BYTES);
+        for (std::size_t i = 0; i != updates.size(); i++) {
+            std::memcpy(&uuids[i * UUID_NUM_BYTES], updates[i].stream->uuid_, UUID_NUM_BYTES);
+        }
+        return this->bulkRequest(ctx, uuids.data(), updates.size(), concurrency, statuses, [=, &updates](Endpoint* ep, std::size_t i, std::function<void(Status)> on_done) {
+            const AnnotationUpdate* update = &updates[i];
+            ep->setStreamAnnotationsAsync(ctx, this->completion_queue, [=](Status status) {
+                if (!status.isError()) {
+                    update->stream->annotationsSet(update->expected_version, update->changes);
+                }
+                on_done(status);
+            }, update->stream->uuid_, update->expected_version, update->changes);
+        });
+    }
+
+    Status BTrDB::latestValues(std::function<void(grpc::ClientContext*)> ctx, const void* uuids, std::size_t count, std::vector<struct RawPoint>* result, std::vector<std::uint64_t>* versions, std::uint32_t concurrency, std::vector<Status>* statuses) {
+        const char* ids = static_cast<const char*>(uuids);
+        const std::chrono::milliseconds ttl(this->options_.latest_value_ttl_ms);
+        result->assign(count, RawPoint());
+        std::vector<std::uint64_t> read_at(count, 0);
+
+        /* Only the streams without a fresh enough result are asked. */
+        std::vector<std::size_t> misses;
+        if (ttl.count() == 0) {
+            misses.resize(count);
+            for (std::size_t i = 0; i != count; i++) {
+                misses[i] = i;
+            }
+        } else {
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            std::lock_guard<std::mutex> lock(this->latest_values_lock_);
+            for (std::size_t i = 0; i != count; i++) {
+                auto it = this->latest_values_.find(std::string(ids + i * UUID_NUM_BYTES, UUID_NUM_BYTES));
+                if (it != this->latest_values_.end() && now - it->second.fetched < ttl) {
+                    (*result)[i] = it->second.point;
+                    read_at[i] = it->second.version;
+                } else {
+                    misses.push_back(i);
+                }
+            }
+            this->latest_values_fetching_++;
+        }
+
+        std::vector<char> miss_uuids(misses.size() * UUID_NUM_BYTES);
+        for (std::size_t m = 0; m != misses.size(); m++) {
+            std::memcpy(&miss_uuids[m * UUID_NUM_BYTES], ids + misses[m] * UUID_NUM_BYTES, UUID_NUM_BYTES);
+        }
+        std::vector<Status> miss_statuses;
+        std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+        Status status = this->bulkRequest(ctx, miss_uuids.data(), misses.size(), concurrency, &miss_statuses, [&, ctx](Endpoint* ep, std::size_t m, std::function<void(Status)> on_done) {
+            std::size_t i = misses[m];
+            ep->nearestAsync(ctx, this->completion_queue, [=, &result, &read_at](Status status, const RawPoint& point, std::uint64_t version) {
+                if (!status.isError()) {
+                    (*result)[i] = point;
+                    read_at[i] = version;
+                }
+                on_done(status);
+            }, ids + i * UUID_NUM_BYTES, MAX_TIME, true, 0);
+        });
+
+        if (ttl.count() != 0) {
+            std::lock_guard<std::mutex> lock(this->latest_values_lock_);
+            for (std::size_t m = 0; m != misses.size(); m++) {
+                std::string key(ids + misses[m] * UUID_NUM_BYTES, UUID_NUM_BYTES);
+                if (miss_statuses[m].isError() || this->latest_values_written_.count(key) != 0) {
+                    continue;
+                }
+                /* Timed from when the request was sent, so a result is never kept longer than ttl after it was read. */
+                latest_value& cached = this->latest_values_[key];
+                cached.point = (*result)[misses[m]];
+                cached.version = read_at[misses[m]];
+                cached.fetched = sent;
+            }
+            if (--this->latest_values_fetching_ == 0) {
+                this->latest_values_written_.clear();
+            }
+            if (this->latest_values_.size() >= this->latest_values_sweep_at_) {
+                std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+                for (auto it = this->latest_values_.begin(); it != this->latest_values_.end();) {
+                    if (now - it->second.fetched >= ttl) {
+                        it = this->latest_values_.erase(it);
+                    } else {
+                        it++;
+                    }
+                }
+                this->latest_values_sweep_at_ = std::max<std::size_t>(1024, 2 * this->latest_values_.size());
+            }
+        }
+
+        if (versions != nullptr) {
+            *versions = std::move(read_at);
+        }
+        if (statuses != nullptr) {
+            statuses->assign(count, Status());
+            for (std::size_t m = 0; m != misses.size(); m++) {
+                (*statuses)[misses[m]] = miss_statuses[m];
+            }
+        }
+        return status;
+    }
+
+    void BTrDB::forgetLatestValue(const void* uuid) {
+        if (this->options_.latest_value_ttl_ms == 0) {
+            return;
+        }
+        std::string key(static_cast<const char*>(uuid), UUID_NUM_BYTES);
+        std::lock_guard<std::mutex> lock(this->latest_values_lock_);
+        this->latest_values_.erase(key);
+        if (this->latest_values_fetching_ != 0) {
+            /* A latestValues in flight may have read the stream before this write. */
+            this->latest_values_written_.insert(std::move(key));
+        }
+    }
+
+    Status BTrDB::bulkRequest(std::function<void(grpc::ClientContext*)> ctx, const char* uuids, std::size_t count, std::uint32_t concurrency, std::vector<Status>* statuses, bulk_issue issue) {
+        std::vector<Status> results(count);
+        std::vector<std::size_t> pending(count);
+        for (std::size_t i = 0; i != count; i++) {
+            pending[i] = i;
+        }
+        if (concurrency == 0) {
+            concurrency = 1;
+        }
+
+        Status status;
+        std::int64_t revision;
+        do {
+            revision = this->mashRevision();
+            std::vector<std::size_t> retry;
+            this->bulkRound(ctx, uuids, pending, concurrency, &results, &retry, issue);
+            status = retry.empty() ? Status() : results[retry.front()];
+            pending = std::move(retry);
+        } while (this->handleEndpointStatus(status, revision));
+
+        Status first_error;
+        for (const Status& result : results) {
+            if (result.isError()) {
+                first_error = result;
+                break;
+            }
+        }
+        if (statuses != nullptr) {
+            *statuses = std::move(results);
+        }
+        return first_error;
+    }
+
+    /* Shared by the callbacks of one bulkRound. */
+    struct bulk_round {
+        struct group {
+            std::shared_ptr<Endpoint> ep;
+            std::vector<std::size_t> streams;
+            std::size_t next;
+        };
+
+        std::mutex lock;
+        std::condition_variable done;
+        std::size_t outstanding;
+        std::vector<group> groups;
+        std::vector<std::size_t> retry;
+    };
+
+    void BTrDB::bulkRound(std::function<void(grpc::ClientContext*)> ctx, const char* uuids, const std::vector<std::size_t>& pending, std::uint32_t concurrency, std::vector<Status>* statuses, std::vector<std::size_t>* retry, const bulk_issue& issue) {
+        std::vector<char> pending_uuids(pending.size() * UUID_NUM_BYTES);
+        for (std::size_t i = 0; i != pending.size(); i++) {
+            std::memcpy(&pending_uuids[i * UUID_NUM_BYTES], uuids + pending[i] * UUID_NUM_BYTES, UUID_NUM_BYTES);
+        }
+        std::vector<MASH::route_group> routes;
+        std::vector<std::size_t> unrouted;
+        this->route(pending_uuids.data(), pending.size(), &routes, &unrouted);
+        for (std::size_t i : unrouted) {
+            (*statuses)[pending[i]] = Status::ClusterDegraded;
+        }
+
+        std::shared_ptr<bulk_round> bulk = std::make_shared<bulk_round>();
+        bulk->outstanding = 0;
+        for (const MASH::route_group& route : routes) {
+            std::shared_ptr<Endpoint> ep;
+            Status status = this->memberEndpoint(ctx, route.hash, route.grpc, &ep);
+            if (status.isError()) {
+                for (std::size_t i : route.indices) {
+                    (*statuses)[pending[i]] = status;
+                }
+                continue;
+            }
+            bulk->groups.emplace_back();
+            bulk_round::group& g = bulk->groups.back();
+            g.ep = ep;
+            g.next = 0;
+            for (std::size_t i : route.indices) {
+                g.streams.push_back(pending[i]);
+            }
+            bulk->outstanding += g.streams.size();
+        }
+
+        /*
+         * Keep up to concurrency requests in flight to each member: every
+         * response sends the next request for that member, so a member
+         * takes about (its streams / concurrency) round trips.
+         */
+        std::function<void(std::size_t)> send = [=, &send, &issue](std::size_t g) {
+            std::size_t s;
+            {
+                std::lock_guard<std::mutex> lock(bulk->lock);
+                bulk_round::group& grp = bulk->groups[g];
+                if (grp.next == grp.streams.size()) {
+                    return;
+                }
+                s = grp.streams[grp.next++];
+            }
+            issue(bulk->groups[g].ep.get(), s, [=, &send](Status status) {
+                (*statuses)[s] = status;
+                send(g);
+
+                std::lock_guard<std::mutex> lock(bulk->lock);
+                if (status.code() == 405) {
+                    bulk->retry.push_back(s);
+                }
+                if (--bulk->outstanding == 0) {
+                    bulk->done.notify_all();
+                }
+            });
+        };
+        for (std::size_t g = 0; g != bulk->groups.size(); g++) {
+            for (std::uint32_t i = 0; i != concurrency; i++) {
+                send(g);
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(bulk->lock);
+        bulk->done.wait(lock, [&]() {
+            return bulk->outstanding == 0;
+        });
+        *retry = std::move(bulk->retry);
+    }
+
+    Status BTrDB::route(const void* uuids, std::size_t count, std::vector<MASH::route_group>* groups, std::vector<std::size_t>* unrouted) {
+        std::size_t num_unrouted;
+        {
+            std::lock_guard<std::mutex> lock(this->mash_lock_);
+            num_unrouted = this->activeMash_.route(uuids, count, groups, unrouted);
+        }
+        if (num_unrouted != 0) {
+            return Status::ClusterDegraded;
+        }
+        return Status();
+    }
+
+    ConnectionStats BTrDB::connectionStats() {
+        return this->connections_->stats();
+    }
+
+    std::size_t BTrDB::closeIdleConnections() {
+        return this->connections_->reapIdle();
+    }
+
+    void BTrDB::closeConnections() {
         {
             std::lock_guard<std::mutex> lock(this->epcache_lock_);
-            auto it = this->epcache_.begin();
-            if (it != this->epcache_.end()) {
-                // TODO: maybe we want to select a random endpoint from the cache?
-                *endpoint = it->second;
-                return Status();
+            this->epcache_.clear();
+            this->alternate_epcache_.clear();
+        }
+        this->connections_->closeAll();
+    }
+
+    std::shared_ptr<ConnectionRegistry> BTrDB::newConnectionRegistry(const ConnectOptions& options) {
+        return std::make_shared<ConnectionRegistry>(options.channel, options.admission, options.breaker, options.connection_idle_ms);
+    }
+
+    std::uint64_t BTrDB::coalescedQueries() const {
+        return this->aligned_windows_coalescer_.saved();
+    }
+
+    bool BTrDB::saveSnapshot() {
+        if (this->options_.snapshot_path.empty()) {
+            return false;
+        }
+
+        grpcinterface::Mash mash;
+        {
+            std::lock_guard<std::mutex> lock(this->mash_lock_);
+            mash = this->activeMash_.proto();
+        }
+
+        /* The results are shared, so this copy is cheap, and the file is written without holding up lookups. */
+        std::map<std::string, LookupResult> lookups = this->snapshot_lookups_.entries();
+        std::lock_guard<std::mutex> lock(this->snapshot_write_lock_);
+        return save_snapshot(this->options_.snapshot_path, mash, lookups);
+    }
+
+    void BTrDB::scheduleSnapshot() {
+        if (this->options_.snapshot_path.empty()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(this->snapshot_lock_);
+            this->snapshot_dirty_ = true;
+        }
+        this->snapshot_cond_.notify_all();
+    }
+
+    void BTrDB::snapshotWriter() {
+        std::unique_lock<std::mutex> lock(this->snapshot_lock_);
+        for (;;) {
+            this->snapshot_cond_.wait(lock, [this]() {
+                return this->snapshot_dirty_ || this->snapshot_stop_;
+            });
+            /* Let further changes pile up, so that a burst of them is written once. */
+            this->snapshot_cond_.wait_for(lock, std::chrono::milliseconds(this->options_.snapshot_interval_ms), [this]() {
+                return this->snapshot_stop_;
+            });
+            if (this->snapshot_dirty_) {
+                this->snapshot_dirty_ = false;
+                lock.unlock();
+                this->saveSnapshot();
+                lock.lock();
+            }
+            if (this->snapshot_stop_) {
+                return;
+            }
+        }
+    }
+
+    std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> BTrDB::recordLookup(const grpcinterface::LookupStreamsParams& params, std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> on_data, std::function<void()>* restart) {
+        if (this->options_.snapshot_path.empty()) {
+            if (restart != nullptr) {
+                *restart = []() {};
             }
+            return on_data;
         }
 
-        /* The cache is empty, so we need to connect. */
-        char uuid[UUID_NUM_BYTES];
-        std::random_device random;
-        std::size_t i = 0;
-        while (i != UUID_NUM_BYTES) {
-            unsigned int data = random();
-            std::size_t to_copy = UUID_NUM_BYTES - i;
-            if (to_copy > sizeof(data)) {
-                to_copy = sizeof(data);
+        std::string key = params.SerializeAsString();
+        std::shared_ptr<std::vector<grpcinterface::StreamDescriptor>> descriptors = std::make_shared<std::vector<grpcinterface::StreamDescriptor>>();
+        if (restart != nullptr) {
+            *restart = [descriptors]() {
+                descriptors->clear();
+            };
+        }
+        return [=](bool finished, Status status, std::vector<std::unique_ptr<Stream>>& streams) {
+            for (const std::unique_ptr<Stream>& stream : streams) {
+                descriptors->emplace_back();
+                stream->toDescriptor(&descriptors->back());
+            }
+            if (finished && !status.isError()) {
+                this->snapshot_lookups_.put(key, std::make_shared<const std::vector<grpcinterface::StreamDescriptor>>(std::move(*descriptors)));
+                this->scheduleSnapshot();
             }
+            on_data(finished, status, streams);
+        };
+    }
 
-            char* data_ptr = reinterpret_cast<char*>(&data);
-            std::copy(data_ptr, &data_ptr[to_copy], &uuid[i]);
-            i += to_copy;
+    void BTrDB::updateMash(const grpcinterface::Mash& mash) {
+        std::lock_guard<std::mutex> lock(this->mash_lock_);
+        if (mash.revision() == this->activeMash_.revision()) {
+            return;
+        }
+        this->activeMash_.setProtoMash(mash);
+
+        /* Keep connections to members that are still in the cluster. */
+        std::lock_guard<std::mutex> eplock(this->epcache_lock_);
+        for (auto it = this->epcache_.begin(); it != this->epcache_.end();) {
+            if (this->activeMash_.hasMember(it->first)) {
+                it++;
+            } else {
+                it = this->epcache_.erase(it);
+            }
+        }
+        for (auto it = this->alternate_epcache_.begin(); it != this->alternate_epcache_.end();) {
+            if (this->activeMash_.hasMember(it->first)) {
+                it++;
+            } else {
+                it = this->alternate_epcache_.erase(it);
+            }
+        }
+    }
+
+    std::int64_t BTrDB::mashRevision() {
+        std::lock_guard<std::mutex> lock(this->mash_lock_);
+        return this->activeMash_.revision();
+    }
+
+    void BTrDB::refreshMashAsync(std::int64_t stale_revision, std::function<void()> on_done) {
+        bool stale;
+        {
+            std::lock_guard<std::mutex> lock(this->refresh_lock_);
+            /* Someone else may have refreshed it since the request was routed. */
+            stale = this->mashRevision() == stale_revision;
+            if (stale) {
+                this->mash_waiters_.push_back(on_done);
+                if (this->mash_refreshing_) {
+                    return;
+                }
+                this->mash_refreshing_ = true;
+            }
+        }
+        if (!stale) {
+            on_done();
+            return;
         }
 
         /*
-         * We have filled UUID with random bytes. So it may not actually be a
-         * valid UUID, but it should work fine anyway.
+         * As in rawConnect, ask every bootstrap endpoint and take the first
+         * MASH, but on the event loop's completion queue, so that no thread
+         * waits for the answer.
          */
-        return this->endpointFor(ctx, uuid, endpoint);
+        struct refresh {
+            std::mutex lock;
+            std::size_t pending;
+            bool done;
+        };
+        auto state = std::make_shared<refresh>();
+        state->pending = this->bootstraps_.size();
+        state->done = false;
+        if (state->pending == 0) {
+            this->finishMashRefresh();
+            return;
+        }
+
+        std::shared_ptr<BTrDB> self = shared_from_this();
+        for (const std::string& hostport : this->bootstraps_) {
+            std::shared_ptr<Endpoint> ep = this->connections_->acquire(hostport);
+            auto ctx = [](grpc::ClientContext* context) {
+                bootstrap_context(connect_ctx, context);
+            };
+            ep->infoAsync(ctx, this->completion_queue, [self, state, hostport, ep](Status stat, const grpcinterface::InfoResponse& response) {
+                bool finish;
+                {
+                    std::lock_guard<std::mutex> lock(state->lock);
+                    state->pending--;
+                    if (state->done) {
+                        return;
+                    }
+                    state->done = !stat.isError() && response.has_mash();
+                    finish = state->done || state->pending == 0;
+                }
+                if (state->done) {
+                    self->updateMash(response.mash());
+                    self->adoptEndpoint(hostport, ep);
+                    self->scheduleSnapshot();
+                }
+                if (finish) {
+                    self->finishMashRefresh();
+                }
+            });
+        }
+    }
+
+    void BTrDB::finishMashRefresh() {
+        std::vector<std::function<void()>> waiters;
+        {
+            std::lock_guard<std::mutex> lock(this->refresh_lock_);
+            waiters.swap(this->mash_waiters_);
+            this->mash_refreshing_ = false;
+        }
+        for (std::function<void()>& waiter : waiters) {
+            waiter();
+        }
+    }
+
+    void BTrDB::refreshMash(std::int64_t stale_revision) {
+        struct wait {
+            std::mutex lock;
+            std::condition_variable cond;
+            bool done;
+        };
+        auto state = std::make_shared<wait>();
+        state->done = false;
+        this->refreshMashAsync(stale_revision, [state]() {
+            std::lock_guard<std::mutex> lock(state->lock);
+            state->done = true;
+            state->cond.notify_all();
+        });
+        std::unique_lock<std::mutex> lock(state->lock);
+        state->cond.wait(lock, [&state]() { return state->done; });
+    }
+
+    BTrDB::BTrDB(const MASH& activeMash, const std::vector<std::string>& bootstraps, const ConnectOptions& options, std::shared_ptr<ConnectionRegistry> connections)
+        : activeMash_(activeMash), mash_refreshing_(false), bootstraps_(bootstraps), options_(options), connections_(std::move(connections)),
+          metadata_cache_(options.metadata_cache_bytes), latest_values_sweep_at_(1024), latest_values_fetching_(0),
+          snapshot_lookups_(options.snapshot_max_bytes), snapshot_dirty_(false), snapshot_stop_(false) {
+        this->completion_queue = new grpc::CompletionQueue;
+        if (!options.snapshot_path.empty()) {
+            this->snapshot_writer_ = std::thread(&BTrDB::snapshotWriter, this);
+        }
+        if (options.hedge.enabled) {
+            this->hedge_policy_ = std::make_shared<HedgePolicy>(options.hedge);
+        }
+    }
+
+    void BTrDB::adoptEndpoint(const std::string& hostport, const std::shared_ptr<Endpoint>& ep) {
+        /*
+         * If the bootstrap endpoint is also the gRPC address of a member,
+         * keep its channel rather than reconnecting on first use.
+         */
+        if (ep == nullptr) {
+            return;
+        }
+
+        std::uint32_t hash;
+        bool ok;
+        {
+            std::lock_guard<std::mutex> lock(this->mash_lock_);
+            ok = this->activeMash_.memberFor(hostport, &hash);
+        }
+        if (ok) {
+            std::lock_guard<std::mutex> lock(this->epcache_lock_);
+            this->epcache_[hash] = ep;
+        }
+    }
+
+    Status BTrDB::anyEndpoint(std::function<void(grpc::ClientContext*)> ctx, std::shared_ptr<Endpoint>* endpoint) {
+        std::uint32_t hash;
+        std::vector<std::string> addrs;
+        Status status = this->chooseAnyMember(&hash, &addrs, endpoint);
+        if (status.isError() || *endpoint != nullptr) {
+            return status;
+        }
+        return this->memberEndpoint(ctx, hash, addrs, endpoint);
+    }
+
+    /*
+     * Picks a member for a request that any member can serve. If we are
+     * already connected to it, *endpoint is set; otherwise *hash and *addrs
+     * say where to connect.
+     */
+    Status BTrDB::chooseAnyMember(std::uint32_t* hash, std::vector<std::string>* addrs, std::shared_ptr<Endpoint>* endpoint) {
+        std::vector<MASH::member> members;
+        {
+            std::lock_guard<std::mutex> lock(this->mash_lock_);
+            members = this->activeMash_.members();
+        }
+        if (members.empty()) {
+            return Status::ClusterDegraded;
+        }
+
+        /* Members with a read preference of zero are only used if all of them have it. */
+        bool any_preferred = false;
+        for (const MASH::member& m : members) {
+            if (m.read_preference > 0) {
+                any_preferred = true;
+                break;
+            }
+        }
+        for (MASH::member& m : members) {
+            if (!any_preferred) {
+                m.read_preference = 1;
+            } else if (m.read_preference < 0) {
+                m.read_preference = 0;
+            }
+        }
+
+        std::vector<std::size_t> connected;
+        std::vector<std::size_t> unconnected;
+        std::vector<std::shared_ptr<Endpoint>> eps(members.size());
+        {
+            std::lock_guard<std::mutex> lock(this->epcache_lock_);
+            for (std::size_t i = 0; i != members.size(); i++) {
+                if (members[i].read_preference == 0) {
+                    continue;
+                }
+                auto it = this->epcache_.find(members[i].hash);
+                if (it != this->epcache_.end()) {
+                    eps[i] = it->second;
+                } else {
+                    unconnected.push_back(i);
+                }
+            }
+        }
+        /* Leave out members whose breaker is open; checking may start a probe, so not under epcache_lock_. */
+        for (std::size_t i = 0; i != members.size(); i++) {
+            if (eps[i] != nullptr) {
+                if (this->checkHealth(eps[i])) {
+                    connected.push_back(i);
+                } else {
+                    eps[i].reset();
+                }
+            }
+        }
+
+        static thread_local std::mt19937 random((std::random_device())());
+        auto weighted_choice = [&](const std::vector<std::size_t>& from) {
+            double total = 0;
+            for (std::size_t i : from) {
+                total += members[i].read_preference;
+            }
+            double x = std::uniform_real_distribution<double>(0, total)(random);
+            for (std::size_t i : from) {
+                x -= members[i].read_preference;
+                if (x < 0) {
+                    return i;
+                }
+            }
+            return from.back();
+        };
+
+        if (!connected.empty()) {
+            /*
+             * Power of two choices: draw two connected members by read
+             * preference, and take the one with less expected wait, which we
+             * estimate as RPCs in flight times average latency.
+             */
+            std::size_t best = weighted_choice(connected);
+            std::size_t other = weighted_choice(connected);
+            auto cost = [&](std::size_t i) {
+                std::uint64_t latency = std::max<std::uint64_t>(eps[i]->latency(), 1);
+                return (eps[i]->inFlight() + 1) * latency / members[i].read_preference;
+            };
+            if (other != best && cost(other) < cost(best)) {
+                best = other;
+            }
+
+            std::uint32_t spread = this->options_.metadata_spread_in_flight;
+            if (unconnected.empty() || spread == 0 || eps[best]->inFlight() < spread) {
+                *endpoint = eps[best];
+                return Status();
+            }
+        }
+        if (unconnected.empty()) {
+            return Status::Unhealthy;
+        }
+
+        /* Connect to another member, either because we have none or because they are busy. */
+        std::size_t chosen = weighted_choice(unconnected);
+        *hash = members[chosen].hash;
+        *addrs = members[chosen].grpc;
+        endpoint->reset();
+        return Status();
     }
 
     Status BTrDB::endpointFor(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::shared_ptr<Endpoint>* endpoint) {
         std::uint32_t hash;
         std::vector<std::string> addrs;
-        bool ok = this->activeMash_.endpointFor(uuid, &addrs, &hash);
+        bool ok;
+        {
+            std::lock_guard<std::mutex> lock(this->mash_lock_);
+            ok = this->activeMash_.endpointFor(uuid, &addrs, &hash);
+        }
         if (!ok) {
             // Cluster is degraded
             return Status::ClusterDegraded;
         }
 
+        return this->memberEndpoint(ctx, hash, addrs, endpoint);
+    }
+
+    Status BTrDB::memberEndpoint(std::function<void(grpc::ClientContext*)> ctx, std::uint32_t hash, const std::vector<std::string>& addrs, std::shared_ptr<Endpoint>* endpoint) {
         // Check if it's in the cache
+        std::shared_ptr<Endpoint> cached;
         {
             std::lock_guard<std::mutex> lock(this->epcache_lock_);
             auto it = this->epcache_.find(hash);
             if (it != this->epcache_.end()) {
-                *endpoint = it->second;
-                return Status();
+                cached = it->second;
             }
         }
+        if (cached != nullptr) {
+            return this->healthyEndpoint(hash, addrs, cached, endpoint);
+        }
 
         // It's not in the cache, so we need to connect, trying each address
-        for (std::string addr : addrs) {
-            Endpoint* ep = new Endpoint;
+        for (const std::string& addr : addrs) {
+            std::shared_ptr<Endpoint> ep = this->connections_->acquire(addr);
 
             grpc::ClientContext context;
             ctx(&context);
-            bool success = ep->connectBlocking(context.raw_deadline(), { addr });
-            if (!success) {
-                delete ep;
+            if (!ep->waitForConnected(context.raw_deadline())) {
                 continue;
             }
 
@@ -264,11 +1275,11 @@ namespace btrdb {
                 continue;
             }
 
-            *endpoint = std::shared_ptr<Endpoint>(ep);
             {
                 std::lock_guard<std::mutex> lock(this->epcache_lock_);
-                this->epcache_[hash] = *endpoint;
+                this->epcache_[hash] = ep;
             }
+            *endpoint = ep;
             return Status();
         }
 
@@ -276,52 +1287,36 @@ namespace btrdb {
     }
 
     struct async_endpoint_state {
-        std::vector<std::string>::size_type reqs_left;
+        std::mutex lock;
+        std::size_t reqs_left;
         bool delivered;
+        Status error;
     };
 
     void BTrDB::asyncAnyEndpoint(std::function<void(grpc::ClientContext*)> ctx, std::function<void(Status, std::shared_ptr<Endpoint>&)> on_done) {
+        std::uint32_t hash;
+        std::vector<std::string> addrs;
         std::shared_ptr<Endpoint> ep;
-        {
-            std::lock_guard<std::mutex> lock(this->epcache_lock_);
-            auto it = this->epcache_.begin();
-            if (it != this->epcache_.end()) {
-                // TODO: maybe we want to select a random endpoint from the cache?
-                ep = it->second;
-            }
+        Status status = this->chooseAnyMember(&hash, &addrs, &ep);
+        if (status.isError()) {
+            on_done(status, ep);
+            return;
         }
         if (ep != nullptr) {
             on_done(Status(), ep);
             return;
         }
-
-        /* The cache is empty, so we need to connect. */
-        char uuid[UUID_NUM_BYTES];
-        std::random_device random;
-        std::size_t i = 0;
-        while (i != UUID_NUM_BYTES) {
-            unsigned int data = random();
-            std::size_t to_copy = UUID_NUM_BYTES - i;
-            if (to_copy > sizeof(data)) {
-                to_copy = sizeof(data);
-            }
-
-            char* data_ptr = reinterpret_cast<char*>(&data);
-            std::copy(data_ptr, &data_ptr[to_copy], &uuid[i]);
-            i += to_copy;
-        }
-
-        /*
-         * We have filled UUID with random bytes. So it may not actually be a
-         * valid UUID, but it should work fine anyway.
-         */
-        return this->asyncEndpointFor(ctx, uuid, std::move(on_done));
+        this->asyncMemberEndpoint(ctx, hash, addrs, std::move(on_done));
     }
 
     void BTrDB::asyncEndpointFor(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::function<void(Status, std::shared_ptr<Endpoint>&)> on_done) {
         std::uint32_t hash;
         std::vector<std::string> addrs;
-        bool ok = this->activeMash_.endpointFor(uuid, &addrs, &hash);
+        bool ok;
+        {
+            std::lock_guard<std::mutex> lock(this->mash_lock_);
+            ok = this->activeMash_.endpointFor(uuid, &addrs, &hash);
+        }
         if (!ok) {
             // Cluster is degraded
             std::shared_ptr<Endpoint> dummy;
@@ -329,6 +1324,10 @@ namespace btrdb {
             return;
         }
 
+        this->asyncMemberEndpoint(ctx, hash, addrs, std::move(on_done));
+    }
+
+    void BTrDB::asyncMemberEndpoint(std::function<void(grpc::ClientContext*)> ctx, std::uint32_t hash, const std::vector<std::string>& addrs, std::function<void(Status, std::shared_ptr<Endpoint>&)> on_done) {
         // Check if it's in the cache
         std::shared_ptr<Endpoint> ep;
 
@@ -341,99 +1340,241 @@ namespace btrdb {
         }
 
         if (ep != nullptr) {
-            on_done(Status(), ep);
+            Status status = this->healthyEndpoint(hash, addrs, ep, &ep);
+            on_done(status, ep);
             return;
         }
 
         // It's not in the cache, so we need to connect, trying each address
         // We make the requests concurrently.
-        struct async_endpoint_state* state = new struct async_endpoint_state;
-        state->reqs_left = addrs.size();
+        std::shared_ptr<struct async_endpoint_state> state = std::make_shared<struct async_endpoint_state>();
+        state->reqs_left = 1;
         state->delivered = false;
-        for (std::string addr : addrs) {
-            Endpoint* endpoint = new Endpoint;
+        state->error = Status::Disconnected;
+
+        /* Delivers the first endpoint that answers, or an error once every address has failed. */
+        auto finish = [=](Status stat, std::shared_ptr<Endpoint> ep) {
+            bool deliver = false;
+            {
+                std::lock_guard<std::mutex> lock(state->lock);
+                state->reqs_left--;
+                if (stat.isError()) {
+                    state->error = stat;
+                }
+                if (!state->delivered && (ep != nullptr || state->reqs_left == 0)) {
+                    state->delivered = true;
+                    deliver = true;
+                }
+            }
+            if (!deliver) {
+                return;
+            }
+            if (ep != nullptr) {
+                std::lock_guard<std::mutex> lock(this->epcache_lock_);
+                this->epcache_[hash] = ep;
+            }
+            on_done(ep != nullptr ? Status() : state->error, ep);
+        };
+
+        for (const std::string& addr : addrs) {
+            std::shared_ptr<Endpoint> endpoint = this->connections_->acquire(addr);
             grpc::ClientContext context;
             ctx(&context);
-            bool success = endpoint->connectBlocking(context.raw_deadline(), { addr });
-            if (!success) {
-                delete endpoint;
+            if (!endpoint->waitForConnected(context.raw_deadline())) {
                 continue;
             }
 
+            {
+                std::lock_guard<std::mutex> lock(state->lock);
+                state->reqs_left++;
+            }
             // Try a simple operation to force connection
             endpoint->infoAsync(connect_ctx, this->completion_queue, [=](Status stat, const grpcinterface::InfoResponse& response) {
-                if (state->delivered || stat.isError()) {
-                    delete endpoint;
-                } else if (!state->delivered && !stat.isError()) {
-                    std::shared_ptr<Endpoint> ep(endpoint);
-                    state->delivered = true;
-                    {
-                        std::lock_guard<std::mutex> lock(this->epcache_lock_);
-                        this->epcache_[hash] = ep;
-                    }
-                    on_done(stat, ep);
-                }
+                (void) response;
+                finish(stat, stat.isError() ? std::shared_ptr<Endpoint>(nullptr) : endpoint);
+            });
+        }
+        finish(Status(), std::shared_ptr<Endpoint>(nullptr));
+    }
 
-                state->reqs_left--;
-                if (state->reqs_left == 0) {
-                    delete state;
-                }
+    std::shared_ptr<HedgedCall> BTrDB::hedgedCall() {
+        if (this->hedge_policy_ == nullptr) {
+            return std::shared_ptr<HedgedCall>(nullptr);
+        }
+        return std::make_shared<HedgedCall>(this->hedge_policy_);
+    }
+
+    std::shared_ptr<Endpoint> BTrDB::alternateEndpointFor(const void* uuid) {
+        std::uint32_t hash;
+        std::vector<std::string> addrs;
+        bool ok;
+        {
+            std::lock_guard<std::mutex> lock(this->mash_lock_);
+            ok = this->activeMash_.endpointFor(uuid, &addrs, &hash);
+        }
+        if (!ok) {
+            return std::shared_ptr<Endpoint>(nullptr);
+        }
+        return this->alternateEndpoint(hash, addrs);
+    }
+
+    std::shared_ptr<Endpoint> BTrDB::alternateEndpoint(std::uint32_t hash, const std::vector<std::string>& addrs) {
+        std::lock_guard<std::mutex> lock(this->epcache_lock_);
+        auto it = this->alternate_epcache_.find(hash);
+        if (it != this->alternate_epcache_.end()) {
+            return it->second;
+        }
+
+        std::string primary;
+        auto pit = this->epcache_.find(hash);
+        if (pit != this->epcache_.end()) {
+            primary = pit->second->hostport();
+        }
+        for (const std::string& addr : addrs) {
+            if (addr != primary) {
+                /* The channel connects in the background; nothing here blocks. */
+                std::shared_ptr<Endpoint> ep = this->connections_->acquire(addr);
+                this->alternate_epcache_[hash] = ep;
+                return ep;
+            }
+        }
+        return std::shared_ptr<Endpoint>(nullptr);
+    }
+
+    bool BTrDB::checkHealth(const std::shared_ptr<Endpoint>& ep) {
+        bool probe;
+        if (ep->healthy(&probe)) {
+            return true;
+        }
+        if (probe) {
+            ep->infoAsync(connect_ctx, this->completion_queue, [ep](Status status, const grpcinterface::InfoResponse& response) {
+                (void) response;
+                ep->probed(!status.isError());
             });
         }
+        return false;
+    }
+
+    Status BTrDB::healthyEndpoint(std::uint32_t hash, const std::vector<std::string>& addrs, const std::shared_ptr<Endpoint>& cached, std::shared_ptr<Endpoint>* endpoint) {
+        if (this->checkHealth(cached)) {
+            *endpoint = cached;
+            return Status();
+        }
+
+        /* The breaker is open, so try the member's other address before giving up. */
+        std::shared_ptr<Endpoint> alternate = this->alternateEndpoint(hash, addrs);
+        if (alternate != nullptr && this->checkHealth(alternate)) {
+            *endpoint = alternate;
+            return Status();
+        }
+        endpoint->reset();
+        return Status::Unhealthy;
     }
 
     void BTrDB::asyncAnyEndpointOrError(std::function<void(grpc::ClientContext*)> ctx, std::function<void(Status, std::shared_ptr<Endpoint>&)> on_done) {
+        std::int64_t revision = this->mashRevision();
         this->asyncAnyEndpoint(ctx, [=](Status status, std::shared_ptr<Endpoint>& ep) {
-            if (this->handleEndpointStatus(status)) {
-                this->asyncAnyEndpointOrError(ctx, on_done);
-            } else {
+            if (!this->handleEndpointStatusAsync(status, revision, [=]() { this->asyncAnyEndpointOrError(ctx, on_done); })) {
                 on_done(status, ep);
             }
         });
     }
 
-    bool BTrDB::handleEndpointStatus(const Status& status) {
-        if (!status.isError()) {
+    bool BTrDB::isStaleMash(const Status& status) {
+        // Wrong Endpoint, so our MASH is out of date
+        return status.isError() && status.code() == 405;
+    }
+
+    bool BTrDB::handleEndpointStatus(const Status& status, std::int64_t routed_revision) {
+        if (!BTrDB::isStaleMash(status)) {
             return false;
         }
-        if (status.code() == 405) {
-            // Wrong Endpoint
-            return true;
+        this->refreshMash(routed_revision);
+        return true;
+    }
+
+    bool BTrDB::handleEndpointStatusAsync(const Status& status, std::int64_t routed_revision, std::function<void()> retry) {
+        if (!BTrDB::isStaleMash(status)) {
+            return false;
         }
-        return false;
+        this->refreshMashAsync(routed_revision, std::move(retry));
+        return true;
     }
 
-    void BTrDB::eventLoop(grpc::CompletionQueue* completion_queue) {
+    void BTrDB::eventLoop(grpc::CompletionQueue* completion_queue, const ConnectOptions options) {
+        if (options.event_loop_numa_node >= 0) {
+            pin_current_thread(numa_node_cpus(options.event_loop_numa_node));
+        } else if (!options.event_loop_cpus.empty()) {
+            pin_current_thread(options.event_loop_cpus);
+        }
+
         void* tag;
         bool ok;
-        while (completion_queue->Next(&tag, &ok)) {
-            AsyncRequest* reqdata = reinterpret_cast<AsyncRequest*>(tag);
-            if (ok) {
-                if (reqdata->process_batch()) {
-                    /* An error ocurred. */
-                    delete reqdata;
+        if (options.poll_mode == PollMode::Blocking) {
+            while (completion_queue->Next(&tag, &ok)) {
+                BTrDB::handleEvent(tag, ok);
+            }
+        } else {
+            /*
+             * Poll with a zero deadline so that we never sleep in the kernel
+             * while events are arriving. Once the queue has been idle for
+             * spin_polls polls, sleep between polls, doubling the sleep up to
+             * spin_max_backoff_us so that an idle connection does not burn a
+             * core indefinitely.
+             */
+            gpr_timespec zero = gpr_time_0(GPR_CLOCK_MONOTONIC);
+            std::uint32_t idle_polls = 0;
+            std::uint32_t backoff_us = 0;
+            for (;;) {
+                grpc::CompletionQueue::NextStatus next = completion_queue->AsyncNext(&tag, &ok, zero);
+                if (next == grpc::CompletionQueue::NextStatus::GOT_EVENT) {
+                    BTrDB::handleEvent(tag, ok);
+                    idle_polls = 0;
+                    backoff_us = 0;
+                } else if (next == grpc::CompletionQueue::NextStatus::SHUTDOWN) {
+                    break;
+                } else if (idle_polls < options.spin_polls) {
+                    idle_polls++;
+                } else if (options.spin_max_backoff_us == 0) {
+                    std::this_thread::yield();
+                } else {
+                    backoff_us = (backoff_us == 0) ? 1 : std::min(2 * backoff_us, options.spin_max_backoff_us);
+                    std::this_thread::sleep_for(std::chrono::microseconds(backoff_us));
                 }
-            } else {
-                /* No more data for this RPC. */
-                reqdata->end_request();
-                delete reqdata;
             }
         }
 
         delete completion_queue;
     }
 
-    void BTrDB::asyncConnectEventLoop(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string> endpoints, std::function<void(std::shared_ptr<BTrDB>)> on_done) {
-        std::unique_ptr<grpcinterface::Mash> mash = BTrDB::rawConnect(ctx, endpoints);
-        if (!mash) {
-            on_done(std::shared_ptr<BTrDB>(nullptr));
-            return;
+    void BTrDB::handleEvent(void* tag, bool ok) {
+        AsyncRequest* reqdata = reinterpret_cast<AsyncRequest*>(tag);
+        /* Requests issued from the callbacks inherit the class of this one. */
+        RequestScope scope(reqdata->request_class);
+        if (ok) {
+            if (reqdata->process_batch()) {
+                /* An error ocurred. */
+                delete reqdata;
+            }
+        } else {
+            /* No more data for this RPC. */
+            reqdata->end_request();
+            delete reqdata;
+        }
+    }
+
+    void BTrDB::asyncConnectEventLoop(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string> endpoints, std::function<void(std::shared_ptr<BTrDB>)> on_done, const ConnectOptions options) {
+        std::shared_ptr<BTrDB> b = BTrDB::warmConnect(ctx, endpoints, options);
+        if (!b) {
+            b = BTrDB::coldConnect(ctx, endpoints, options);
+            if (!b) {
+                on_done(b);
+                return;
+            }
         }
 
-        std::shared_ptr<BTrDB> b(new BTrDB(MASH(*mash), endpoints));
-        mash.reset(nullptr);
         on_done(b);
-        BTrDB::eventLoop(b->completion_queue);
+        BTrDB::eventLoop(b->completion_queue, options);
     }
 
     void default_ctx(grpc::ClientContext* context) {
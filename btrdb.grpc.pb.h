@@ -0,0 +1,71 @@
+#pragma once
+#include "btrdb.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/codegen/async_stream.h>
+#include <grpcpp/impl/codegen/async_unary_call.h>
+#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/impl/codegen/client_context.h>
+#include <grpcpp/impl/codegen/completion_queue.h>
+#include <grpcpp/impl/codegen/stub_options.h>
+#include <grpcpp/channel.h>
+#include <functional>
+namespace grpcinterface {
+class BTrDB final {
+ public:
+  class Stub final {
+   public:
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+    std::unique_ptr< ::grpc::ClientReader<::grpcinterface::RawValuesResponse>> RawValues(::grpc::ClientContext* context, const ::grpcinterface::RawValuesParams& request);
+    std::unique_ptr< ::grpc::ClientAsyncReader<::grpcinterface::RawValuesResponse>> AsyncRawValues(::grpc::ClientContext* context, const ::grpcinterface::RawValuesParams& request, ::grpc::CompletionQueue* cq, void* tag);
+    std::unique_ptr< ::grpc::ClientAsyncReader<::grpcinterface::RawValuesResponse>> PrepareAsyncRawValues(::grpc::ClientContext* context, const ::grpcinterface::RawValuesParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientReader<::grpcinterface::AlignedWindowsResponse>> AlignedWindows(::grpc::ClientContext* context, const ::grpcinterface::AlignedWindowsParams& request);
+    std::unique_ptr< ::grpc::ClientAsyncReader<::grpcinterface::AlignedWindowsResponse>> AsyncAlignedWindows(::grpc::ClientContext* context, const ::grpcinterface::AlignedWindowsParams& request, ::grpc::CompletionQueue* cq, void* tag);
+    std::unique_ptr< ::grpc::ClientAsyncReader<::grpcinterface::AlignedWindowsResponse>> PrepareAsyncAlignedWindows(::grpc::ClientContext* context, const ::grpcinterface::AlignedWindowsParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientReader<::grpcinterface::WindowsResponse>> Windows(::grpc::ClientContext* context, const ::grpcinterface::WindowsParams& request);
+    std::unique_ptr< ::grpc::ClientAsyncReader<::grpcinterface::WindowsResponse>> AsyncWindows(::grpc::ClientContext* context, const ::grpcinterface::WindowsParams& request, ::grpc::CompletionQueue* cq, void* tag);
+    std::unique_ptr< ::grpc::ClientAsyncReader<::grpcinterface::WindowsResponse>> PrepareAsyncWindows(::grpc::ClientContext* context, const ::grpcinterface::WindowsParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status StreamInfo(::grpc::ClientContext* context, const ::grpcinterface::StreamInfoParams& request, ::grpcinterface::StreamInfoResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::StreamInfoResponse>> AsyncStreamInfo(::grpc::ClientContext* context, const ::grpcinterface::StreamInfoParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::StreamInfoResponse>> PrepareAsyncStreamInfo(::grpc::ClientContext* context, const ::grpcinterface::StreamInfoParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status SetStreamAnnotations(::grpc::ClientContext* context, const ::grpcinterface::SetStreamAnnotationsParams& request, ::grpcinterface::SetStreamAnnotationsResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::SetStreamAnnotationsResponse>> AsyncSetStreamAnnotations(::grpc::ClientContext* context, const ::grpcinterface::SetStreamAnnotationsParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::SetStreamAnnotationsResponse>> PrepareAsyncSetStreamAnnotations(::grpc::ClientContext* context, const ::grpcinterface::SetStreamAnnotationsParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status Create(::grpc::ClientContext* context, const ::grpcinterface::CreateParams& request, ::grpcinterface::CreateResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::CreateResponse>> AsyncCreate(::grpc::ClientContext* context, const ::grpcinterface::CreateParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::CreateResponse>> PrepareAsyncCreate(::grpc::ClientContext* context, const ::grpcinterface::CreateParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status ListCollections(::grpc::ClientContext* context, const ::grpcinterface::ListCollectionsParams& request, ::grpcinterface::ListCollectionsResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::ListCollectionsResponse>> AsyncListCollections(::grpc::ClientContext* context, const ::grpcinterface::ListCollectionsParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::ListCollectionsResponse>> PrepareAsyncListCollections(::grpc::ClientContext* context, const ::grpcinterface::ListCollectionsParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientReader<::grpcinterface::LookupStreamsResponse>> LookupStreams(::grpc::ClientContext* context, const ::grpcinterface::LookupStreamsParams& request);
+    std::unique_ptr< ::grpc::ClientAsyncReader<::grpcinterface::LookupStreamsResponse>> AsyncLookupStreams(::grpc::ClientContext* context, const ::grpcinterface::LookupStreamsParams& request, ::grpc::CompletionQueue* cq, void* tag);
+    std::unique_ptr< ::grpc::ClientAsyncReader<::grpcinterface::LookupStreamsResponse>> PrepareAsyncLookupStreams(::grpc::ClientContext* context, const ::grpcinterface::LookupStreamsParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status Nearest(::grpc::ClientContext* context, const ::grpcinterface::NearestParams& request, ::grpcinterface::NearestResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::NearestResponse>> AsyncNearest(::grpc::ClientContext* context, const ::grpcinterface::NearestParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::NearestResponse>> PrepareAsyncNearest(::grpc::ClientContext* context, const ::grpcinterface::NearestParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientReader<::grpcinterface::ChangesResponse>> Changes(::grpc::ClientContext* context, const ::grpcinterface::ChangesParams& request);
+    std::unique_ptr< ::grpc::ClientAsyncReader<::grpcinterface::ChangesResponse>> AsyncChanges(::grpc::ClientContext* context, const ::grpcinterface::ChangesParams& request, ::grpc::CompletionQueue* cq, void* tag);
+    std::unique_ptr< ::grpc::ClientAsyncReader<::grpcinterface::ChangesResponse>> PrepareAsyncChanges(::grpc::ClientContext* context, const ::grpcinterface::ChangesParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status Insert(::grpc::ClientContext* context, const ::grpcinterface::InsertParams& request, ::grpcinterface::InsertResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::InsertResponse>> AsyncInsert(::grpc::ClientContext* context, const ::grpcinterface::InsertParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::InsertResponse>> PrepareAsyncInsert(::grpc::ClientContext* context, const ::grpcinterface::InsertParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status Delete(::grpc::ClientContext* context, const ::grpcinterface::DeleteParams& request, ::grpcinterface::DeleteResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::DeleteResponse>> AsyncDelete(::grpc::ClientContext* context, const ::grpcinterface::DeleteParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::DeleteResponse>> PrepareAsyncDelete(::grpc::ClientContext* context, const ::grpcinterface::DeleteParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status Info(::grpc::ClientContext* context, const ::grpcinterface::InfoParams& request, ::grpcinterface::InfoResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::InfoResponse>> AsyncInfo(::grpc::ClientContext* context, const ::grpcinterface::InfoParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::InfoResponse>> PrepareAsyncInfo(::grpc::ClientContext* context, const ::grpcinterface::InfoParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status FaultInject(::grpc::ClientContext* context, const ::grpcinterface::FaultInjectParams& request, ::grpcinterface::FaultInjectResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::FaultInjectResponse>> AsyncFaultInject(::grpc::ClientContext* context, const ::grpcinterface::FaultInjectParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::FaultInjectResponse>> PrepareAsyncFaultInject(::grpc::ClientContext* context, const ::grpcinterface::FaultInjectParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status Flush(::grpc::ClientContext* context, const ::grpcinterface::FlushParams& request, ::grpcinterface::FlushResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::FlushResponse>> AsyncFlush(::grpc::ClientContext* context, const ::grpcinterface::FlushParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::FlushResponse>> PrepareAsyncFlush(::grpc::ClientContext* context, const ::grpcinterface::FlushParams& request, ::grpc::CompletionQueue* cq);
+    ::grpc::Status Obliterate(::grpc::ClientContext* context, const ::grpcinterface::ObliterateParams& request, ::grpcinterface::ObliterateResponse* response);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::ObliterateResponse>> AsyncObliterate(::grpc::ClientContext* context, const ::grpcinterface::ObliterateParams& request, ::grpc::CompletionQueue* cq);
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface<::grpcinterface::ObliterateResponse>> PrepareAsyncObliterate(::grpc::ClientContext* context, const ::grpcinterface::ObliterateParams& request, ::grpc::CompletionQueue* cq);
+  };
+  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+};
+}
@@ -1,22 +1,142 @@
 #ifndef BTRDB_BTRDB_H_
 #define BTRDB_BTRDB_H_
 
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <grpc++/grpc++.h>
 
 #include "btrdb.grpc.pb.h"
+#include "btrdb_catalog.h"
+#include "btrdb_coalesce.h"
+#include "btrdb_connections.h"
 #include "btrdb_endpoint.h"
+#include "btrdb_groupcommit.h"
+#include "btrdb_hedge.h"
+#include "btrdb_ingest.h"
 #include "btrdb_mash.h"
+#include "btrdb_snapshot.h"
 #include "btrdb_stream.h"
+#include "btrdb_streamtable.h"
 #include "btrdb_util.h"
 
 namespace btrdb {
+    class CollectionIterator;
     class Endpoint;
     class Stream;
 
+    /*
+     * Selects how the synchronous API is executed. Direct issues blocking
+     * RPCs on the calling thread; EventLoop issues them asynchronously and
+     * waits for the event loop thread to deliver the result.
+     */
+    enum class SyncMode {
+        Direct,
+        EventLoop
+    };
+
+    /*
+     * Selects how the event loop thread waits for completions. Blocking
+     * sleeps in the completion queue until an event arrives; Spin polls the
+     * completion queue without blocking, trading a core for lower wakeup
+     * latency, and backs off adaptively while idle.
+     */
+    enum class PollMode {
+        Blocking,
+        Spin
+    };
+
+    /* Options that are fixed when a connection to BTrDB is established. */
+    struct ConnectOptions {
+        SyncMode sync_mode = SyncMode::Direct;
+
+        PollMode poll_mode = PollMode::Blocking;
+        /* Empty polls in Spin mode before the event loop starts to back off. */
+        std::uint32_t spin_polls = 10000;
+        /* Upper bound on the sleep between polls once backing off (0 never sleeps). */
+        std::uint32_t spin_max_backoff_us = 100;
+
+        /* Applied to every channel opened to the cluster, including bootstrap. */
+        ChannelOptions channel;
+
+        /* CPUs the event loop thread is pinned to; empty means no pinning. */
+        std::vector<int> event_loop_cpus;
+        /* If nonnegative, pins the event loop thread to the CPUs of this NUMA node. */
+        int event_loop_numa_node = -1;
+
+        /*
+         * If set, the MASH and the results of lookupStreams are saved to this
+         * file. On the next connect, requests are routed from the saved MASH
+         * immediately while it is checked against the cluster in the
+         * background, and cachedLookupStreams answers from the saved results.
+         */
+        std::string snapshot_path;
+        /* Serialized lookupStreams results kept for the snapshot; the least recently used are dropped. */
+        std::size_t snapshot_max_bytes = 64 << 20;
+        /* Changes are written out by a background thread, at most this often. */
+        std::uint32_t snapshot_interval_ms = 1000;
+
+        /*
+         * Metadata operations (listCollections, lookupStreams, ...) go to the
+         * least loaded of the members we are connected to. Once that member
+         * has this many RPCs in flight, a connection to another member is
+         * opened instead (0 never opens extra connections).
+         */
+        std::uint32_t metadata_spread_in_flight = 8;
+
+        HedgeOptions hedge;
+
+        /* Applied to each member separately. */
+        AdmissionOptions admission;
+
+        BreakerOptions breaker;
+
+        /*
+         * Connections are shared by address. One that no member or request
+         * has used for this long is closed (0 keeps connections open).
+         */
+        std::uint32_t connection_idle_ms = 60000;
+
+        /*
+         * Collections fetched per listCollections RPC (at least 2). Each
+         * page after the first repeats the last collection of the previous
+         * page.
+         */
+        std::uint32_t collection_page_size = 1000;
+
+        /* Memory for stream metadata shared between Stream objects (0 to keep it per Stream). */
+        std::size_t metadata_cache_bytes = 64 << 20;
+
+        /*
+         * Whether identical alignedWindows queries that are in flight at the
+         * same time share one RPC. The ctx of the query that was sent, with
+         * its deadline and metadata, applies to all of them; the others'
+         * ctx is not used.
+         */
+        bool coalesce_queries = false;
+
+        /*
+         * How long latestValues may answer for a stream from its previous
+         * result instead of asking again (0 always asks). A write to the
+         * stream through this BTrDB drops the result at once.
+         */
+        std::uint32_t latest_value_ttl_ms = 0;
+    };
+
+    /* One stream's change for BTrDB::setAnnotationsBulk (see Stream::setAnnotations). */
+    struct AnnotationUpdate {
+        Stream* stream;
+        std::uint64_t expected_version;
+        std::map<std::string, std::pair<std::string, bool>> changes;
+    };
+
     class BTrDB : public std::enable_shared_from_this<BTrDB> {
     public:
+        friend class CollectionIterator;
         friend class Stream;
 
         static const constexpr std::int64_t MAX_TIME = (INT64_C(48) << 56) - 1;
@@ -24,9 +144,10 @@ namespace btrdb {
         static const constexpr std::uint8_t MAX_PWE = 63;
 
         ~BTrDB();
-        static std::shared_ptr<BTrDB> connect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints);
-        static void connectAsync(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, std::function<void(std::shared_ptr<BTrDB> btrdb)> on_done);
+        static std::shared_ptr<BTrDB> connect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, const ConnectOptions& options = ConnectOptions());
+        static void connectAsync(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, std::function<void(std::shared_ptr<BTrDB> btrdb)> on_done, const ConnectOptions& options = ConnectOptions());
         std::unique_ptr<Stream> streamFromUUID(const void* uuid);
+        std::unique_ptr<Stream> streamFromHandle(StreamTable* table, const StreamHandle& handle);
 
         /* Asynchronous API */
         Status listCollectionsAsync(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, const std::vector<std::string>&)> on_data, const std::string& prefix);
@@ -36,38 +157,282 @@ namespace btrdb {
         Status listCollections(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<std::string>&)> on_data, const std::string& prefix);
         Status lookupStreams(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> on_data, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations);
 
+        /*
+         * Lists the collections starting with prefix one at a time. The
+         * next page is requested while the current one is being consumed.
+         */
+        std::unique_ptr<CollectionIterator> iterateCollections(std::function<void(grpc::ClientContext*)> ctx, const std::string& prefix);
+
         /* Simplified synchronous API for those who don't want to deal with callbacks. */
         Status listCollections(std::function<void(grpc::ClientContext*)> ctx, std::vector<std::string>* collections, const std::string& prefix);
         Status lookupStreams(std::function<void(grpc::ClientContext*)> ctx, std::vector<std::unique_ptr<Stream>>* result, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations);
 
+        /*
+         * lookupStreams for large results: each stream's metadata goes
+         * into table, and only a compact handle is appended to *result,
+         * without building a Stream. The descriptors are held until the
+         * lookup ends, so that a retried attempt leaves nothing behind in
+         * table. Always blocks the calling thread, whatever the SyncMode.
+         */
+        Status lookupStreams(std::function<void(grpc::ClientContext*)> ctx, StreamTable* table, std::vector<StreamHandle>* result, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations);
+
+        /*
+         * Calls on_descriptor with each matching stream's descriptor, as it
+         * arrives. If the query fails and is retried, the descriptors that
+         * the failed attempt delivered are delivered again. Always blocks.
+         */
+        Status lookupStreamDescriptors(std::function<void(grpc::ClientContext*)> ctx, std::function<void(const grpcinterface::StreamDescriptor&)> on_descriptor, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations);
+
         Status create(std::function<void(grpc::ClientContext*)> ctx, const void* uuid,
                       const std::string& collection,
                       const std::map<std::string, std::string>& tags,
                       const std::map<std::string, std::string>& annotations);
 
+        /*
+         * Like lookupStreams, but answers from the snapshot (see
+         * ConnectOptions::snapshot_path) if it has a result for this exact
+         * query, which may be out of date.
+         */
+        Status cachedLookupStreams(std::function<void(grpc::ClientContext*)> ctx, std::vector<std::unique_ptr<Stream>>* result, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations);
+
+        /*
+         * Groups count UUIDs, stored back to back, by the member that owns
+         * them (see MASH::route). Returns ClusterDegraded if some UUID has
+         * no owner; the UUIDs that do are grouped all the same.
+         */
+        Status route(const void* uuids, std::size_t count, std::vector<MASH::route_group>* groups, std::vector<std::size_t>* unrouted = nullptr);
+
+        /*
+         * Fetches the descriptor (tags, annotations, collection) and/or the
+         * version of many streams at once, and caches them in the Stream
+         * objects as refreshMetadata and version would. The StreamInfo
+         * requests are sent asynchronously, grouped by member, with up to
+         * concurrency in flight to each. If statuses is given, it receives
+         * each stream's result; the return value is the first error, if
+         * any (a stream that does not exist counts as an error).
+         */
+        Status streamInfoBulk(std::function<void(grpc::ClientContext*)> ctx, const std::vector<Stream*>& streams, bool omit_version, bool omit_descriptor, std::uint32_t concurrency = 64, std::vector<Status>* statuses = nullptr);
+        Status streamInfoBulk(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::unique_ptr<Stream>>& streams, bool omit_version, bool omit_descriptor, std::uint32_t concurrency = 64, std::vector<Status>* statuses = nullptr);
+
+        /*
+         * Stream::setAnnotations for many streams at once, sent the way
+         * streamInfoBulk sends its requests. Each update succeeds or fails
+         * on its own; statuses and the return value are as for
+         * streamInfoBulk. A stream should appear at most once.
+         */
+        Status setAnnotationsBulk(std::function<void(grpc::ClientContext*)> ctx, const std::vector<AnnotationUpdate>& updates, std::uint32_t concurrency = 64, std::vector<Status>* statuses = nullptr);
+
+        /*
+         * The latest point of each of count streams, whose UUIDs are
+         * stored back to back, as Stream::nearest(MAX_TIME, true) would
+         * return it: (*result)[i] is the i-th stream's, and (*versions)[i],
+         * if versions is given, the version it was read at. The Nearest
+         * requests are sent the way streamInfoBulk sends its requests, and
+         * statuses and the return value are as for it; a stream with no
+         * points counts as an error, and its result is left zero.
+         */
+        Status latestValues(std::function<void(grpc::ClientContext*)> ctx, const void* uuids, std::size_t count, std::vector<struct RawPoint>* result, std::vector<std::uint64_t>* versions = nullptr, std::uint32_t concurrency = 64, std::vector<Status>* statuses = nullptr);
+
+        /* Hit and miss counters of the shared stream metadata cache. */
+        MetadataCacheStats metadataCacheStats();
+
+        /* Admission scheduler counters for each member we are connected to, by address. */
+        std::map<std::string, AdmissionStats> admissionStats();
+
+        /* Connections currently open to the cluster. */
+        ConnectionStats connectionStats();
+        /* Closes connections that have been unused for ConnectOptions::connection_idle_ms, and returns how many. */
+        std::size_t closeIdleConnections();
+        /* Closes every connection; later requests reconnect as needed. */
+        void closeConnections();
+
+        /* alignedWindows queries that shared an identical query's RPC (see ConnectOptions::coalesce_queries). */
+        std::uint64_t coalescedQueries() const;
+
+        /* Writes the snapshot now. Returns false if snapshots are disabled or on I/O error. */
+        bool saveSnapshot();
+
         grpc::CompletionQueue* completion_queue;
 
     private:
-        BTrDB(const MASH& activeMash, const std::vector<std::string>& bootstraps);
-        static std::unique_ptr<grpcinterface::Mash> rawConnect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints);
+        BTrDB(const MASH& activeMash, const std::vector<std::string>& bootstraps, const ConnectOptions& options, std::shared_ptr<ConnectionRegistry> connections);
+        static std::shared_ptr<ConnectionRegistry> newConnectionRegistry(const ConnectOptions& options);
+        static std::unique_ptr<grpcinterface::Mash> rawConnect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, ConnectionRegistry& connections, std::shared_ptr<Endpoint>* winner = nullptr, std::string* winner_hostport = nullptr);
+        void adoptEndpoint(const std::string& hostport, const std::shared_ptr<Endpoint>& ep);
+        static std::shared_ptr<BTrDB> coldConnect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, const ConnectOptions& options);
+        static std::shared_ptr<BTrDB> warmConnect(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string>& endpoints, const ConnectOptions& options);
+        void updateMash(const grpcinterface::Mash& mash);
+        /* The revision of the MASH that requests are routed with now. */
+        std::int64_t mashRevision();
+        /*
+         * Fetches the current MASH, unless it has already moved on from
+         * stale_revision, and then calls on_done: from the event loop, or
+         * at once if no fetch was needed. Overlapping refreshes share one
+         * fetch. Never blocks.
+         */
+        void refreshMashAsync(std::int64_t stale_revision, std::function<void()> on_done);
+        /* Runs the callbacks waiting for the refresh in flight. */
+        void finishMashRefresh();
+        /* refreshMashAsync, waiting for it to finish; must not be called on the event loop thread. */
+        void refreshMash(std::int64_t stale_revision);
+        /*
+         * Wraps on_data to record the result for the snapshot. If restart is
+         * given, it is set to a function that discards what has been
+         * recorded, for a caller that retries the query.
+         */
+        std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> recordLookup(const grpcinterface::LookupStreamsParams& params, std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> on_data, std::function<void()>* restart = nullptr);
+        /* Has the snapshot written soon, by snapshotWriter. */
+        void scheduleSnapshot();
+        void snapshotWriter();
         Status anyEndpoint(std::function<void(grpc::ClientContext*)> ctx, std::shared_ptr<Endpoint>* endpoint);
         Status endpointFor(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::shared_ptr<Endpoint>* endpoint);
+        Status memberEndpoint(std::function<void(grpc::ClientContext*)> ctx, std::uint32_t hash, const std::vector<std::string>& addrs, std::shared_ptr<Endpoint>* endpoint);
+        Status chooseAnyMember(std::uint32_t* hash, std::vector<std::string>* addrs, std::shared_ptr<Endpoint>* endpoint);
 
         void asyncAnyEndpoint(std::function<void(grpc::ClientContext*)> ctx, std::function<void(Status, std::shared_ptr<Endpoint>&)> on_done);
         void asyncEndpointFor(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::function<void(Status, std::shared_ptr<Endpoint>&)> on_done);
+        void asyncMemberEndpoint(std::function<void(grpc::ClientContext*)> ctx, std::uint32_t hash, const std::vector<std::string>& addrs, std::function<void(Status, std::shared_ptr<Endpoint>&)> on_done);
+
+        /* Hedging (see HedgeOptions); hedgedCall returns null if it is disabled. */
+        std::shared_ptr<HedgedCall> hedgedCall();
+
+        /* An Endpoint at another of the member's addresses, or null if it has only one. */
+        std::shared_ptr<Endpoint> alternateEndpointFor(const void* uuid);
+        std::shared_ptr<Endpoint> alternateEndpoint(std::uint32_t hash, const std::vector<std::string>& addrs);
+        /* Whether ep's breaker is closed; if it is time to probe ep, starts the probe. */
+        bool checkHealth(const std::shared_ptr<Endpoint>& ep);
+        /* cached if it is healthy, else the member's alternate address if that is, else Status::Unhealthy. */
+        Status healthyEndpoint(std::uint32_t hash, const std::vector<std::string>& addrs, const std::shared_ptr<Endpoint>& cached, std::shared_ptr<Endpoint>* endpoint);
 
         void asyncAnyEndpointOrError(std::function<void(grpc::ClientContext*)> ctx, std::function<void(Status, std::shared_ptr<Endpoint>&)> on_done);
-        bool handleEndpointStatus(const Status& status);
+        /* Whether status says that the request was routed with an out of date MASH. */
+        static bool isStaleMash(const Status& status);
+        /*
+         * Whether a request that ended with status should be retried, as
+         * it should if its MASH was out of date. routed_revision is what
+         * mashRevision returned before the request was routed; unless the
+         * MASH has changed since, it is refreshed before returning. For
+         * retry loops on the caller's thread only, since it blocks.
+         */
+        bool handleEndpointStatus(const Status& status, std::int64_t routed_revision);
+        /* handleEndpointStatus for callbacks on the event loop: calls retry once the MASH is refreshed, instead of blocking. */
+        bool handleEndpointStatusAsync(const Status& status, std::int64_t routed_revision, std::function<void()> retry);
+
+        /*
+         * The request loop of the bulk calls, over count UUIDs stored back
+         * to back: issue sends the request for the i-th UUID to the member
+         * that owns it and calls on_done with the result, from the event
+         * loop.
+         */
+        typedef std::function<void(Endpoint*, std::size_t, std::function<void(Status)>)> bulk_issue;
+        Status bulkRequest(std::function<void(grpc::ClientContext*)> ctx, const char* uuids, std::size_t count, std::uint32_t concurrency, std::vector<Status>* statuses, bulk_issue issue);
+        /* One pass of bulkRequest over the UUIDs in pending; those that hit a stale MASH go in *retry. */
+        void bulkRound(std::function<void(grpc::ClientContext*)> ctx, const char* uuids, const std::vector<std::size_t>& pending, std::uint32_t concurrency, std::vector<Status>* statuses, std::vector<std::size_t>* retry, const bulk_issue& issue);
+
+        /* A latestValues result, kept for ConnectOptions::latest_value_ttl_ms. */
+        struct latest_value {
+            struct RawPoint point;
+            std::uint64_t version;
+            std::chrono::steady_clock::time_point fetched;
+        };
+        /* Drops the stream's latestValues result; called on every write to it. */
+        void forgetLatestValue(const void* uuid);
 
-        Status listCollectionsAsyncHelper(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, const std::vector<std::string>&)> on_data, const std::string& prefix, std::string from);
+        /*
+         * Requests the page of collections after from. With prefetch, a
+         * failure to issue the request is returned rather than passed to
+         * on_data, so that the caller can deliver its own page first.
+         */
+        /* The sync listCollections in SyncMode::Direct: one page at a time, on the calling thread. */
+        Status listCollectionsDirect(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<std::string>&)> on_data, const std::string& prefix);
+        Status listCollectionsAsyncHelper(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, const std::vector<std::string>&)> on_data, const std::string& prefix, std::string from, bool prefetch = false);
 
-        static void eventLoop(grpc::CompletionQueue* completion_queue);
-        static void asyncConnectEventLoop(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string> endpoints, std::function<void(std::shared_ptr<BTrDB>)> on_done);
+        static void eventLoop(grpc::CompletionQueue* completion_queue, const ConnectOptions options);
+        static void handleEvent(void* tag, bool ok);
+        static void asyncConnectEventLoop(std::function<void(grpc::ClientContext*)> ctx, const std::vector<std::string> endpoints, std::function<void(std::shared_ptr<BTrDB>)> on_done, const ConnectOptions options);
 
         MASH activeMash_;
+        std::mutex mash_lock_;
+        /* Guards the two fields below. */
+        std::mutex refresh_lock_;
+        bool mash_refreshing_;
+        std::vector<std::function<void()>> mash_waiters_;
         std::map<std::uint32_t, std::shared_ptr<Endpoint>> epcache_;
         std::mutex epcache_lock_;
+        /* Endpoints at a member's other address, for hedging and failover; guarded by epcache_lock_. */
+        std::map<std::uint32_t, std::shared_ptr<Endpoint>> alternate_epcache_;
+        std::shared_ptr<HedgePolicy> hedge_policy_;
         std::vector<std::string> bootstraps_;
+        ConnectOptions options_;
+        std::shared_ptr<ConnectionRegistry> connections_;
+
+        QueryCoalescer<struct StatisticalPoint> aligned_windows_coalescer_;
+        MetadataCache metadata_cache_;
+
+        /* Guarded by latest_values_lock_, like the fields below. */
+        std::unordered_map<std::string, latest_value> latest_values_;
+        /* Expired results are swept out once there are this many. */
+        std::size_t latest_values_sweep_at_;
+        /* latestValues calls in flight, and the streams written to meanwhile, whose results they must not keep. */
+        std::uint32_t latest_values_fetching_;
+        std::unordered_set<std::string> latest_values_written_;
+        std::mutex latest_values_lock_;
+
+        SnapshotLookups snapshot_lookups_;
+        /* Serializes writes to the snapshot file. */
+        std::mutex snapshot_write_lock_;
+        /* Guards the fields below, which tell snapshotWriter what to do. */
+        std::mutex snapshot_lock_;
+        std::condition_variable snapshot_cond_;
+        bool snapshot_dirty_;
+        bool snapshot_stop_;
+        std::thread snapshot_writer_;
+    };
+
+    class CollectionIterator {
+    public:
+        CollectionIterator(const CollectionIterator&) = delete;
+        CollectionIterator& operator=(const CollectionIterator&) = delete;
+
+        /* Sets *collection to the next collection and returns true, or returns false once done. */
+        bool next(std::string* collection);
+        /* Replaces *collections with the rest of the current page, or the next one if it is used up. */
+        Status nextPage(std::vector<std::string>* collections);
+        /* Whether every collection has been returned, or listing failed. */
+        bool done() const;
+        /* The error that ended the listing, if any. */
+        Status status() const;
+
+    private:
+        friend class BTrDB;
+
+        /* A page being fetched, filled in by the event loop. */
+        struct page {
+            std::mutex lock;
+            std::condition_variable ready_cond;
+            bool ready = false;
+            Status status;
+            std::vector<std::string> collections;
+            /* The MASH revision when the page was requested. */
+            std::int64_t revision;
+        };
+
+        CollectionIterator(const std::shared_ptr<BTrDB>& b, std::function<void(grpc::ClientContext*)> ctx, const std::string& prefix, std::uint64_t page_size);
+        void fetch();
+        /* Waits for the page being fetched, makes it current, and fetches the next one. */
+        void advance();
+
+        std::shared_ptr<BTrDB> b_;
+        std::function<void(grpc::ClientContext*)> ctx_;
+        std::string prefix_;
+        std::uint64_t page_size_;
+        /* Where the page being fetched starts. */
+        std::string from_;
+        /* The page being fetched; null once there are no more pages. */
+        std::shared_ptr<page> pending_;
+        std::vector<std::string> current_;
+        std::size_t position_;
+        Status status_;
     };
 
     void default_ctx(grpc::ClientContext* context);
@@ -0,0 +1,13595 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: btrdb.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_btrdb_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_btrdb_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_btrdb_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_btrdb_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_btrdb_2eproto;
+namespace grpcinterface {
+class AlignedWindowsParams;
+struct AlignedWindowsParamsDefaultTypeInternal;
+extern AlignedWindowsParamsDefaultTypeInternal _AlignedWindowsParams_default_instance_;
+class AlignedWindowsResponse;
+struct AlignedWindowsResponseDefaultTypeInternal;
+extern AlignedWindowsResponseDefaultTypeInternal _AlignedWindowsResponse_default_instance_;
+class ChangedRange;
+struct ChangedRangeDefaultTypeInternal;
+extern ChangedRangeDefaultTypeInternal _ChangedRange_default_instance_;
+class ChangesParams;
+struct ChangesParamsDefaultTypeInternal;
+extern ChangesParamsDefaultTypeInternal _ChangesParams_default_instance_;
+class ChangesResponse;
+struct ChangesResponseDefaultTypeInternal;
+extern ChangesResponseDefaultTypeInternal _ChangesResponse_default_instance_;
+class CreateParams;
+struct CreateParamsDefaultTypeInternal;
+extern CreateParamsDefaultTypeInternal _CreateParams_default_instance_;
+class CreateResponse;
+struct CreateResponseDefaultTypeInternal;
+extern CreateResponseDefaultTypeInternal _CreateResponse_default_instance_;
+class DeleteParams;
+struct DeleteParamsDefaultTypeInternal;
+extern DeleteParamsDefaultTypeInternal _DeleteParams_default_instance_;
+class DeleteResponse;
+struct DeleteResponseDefaultTypeInternal;
+extern DeleteResponseDefaultTypeInternal _DeleteResponse_default_instance_;
+class FaultInjectParams;
+struct FaultInjectParamsDefaultTypeInternal;
+extern FaultInjectParamsDefaultTypeInternal _FaultInjectParams_default_instance_;
+class FaultInjectResponse;
+struct FaultInjectResponseDefaultTypeInternal;
+extern FaultInjectResponseDefaultTypeInternal _FaultInjectResponse_default_instance_;
+class FlushParams;
+struct FlushParamsDefaultTypeInternal;
+extern FlushParamsDefaultTypeInternal _FlushParams_default_instance_;
+class FlushResponse;
+struct FlushResponseDefaultTypeInternal;
+extern FlushResponseDefaultTypeInternal _FlushResponse_default_instance_;
+class InfoParams;
+struct InfoParamsDefaultTypeInternal;
+extern InfoParamsDefaultTypeInternal _InfoParams_default_instance_;
+class InfoResponse;
+struct InfoResponseDefaultTypeInternal;
+extern InfoResponseDefaultTypeInternal _InfoResponse_default_instance_;
+class InsertParams;
+struct InsertParamsDefaultTypeInternal;
+extern InsertParamsDefaultTypeInternal _InsertParams_default_instance_;
+class InsertResponse;
+struct InsertResponseDefaultTypeInternal;
+extern InsertResponseDefaultTypeInternal _InsertResponse_default_instance_;
+class KeyOptValue;
+struct KeyOptValueDefaultTypeInternal;
+extern KeyOptValueDefaultTypeInternal _KeyOptValue_default_instance_;
+class KeyValue;
+struct KeyValueDefaultTypeInternal;
+extern KeyValueDefaultTypeInternal _KeyValue_default_instance_;
+class ListCollectionsParams;
+struct ListCollectionsParamsDefaultTypeInternal;
+extern ListCollectionsParamsDefaultTypeInternal _ListCollectionsParams_default_instance_;
+class ListCollectionsResponse;
+struct ListCollectionsResponseDefaultTypeInternal;
+extern ListCollectionsResponseDefaultTypeInternal _ListCollectionsResponse_default_instance_;
+class LookupStreamsParams;
+struct LookupStreamsParamsDefaultTypeInternal;
+extern LookupStreamsParamsDefaultTypeInternal _LookupStreamsParams_default_instance_;
+class LookupStreamsResponse;
+struct LookupStreamsResponseDefaultTypeInternal;
+extern LookupStreamsResponseDefaultTypeInternal _LookupStreamsResponse_default_instance_;
+class Mash;
+struct MashDefaultTypeInternal;
+extern MashDefaultTypeInternal _Mash_default_instance_;
+class Member;
+struct MemberDefaultTypeInternal;
+extern MemberDefaultTypeInternal _Member_default_instance_;
+class NearestParams;
+struct NearestParamsDefaultTypeInternal;
+extern NearestParamsDefaultTypeInternal _NearestParams_default_instance_;
+class NearestResponse;
+struct NearestResponseDefaultTypeInternal;
+extern NearestResponseDefaultTypeInternal _NearestResponse_default_instance_;
+class ObliterateParams;
+struct ObliterateParamsDefaultTypeInternal;
+extern ObliterateParamsDefaultTypeInternal _ObliterateParams_default_instance_;
+class ObliterateResponse;
+struct ObliterateResponseDefaultTypeInternal;
+extern ObliterateResponseDefaultTypeInternal _ObliterateResponse_default_instance_;
+class OptValue;
+struct OptValueDefaultTypeInternal;
+extern OptValueDefaultTypeInternal _OptValue_default_instance_;
+class RawPoint;
+struct RawPointDefaultTypeInternal;
+extern RawPointDefaultTypeInternal _RawPoint_default_instance_;
+class RawValuesParams;
+struct RawValuesParamsDefaultTypeInternal;
+extern RawValuesParamsDefaultTypeInternal _RawValuesParams_default_instance_;
+class RawValuesResponse;
+struct RawValuesResponseDefaultTypeInternal;
+extern RawValuesResponseDefaultTypeInternal _RawValuesResponse_default_instance_;
+class SetStreamAnnotationsParams;
+struct SetStreamAnnotationsParamsDefaultTypeInternal;
+extern SetStreamAnnotationsParamsDefaultTypeInternal _SetStreamAnnotationsParams_default_instance_;
+class SetStreamAnnotationsResponse;
+struct SetStreamAnnotationsResponseDefaultTypeInternal;
+extern SetStreamAnnotationsResponseDefaultTypeInternal _SetStreamAnnotationsResponse_default_instance_;
+class StatPoint;
+struct StatPointDefaultTypeInternal;
+extern StatPointDefaultTypeInternal _StatPoint_default_instance_;
+class Status;
+struct StatusDefaultTypeInternal;
+extern StatusDefaultTypeInternal _Status_default_instance_;
+class StreamDescriptor;
+struct StreamDescriptorDefaultTypeInternal;
+extern StreamDescriptorDefaultTypeInternal _StreamDescriptor_default_instance_;
+class StreamInfoParams;
+struct StreamInfoParamsDefaultTypeInternal;
+extern StreamInfoParamsDefaultTypeInternal _StreamInfoParams_default_instance_;
+class StreamInfoResponse;
+struct StreamInfoResponseDefaultTypeInternal;
+extern StreamInfoResponseDefaultTypeInternal _StreamInfoResponse_default_instance_;
+class WindowsParams;
+struct WindowsParamsDefaultTypeInternal;
+extern WindowsParamsDefaultTypeInternal _WindowsParams_default_instance_;
+class WindowsResponse;
+struct WindowsResponseDefaultTypeInternal;
+extern WindowsResponseDefaultTypeInternal _WindowsResponse_default_instance_;
+}  // namespace grpcinterface
+PROTOBUF_NAMESPACE_OPEN
+template<> ::grpcinterface::AlignedWindowsParams* Arena::CreateMaybeMessage<::grpcinterface::AlignedWindowsParams>(Arena*);
+template<> ::grpcinterface::AlignedWindowsResponse* Arena::CreateMaybeMessage<::grpcinterface::AlignedWindowsResponse>(Arena*);
+template<> ::grpcinterface::ChangedRange* Arena::CreateMaybeMessage<::grpcinterface::ChangedRange>(Arena*);
+template<> ::grpcinterface::ChangesParams* Arena::CreateMaybeMessage<::grpcinterface::ChangesParams>(Arena*);
+template<> ::grpcinterface::ChangesResponse* Arena::CreateMaybeMessage<::grpcinterface::ChangesResponse>(Arena*);
+template<> ::grpcinterface::CreateParams* Arena::CreateMaybeMessage<::grpcinterface::CreateParams>(Arena*);
+template<> ::grpcinterface::CreateResponse* Arena::CreateMaybeMessage<::grpcinterface::CreateResponse>(Arena*);
+template<> ::grpcinterface::DeleteParams* Arena::CreateMaybeMessage<::grpcinterface::DeleteParams>(Arena*);
+template<> ::grpcinterface::DeleteResponse* Arena::CreateMaybeMessage<::grpcinterface::DeleteResponse>(Arena*);
+template<> ::grpcinterface::FaultInjectParams* Arena::CreateMaybeMessage<::grpcinterface::FaultInjectParams>(Arena*);
+template<> ::grpcinterface::FaultInjectResponse* Arena::CreateMaybeMessage<::grpcinterface::FaultInjectResponse>(Arena*);
+template<> ::grpcinterface::FlushParams* Arena::CreateMaybeMessage<::grpcinterface::FlushParams>(Arena*);
+template<> ::grpcinterface::FlushResponse* Arena::CreateMaybeMessage<::grpcinterface::FlushResponse>(Arena*);
+template<> ::grpcinterface::InfoParams* Arena::CreateMaybeMessage<::grpcinterface::InfoParams>(Arena*);
+template<> ::grpcinterface::InfoResponse* Arena::CreateMaybeMessage<::grpcinterface::InfoResponse>(Arena*);
+template<> ::grpcinterface::InsertParams* Arena::CreateMaybeMessage<::grpcinterface::InsertParams>(Arena*);
+template<> ::grpcinterface::InsertResponse* Arena::CreateMaybeMessage<::grpcinterface::InsertResponse>(Arena*);
+template<> ::grpcinterface::KeyOptValue* Arena::CreateMaybeMessage<::grpcinterface::KeyOptValue>(Arena*);
+template<> ::grpcinterface::KeyValue* Arena::CreateMaybeMessage<::grpcinterface::KeyValue>(Arena*);
+template<> ::grpcinterface::ListCollectionsParams* Arena::CreateMaybeMessage<::grpcinterface::ListCollectionsParams>(Arena*);
+template<> ::grpcinterface::ListCollectionsResponse* Arena::CreateMaybeMessage<::grpcinterface::ListCollectionsResponse>(Arena*);
+template<> ::grpcinterface::LookupStreamsParams* Arena::CreateMaybeMessage<::grpcinterface::LookupStreamsParams>(Arena*);
+template<> ::grpcinterface::LookupStreamsResponse* Arena::CreateMaybeMessage<::grpcinterface::LookupStreamsResponse>(Arena*);
+template<> ::grpcinterface::Mash* Arena::CreateMaybeMessage<::grpcinterface::Mash>(Arena*);
+template<> ::grpcinterface::Member* Arena::CreateMaybeMessage<::grpcinterface::Member>(Arena*);
+template<> ::grpcinterface::NearestParams* Arena::CreateMaybeMessage<::grpcinterface::NearestParams>(Arena*);
+template<> ::grpcinterface::NearestResponse* Arena::CreateMaybeMessage<::grpcinterface::NearestResponse>(Arena*);
+template<> ::grpcinterface::ObliterateParams* Arena::CreateMaybeMessage<::grpcinterface::ObliterateParams>(Arena*);
+template<> ::grpcinterface::ObliterateResponse* Arena::CreateMaybeMessage<::grpcinterface::ObliterateResponse>(Arena*);
+template<> ::grpcinterface::OptValue* Arena::CreateMaybeMessage<::grpcinterface::OptValue>(Arena*);
+template<> ::grpcinterface::RawPoint* Arena::CreateMaybeMessage<::grpcinterface::RawPoint>(Arena*);
+template<> ::grpcinterface::RawValuesParams* Arena::CreateMaybeMessage<::grpcinterface::RawValuesParams>(Arena*);
+template<> ::grpcinterface::RawValuesResponse* Arena::CreateMaybeMessage<::grpcinterface::RawValuesResponse>(Arena*);
+template<> ::grpcinterface::SetStreamAnnotationsParams* Arena::CreateMaybeMessage<::grpcinterface::SetStreamAnnotationsParams>(Arena*);
+template<> ::grpcinterface::SetStreamAnnotationsResponse* Arena::CreateMaybeMessage<::grpcinterface::SetStreamAnnotationsResponse>(Arena*);
+template<> ::grpcinterface::StatPoint* Arena::CreateMaybeMessage<::grpcinterface::StatPoint>(Arena*);
+template<> ::grpcinterface::Status* Arena::CreateMaybeMessage<::grpcinterface::Status>(Arena*);
+template<> ::grpcinterface::StreamDescriptor* Arena::CreateMaybeMessage<::grpcinterface::StreamDescriptor>(Arena*);
+template<> ::grpcinterface::StreamInfoParams* Arena::CreateMaybeMessage<::grpcinterface::StreamInfoParams>(Arena*);
+template<> ::grpcinterface::StreamInfoResponse* Arena::CreateMaybeMessage<::grpcinterface::StreamInfoResponse>(Arena*);
+template<> ::grpcinterface::WindowsParams* Arena::CreateMaybeMessage<::grpcinterface::WindowsParams>(Arena*);
+template<> ::grpcinterface::WindowsResponse* Arena::CreateMaybeMessage<::grpcinterface::WindowsResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace grpcinterface {
+
+// ===================================================================
+
+class RawValuesParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.RawValuesParams) */ {
+ public:
+  inline RawValuesParams() : RawValuesParams(nullptr) {}
+  ~RawValuesParams() override;
+  explicit PROTOBUF_CONSTEXPR RawValuesParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RawValuesParams(const RawValuesParams& from);
+  RawValuesParams(RawValuesParams&& from) noexcept
+    : RawValuesParams() {
+    *this = ::std::move(from);
+  }
+
+  inline RawValuesParams& operator=(const RawValuesParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RawValuesParams& operator=(RawValuesParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RawValuesParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RawValuesParams* internal_default_instance() {
+    return reinterpret_cast<const RawValuesParams*>(
+               &_RawValuesParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(RawValuesParams& a, RawValuesParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RawValuesParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RawValuesParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RawValuesParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RawValuesParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RawValuesParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RawValuesParams& from) {
+    RawValuesParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RawValuesParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.RawValuesParams";
+  }
+  protected:
+  explicit RawValuesParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kStartFieldNumber = 2,
+    kEndFieldNumber = 3,
+    kVersionMajorFieldNumber = 4,
+  };
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // sfixed64 start = 2;
+  void clear_start();
+  int64_t start() const;
+  void set_start(int64_t value);
+  private:
+  int64_t _internal_start() const;
+  void _internal_set_start(int64_t value);
+  public:
+
+  // sfixed64 end = 3;
+  void clear_end();
+  int64_t end() const;
+  void set_end(int64_t value);
+  private:
+  int64_t _internal_end() const;
+  void _internal_set_end(int64_t value);
+  public:
+
+  // uint64 versionMajor = 4;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.RawValuesParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    int64_t start_;
+    int64_t end_;
+    uint64_t versionmajor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RawValuesResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.RawValuesResponse) */ {
+ public:
+  inline RawValuesResponse() : RawValuesResponse(nullptr) {}
+  ~RawValuesResponse() override;
+  explicit PROTOBUF_CONSTEXPR RawValuesResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RawValuesResponse(const RawValuesResponse& from);
+  RawValuesResponse(RawValuesResponse&& from) noexcept
+    : RawValuesResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline RawValuesResponse& operator=(const RawValuesResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RawValuesResponse& operator=(RawValuesResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RawValuesResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RawValuesResponse* internal_default_instance() {
+    return reinterpret_cast<const RawValuesResponse*>(
+               &_RawValuesResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RawValuesResponse& a, RawValuesResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RawValuesResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RawValuesResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RawValuesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RawValuesResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RawValuesResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RawValuesResponse& from) {
+    RawValuesResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RawValuesResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.RawValuesResponse";
+  }
+  protected:
+  explicit RawValuesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValuesFieldNumber = 4,
+    kStatFieldNumber = 1,
+    kVersionMajorFieldNumber = 2,
+    kVersionMinorFieldNumber = 3,
+  };
+  // repeated .grpcinterface.RawPoint values = 4;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  ::grpcinterface::RawPoint* mutable_values(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::RawPoint >*
+      mutable_values();
+  private:
+  const ::grpcinterface::RawPoint& _internal_values(int index) const;
+  ::grpcinterface::RawPoint* _internal_add_values();
+  public:
+  const ::grpcinterface::RawPoint& values(int index) const;
+  ::grpcinterface::RawPoint* add_values();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::RawPoint >&
+      values() const;
+
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // uint64 versionMajor = 2;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // uint64 versionMinor = 3;
+  void clear_versionminor();
+  uint64_t versionminor() const;
+  void set_versionminor(uint64_t value);
+  private:
+  uint64_t _internal_versionminor() const;
+  void _internal_set_versionminor(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.RawValuesResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::RawPoint > values_;
+    ::grpcinterface::Status* stat_;
+    uint64_t versionmajor_;
+    uint64_t versionminor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AlignedWindowsParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.AlignedWindowsParams) */ {
+ public:
+  inline AlignedWindowsParams() : AlignedWindowsParams(nullptr) {}
+  ~AlignedWindowsParams() override;
+  explicit PROTOBUF_CONSTEXPR AlignedWindowsParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AlignedWindowsParams(const AlignedWindowsParams& from);
+  AlignedWindowsParams(AlignedWindowsParams&& from) noexcept
+    : AlignedWindowsParams() {
+    *this = ::std::move(from);
+  }
+
+  inline AlignedWindowsParams& operator=(const AlignedWindowsParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AlignedWindowsParams& operator=(AlignedWindowsParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AlignedWindowsParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AlignedWindowsParams* internal_default_instance() {
+    return reinterpret_cast<const AlignedWindowsParams*>(
+               &_AlignedWindowsParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(AlignedWindowsParams& a, AlignedWindowsParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AlignedWindowsParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AlignedWindowsParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AlignedWindowsParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AlignedWindowsParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AlignedWindowsParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AlignedWindowsParams& from) {
+    AlignedWindowsParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AlignedWindowsParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.AlignedWindowsParams";
+  }
+  protected:
+  explicit AlignedWindowsParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kStartFieldNumber = 2,
+    kEndFieldNumber = 3,
+    kVersionMajorFieldNumber = 4,
+    kPointWidthFieldNumber = 5,
+  };
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // sfixed64 start = 2;
+  void clear_start();
+  int64_t start() const;
+  void set_start(int64_t value);
+  private:
+  int64_t _internal_start() const;
+  void _internal_set_start(int64_t value);
+  public:
+
+  // sfixed64 end = 3;
+  void clear_end();
+  int64_t end() const;
+  void set_end(int64_t value);
+  private:
+  int64_t _internal_end() const;
+  void _internal_set_end(int64_t value);
+  public:
+
+  // uint64 versionMajor = 4;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // uint32 pointWidth = 5;
+  void clear_pointwidth();
+  uint32_t pointwidth() const;
+  void set_pointwidth(uint32_t value);
+  private:
+  uint32_t _internal_pointwidth() const;
+  void _internal_set_pointwidth(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.AlignedWindowsParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    int64_t start_;
+    int64_t end_;
+    uint64_t versionmajor_;
+    uint32_t pointwidth_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AlignedWindowsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.AlignedWindowsResponse) */ {
+ public:
+  inline AlignedWindowsResponse() : AlignedWindowsResponse(nullptr) {}
+  ~AlignedWindowsResponse() override;
+  explicit PROTOBUF_CONSTEXPR AlignedWindowsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AlignedWindowsResponse(const AlignedWindowsResponse& from);
+  AlignedWindowsResponse(AlignedWindowsResponse&& from) noexcept
+    : AlignedWindowsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline AlignedWindowsResponse& operator=(const AlignedWindowsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AlignedWindowsResponse& operator=(AlignedWindowsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AlignedWindowsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AlignedWindowsResponse* internal_default_instance() {
+    return reinterpret_cast<const AlignedWindowsResponse*>(
+               &_AlignedWindowsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(AlignedWindowsResponse& a, AlignedWindowsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AlignedWindowsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AlignedWindowsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AlignedWindowsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AlignedWindowsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AlignedWindowsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AlignedWindowsResponse& from) {
+    AlignedWindowsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AlignedWindowsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.AlignedWindowsResponse";
+  }
+  protected:
+  explicit AlignedWindowsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValuesFieldNumber = 4,
+    kStatFieldNumber = 1,
+    kVersionMajorFieldNumber = 2,
+    kVersionMinorFieldNumber = 3,
+  };
+  // repeated .grpcinterface.StatPoint values = 4;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  ::grpcinterface::StatPoint* mutable_values(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StatPoint >*
+      mutable_values();
+  private:
+  const ::grpcinterface::StatPoint& _internal_values(int index) const;
+  ::grpcinterface::StatPoint* _internal_add_values();
+  public:
+  const ::grpcinterface::StatPoint& values(int index) const;
+  ::grpcinterface::StatPoint* add_values();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StatPoint >&
+      values() const;
+
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // uint64 versionMajor = 2;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // uint64 versionMinor = 3;
+  void clear_versionminor();
+  uint64_t versionminor() const;
+  void set_versionminor(uint64_t value);
+  private:
+  uint64_t _internal_versionminor() const;
+  void _internal_set_versionminor(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.AlignedWindowsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StatPoint > values_;
+    ::grpcinterface::Status* stat_;
+    uint64_t versionmajor_;
+    uint64_t versionminor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WindowsParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.WindowsParams) */ {
+ public:
+  inline WindowsParams() : WindowsParams(nullptr) {}
+  ~WindowsParams() override;
+  explicit PROTOBUF_CONSTEXPR WindowsParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WindowsParams(const WindowsParams& from);
+  WindowsParams(WindowsParams&& from) noexcept
+    : WindowsParams() {
+    *this = ::std::move(from);
+  }
+
+  inline WindowsParams& operator=(const WindowsParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WindowsParams& operator=(WindowsParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WindowsParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WindowsParams* internal_default_instance() {
+    return reinterpret_cast<const WindowsParams*>(
+               &_WindowsParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(WindowsParams& a, WindowsParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WindowsParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WindowsParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WindowsParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WindowsParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WindowsParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WindowsParams& from) {
+    WindowsParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WindowsParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.WindowsParams";
+  }
+  protected:
+  explicit WindowsParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kStartFieldNumber = 2,
+    kEndFieldNumber = 3,
+    kVersionMajorFieldNumber = 4,
+    kWidthFieldNumber = 5,
+    kDepthFieldNumber = 6,
+  };
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // sfixed64 start = 2;
+  void clear_start();
+  int64_t start() const;
+  void set_start(int64_t value);
+  private:
+  int64_t _internal_start() const;
+  void _internal_set_start(int64_t value);
+  public:
+
+  // sfixed64 end = 3;
+  void clear_end();
+  int64_t end() const;
+  void set_end(int64_t value);
+  private:
+  int64_t _internal_end() const;
+  void _internal_set_end(int64_t value);
+  public:
+
+  // uint64 versionMajor = 4;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // uint64 width = 5;
+  void clear_width();
+  uint64_t width() const;
+  void set_width(uint64_t value);
+  private:
+  uint64_t _internal_width() const;
+  void _internal_set_width(uint64_t value);
+  public:
+
+  // uint32 depth = 6;
+  void clear_depth();
+  uint32_t depth() const;
+  void set_depth(uint32_t value);
+  private:
+  uint32_t _internal_depth() const;
+  void _internal_set_depth(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.WindowsParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    int64_t start_;
+    int64_t end_;
+    uint64_t versionmajor_;
+    uint64_t width_;
+    uint32_t depth_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WindowsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.WindowsResponse) */ {
+ public:
+  inline WindowsResponse() : WindowsResponse(nullptr) {}
+  ~WindowsResponse() override;
+  explicit PROTOBUF_CONSTEXPR WindowsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WindowsResponse(const WindowsResponse& from);
+  WindowsResponse(WindowsResponse&& from) noexcept
+    : WindowsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline WindowsResponse& operator=(const WindowsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WindowsResponse& operator=(WindowsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WindowsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WindowsResponse* internal_default_instance() {
+    return reinterpret_cast<const WindowsResponse*>(
+               &_WindowsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(WindowsResponse& a, WindowsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WindowsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WindowsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WindowsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WindowsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WindowsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WindowsResponse& from) {
+    WindowsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WindowsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.WindowsResponse";
+  }
+  protected:
+  explicit WindowsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValuesFieldNumber = 4,
+    kStatFieldNumber = 1,
+    kVersionMajorFieldNumber = 2,
+    kVersionMinorFieldNumber = 3,
+  };
+  // repeated .grpcinterface.StatPoint values = 4;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  ::grpcinterface::StatPoint* mutable_values(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StatPoint >*
+      mutable_values();
+  private:
+  const ::grpcinterface::StatPoint& _internal_values(int index) const;
+  ::grpcinterface::StatPoint* _internal_add_values();
+  public:
+  const ::grpcinterface::StatPoint& values(int index) const;
+  ::grpcinterface::StatPoint* add_values();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StatPoint >&
+      values() const;
+
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // uint64 versionMajor = 2;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // uint64 versionMinor = 3;
+  void clear_versionminor();
+  uint64_t versionminor() const;
+  void set_versionminor(uint64_t value);
+  private:
+  uint64_t _internal_versionminor() const;
+  void _internal_set_versionminor(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.WindowsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StatPoint > values_;
+    ::grpcinterface::Status* stat_;
+    uint64_t versionmajor_;
+    uint64_t versionminor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StreamInfoParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.StreamInfoParams) */ {
+ public:
+  inline StreamInfoParams() : StreamInfoParams(nullptr) {}
+  ~StreamInfoParams() override;
+  explicit PROTOBUF_CONSTEXPR StreamInfoParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StreamInfoParams(const StreamInfoParams& from);
+  StreamInfoParams(StreamInfoParams&& from) noexcept
+    : StreamInfoParams() {
+    *this = ::std::move(from);
+  }
+
+  inline StreamInfoParams& operator=(const StreamInfoParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StreamInfoParams& operator=(StreamInfoParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StreamInfoParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StreamInfoParams* internal_default_instance() {
+    return reinterpret_cast<const StreamInfoParams*>(
+               &_StreamInfoParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(StreamInfoParams& a, StreamInfoParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StreamInfoParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StreamInfoParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StreamInfoParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StreamInfoParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StreamInfoParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StreamInfoParams& from) {
+    StreamInfoParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StreamInfoParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.StreamInfoParams";
+  }
+  protected:
+  explicit StreamInfoParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kOmitVersionFieldNumber = 2,
+    kOmitDescriptorFieldNumber = 3,
+  };
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // bool omitVersion = 2;
+  void clear_omitversion();
+  bool omitversion() const;
+  void set_omitversion(bool value);
+  private:
+  bool _internal_omitversion() const;
+  void _internal_set_omitversion(bool value);
+  public:
+
+  // bool omitDescriptor = 3;
+  void clear_omitdescriptor();
+  bool omitdescriptor() const;
+  void set_omitdescriptor(bool value);
+  private:
+  bool _internal_omitdescriptor() const;
+  void _internal_set_omitdescriptor(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.StreamInfoParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    bool omitversion_;
+    bool omitdescriptor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StreamInfoResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.StreamInfoResponse) */ {
+ public:
+  inline StreamInfoResponse() : StreamInfoResponse(nullptr) {}
+  ~StreamInfoResponse() override;
+  explicit PROTOBUF_CONSTEXPR StreamInfoResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StreamInfoResponse(const StreamInfoResponse& from);
+  StreamInfoResponse(StreamInfoResponse&& from) noexcept
+    : StreamInfoResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline StreamInfoResponse& operator=(const StreamInfoResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StreamInfoResponse& operator=(StreamInfoResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StreamInfoResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StreamInfoResponse* internal_default_instance() {
+    return reinterpret_cast<const StreamInfoResponse*>(
+               &_StreamInfoResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(StreamInfoResponse& a, StreamInfoResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StreamInfoResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StreamInfoResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StreamInfoResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StreamInfoResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StreamInfoResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StreamInfoResponse& from) {
+    StreamInfoResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StreamInfoResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.StreamInfoResponse";
+  }
+  protected:
+  explicit StreamInfoResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatFieldNumber = 1,
+    kStreamDescriptorFieldNumber = 4,
+    kVersionMajorFieldNumber = 2,
+    kVersionMinorFieldNumber = 3,
+  };
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // .grpcinterface.StreamDescriptor streamDescriptor = 4;
+  bool has_streamdescriptor() const;
+  private:
+  bool _internal_has_streamdescriptor() const;
+  public:
+  void clear_streamdescriptor();
+  const ::grpcinterface::StreamDescriptor& streamdescriptor() const;
+  PROTOBUF_NODISCARD ::grpcinterface::StreamDescriptor* release_streamdescriptor();
+  ::grpcinterface::StreamDescriptor* mutable_streamdescriptor();
+  void set_allocated_streamdescriptor(::grpcinterface::StreamDescriptor* streamdescriptor);
+  private:
+  const ::grpcinterface::StreamDescriptor& _internal_streamdescriptor() const;
+  ::grpcinterface::StreamDescriptor* _internal_mutable_streamdescriptor();
+  public:
+  void unsafe_arena_set_allocated_streamdescriptor(
+      ::grpcinterface::StreamDescriptor* streamdescriptor);
+  ::grpcinterface::StreamDescriptor* unsafe_arena_release_streamdescriptor();
+
+  // uint64 versionMajor = 2;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // uint64 versionMinor = 3;
+  void clear_versionminor();
+  uint64_t versionminor() const;
+  void set_versionminor(uint64_t value);
+  private:
+  uint64_t _internal_versionminor() const;
+  void _internal_set_versionminor(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.StreamInfoResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::grpcinterface::Status* stat_;
+    ::grpcinterface::StreamDescriptor* streamdescriptor_;
+    uint64_t versionmajor_;
+    uint64_t versionminor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StreamDescriptor final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.StreamDescriptor) */ {
+ public:
+  inline StreamDescriptor() : StreamDescriptor(nullptr) {}
+  ~StreamDescriptor() override;
+  explicit PROTOBUF_CONSTEXPR StreamDescriptor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StreamDescriptor(const StreamDescriptor& from);
+  StreamDescriptor(StreamDescriptor&& from) noexcept
+    : StreamDescriptor() {
+    *this = ::std::move(from);
+  }
+
+  inline StreamDescriptor& operator=(const StreamDescriptor& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StreamDescriptor& operator=(StreamDescriptor&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StreamDescriptor& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StreamDescriptor* internal_default_instance() {
+    return reinterpret_cast<const StreamDescriptor*>(
+               &_StreamDescriptor_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(StreamDescriptor& a, StreamDescriptor& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StreamDescriptor* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StreamDescriptor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StreamDescriptor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StreamDescriptor>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StreamDescriptor& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StreamDescriptor& from) {
+    StreamDescriptor::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StreamDescriptor* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.StreamDescriptor";
+  }
+  protected:
+  explicit StreamDescriptor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTagsFieldNumber = 3,
+    kAnnotationsFieldNumber = 4,
+    kUuidFieldNumber = 1,
+    kCollectionFieldNumber = 2,
+    kAnnotationVersionFieldNumber = 5,
+  };
+  // repeated .grpcinterface.KeyValue tags = 3;
+  int tags_size() const;
+  private:
+  int _internal_tags_size() const;
+  public:
+  void clear_tags();
+  ::grpcinterface::KeyValue* mutable_tags(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >*
+      mutable_tags();
+  private:
+  const ::grpcinterface::KeyValue& _internal_tags(int index) const;
+  ::grpcinterface::KeyValue* _internal_add_tags();
+  public:
+  const ::grpcinterface::KeyValue& tags(int index) const;
+  ::grpcinterface::KeyValue* add_tags();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >&
+      tags() const;
+
+  // repeated .grpcinterface.KeyValue annotations = 4;
+  int annotations_size() const;
+  private:
+  int _internal_annotations_size() const;
+  public:
+  void clear_annotations();
+  ::grpcinterface::KeyValue* mutable_annotations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >*
+      mutable_annotations();
+  private:
+  const ::grpcinterface::KeyValue& _internal_annotations(int index) const;
+  ::grpcinterface::KeyValue* _internal_add_annotations();
+  public:
+  const ::grpcinterface::KeyValue& annotations(int index) const;
+  ::grpcinterface::KeyValue* add_annotations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >&
+      annotations() const;
+
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // string collection = 2;
+  void clear_collection();
+  const std::string& collection() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_collection(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_collection();
+  PROTOBUF_NODISCARD std::string* release_collection();
+  void set_allocated_collection(std::string* collection);
+  private:
+  const std::string& _internal_collection() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_collection(const std::string& value);
+  std::string* _internal_mutable_collection();
+  public:
+
+  // uint64 annotationVersion = 5;
+  void clear_annotationversion();
+  uint64_t annotationversion() const;
+  void set_annotationversion(uint64_t value);
+  private:
+  uint64_t _internal_annotationversion() const;
+  void _internal_set_annotationversion(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.StreamDescriptor)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue > tags_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue > annotations_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr collection_;
+    uint64_t annotationversion_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetStreamAnnotationsParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.SetStreamAnnotationsParams) */ {
+ public:
+  inline SetStreamAnnotationsParams() : SetStreamAnnotationsParams(nullptr) {}
+  ~SetStreamAnnotationsParams() override;
+  explicit PROTOBUF_CONSTEXPR SetStreamAnnotationsParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetStreamAnnotationsParams(const SetStreamAnnotationsParams& from);
+  SetStreamAnnotationsParams(SetStreamAnnotationsParams&& from) noexcept
+    : SetStreamAnnotationsParams() {
+    *this = ::std::move(from);
+  }
+
+  inline SetStreamAnnotationsParams& operator=(const SetStreamAnnotationsParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetStreamAnnotationsParams& operator=(SetStreamAnnotationsParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetStreamAnnotationsParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetStreamAnnotationsParams* internal_default_instance() {
+    return reinterpret_cast<const SetStreamAnnotationsParams*>(
+               &_SetStreamAnnotationsParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(SetStreamAnnotationsParams& a, SetStreamAnnotationsParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetStreamAnnotationsParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetStreamAnnotationsParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetStreamAnnotationsParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetStreamAnnotationsParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetStreamAnnotationsParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetStreamAnnotationsParams& from) {
+    SetStreamAnnotationsParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetStreamAnnotationsParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.SetStreamAnnotationsParams";
+  }
+  protected:
+  explicit SetStreamAnnotationsParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAnnotationsFieldNumber = 3,
+    kUuidFieldNumber = 1,
+    kExpectedAnnotationVersionFieldNumber = 2,
+  };
+  // repeated .grpcinterface.KeyOptValue annotations = 3;
+  int annotations_size() const;
+  private:
+  int _internal_annotations_size() const;
+  public:
+  void clear_annotations();
+  ::grpcinterface::KeyOptValue* mutable_annotations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >*
+      mutable_annotations();
+  private:
+  const ::grpcinterface::KeyOptValue& _internal_annotations(int index) const;
+  ::grpcinterface::KeyOptValue* _internal_add_annotations();
+  public:
+  const ::grpcinterface::KeyOptValue& annotations(int index) const;
+  ::grpcinterface::KeyOptValue* add_annotations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >&
+      annotations() const;
+
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // uint64 expectedAnnotationVersion = 2;
+  void clear_expectedannotationversion();
+  uint64_t expectedannotationversion() const;
+  void set_expectedannotationversion(uint64_t value);
+  private:
+  uint64_t _internal_expectedannotationversion() const;
+  void _internal_set_expectedannotationversion(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.SetStreamAnnotationsParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue > annotations_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    uint64_t expectedannotationversion_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetStreamAnnotationsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.SetStreamAnnotationsResponse) */ {
+ public:
+  inline SetStreamAnnotationsResponse() : SetStreamAnnotationsResponse(nullptr) {}
+  ~SetStreamAnnotationsResponse() override;
+  explicit PROTOBUF_CONSTEXPR SetStreamAnnotationsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetStreamAnnotationsResponse(const SetStreamAnnotationsResponse& from);
+  SetStreamAnnotationsResponse(SetStreamAnnotationsResponse&& from) noexcept
+    : SetStreamAnnotationsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SetStreamAnnotationsResponse& operator=(const SetStreamAnnotationsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetStreamAnnotationsResponse& operator=(SetStreamAnnotationsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetStreamAnnotationsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetStreamAnnotationsResponse* internal_default_instance() {
+    return reinterpret_cast<const SetStreamAnnotationsResponse*>(
+               &_SetStreamAnnotationsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(SetStreamAnnotationsResponse& a, SetStreamAnnotationsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetStreamAnnotationsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetStreamAnnotationsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetStreamAnnotationsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetStreamAnnotationsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetStreamAnnotationsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetStreamAnnotationsResponse& from) {
+    SetStreamAnnotationsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetStreamAnnotationsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.SetStreamAnnotationsResponse";
+  }
+  protected:
+  explicit SetStreamAnnotationsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatFieldNumber = 1,
+  };
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.SetStreamAnnotationsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::grpcinterface::Status* stat_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CreateParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.CreateParams) */ {
+ public:
+  inline CreateParams() : CreateParams(nullptr) {}
+  ~CreateParams() override;
+  explicit PROTOBUF_CONSTEXPR CreateParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CreateParams(const CreateParams& from);
+  CreateParams(CreateParams&& from) noexcept
+    : CreateParams() {
+    *this = ::std::move(from);
+  }
+
+  inline CreateParams& operator=(const CreateParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CreateParams& operator=(CreateParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreateParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateParams* internal_default_instance() {
+    return reinterpret_cast<const CreateParams*>(
+               &_CreateParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(CreateParams& a, CreateParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CreateParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreateParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CreateParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateParams& from) {
+    CreateParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CreateParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.CreateParams";
+  }
+  protected:
+  explicit CreateParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTagsFieldNumber = 3,
+    kAnnotationsFieldNumber = 4,
+    kUuidFieldNumber = 1,
+    kCollectionFieldNumber = 2,
+  };
+  // repeated .grpcinterface.KeyValue tags = 3;
+  int tags_size() const;
+  private:
+  int _internal_tags_size() const;
+  public:
+  void clear_tags();
+  ::grpcinterface::KeyValue* mutable_tags(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >*
+      mutable_tags();
+  private:
+  const ::grpcinterface::KeyValue& _internal_tags(int index) const;
+  ::grpcinterface::KeyValue* _internal_add_tags();
+  public:
+  const ::grpcinterface::KeyValue& tags(int index) const;
+  ::grpcinterface::KeyValue* add_tags();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >&
+      tags() const;
+
+  // repeated .grpcinterface.KeyValue annotations = 4;
+  int annotations_size() const;
+  private:
+  int _internal_annotations_size() const;
+  public:
+  void clear_annotations();
+  ::grpcinterface::KeyValue* mutable_annotations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >*
+      mutable_annotations();
+  private:
+  const ::grpcinterface::KeyValue& _internal_annotations(int index) const;
+  ::grpcinterface::KeyValue* _internal_add_annotations();
+  public:
+  const ::grpcinterface::KeyValue& annotations(int index) const;
+  ::grpcinterface::KeyValue* add_annotations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >&
+      annotations() const;
+
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // string collection = 2;
+  void clear_collection();
+  const std::string& collection() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_collection(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_collection();
+  PROTOBUF_NODISCARD std::string* release_collection();
+  void set_allocated_collection(std::string* collection);
+  private:
+  const std::string& _internal_collection() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_collection(const std::string& value);
+  std::string* _internal_mutable_collection();
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.CreateParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue > tags_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue > annotations_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr collection_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CreateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.CreateResponse) */ {
+ public:
+  inline CreateResponse() : CreateResponse(nullptr) {}
+  ~CreateResponse() override;
+  explicit PROTOBUF_CONSTEXPR CreateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CreateResponse(const CreateResponse& from);
+  CreateResponse(CreateResponse&& from) noexcept
+    : CreateResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CreateResponse& operator=(const CreateResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CreateResponse& operator=(CreateResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreateResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateResponse* internal_default_instance() {
+    return reinterpret_cast<const CreateResponse*>(
+               &_CreateResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(CreateResponse& a, CreateResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CreateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CreateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateResponse& from) {
+    CreateResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CreateResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.CreateResponse";
+  }
+  protected:
+  explicit CreateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatFieldNumber = 1,
+  };
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.CreateResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::grpcinterface::Status* stat_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListCollectionsParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.ListCollectionsParams) */ {
+ public:
+  inline ListCollectionsParams() : ListCollectionsParams(nullptr) {}
+  ~ListCollectionsParams() override;
+  explicit PROTOBUF_CONSTEXPR ListCollectionsParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListCollectionsParams(const ListCollectionsParams& from);
+  ListCollectionsParams(ListCollectionsParams&& from) noexcept
+    : ListCollectionsParams() {
+    *this = ::std::move(from);
+  }
+
+  inline ListCollectionsParams& operator=(const ListCollectionsParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListCollectionsParams& operator=(ListCollectionsParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListCollectionsParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListCollectionsParams* internal_default_instance() {
+    return reinterpret_cast<const ListCollectionsParams*>(
+               &_ListCollectionsParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ListCollectionsParams& a, ListCollectionsParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListCollectionsParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListCollectionsParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListCollectionsParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListCollectionsParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListCollectionsParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListCollectionsParams& from) {
+    ListCollectionsParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListCollectionsParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.ListCollectionsParams";
+  }
+  protected:
+  explicit ListCollectionsParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrefixFieldNumber = 1,
+    kStartWithFieldNumber = 2,
+    kLimitFieldNumber = 3,
+  };
+  // string prefix = 1;
+  void clear_prefix();
+  const std::string& prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
+  private:
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
+  public:
+
+  // string startWith = 2;
+  void clear_startwith();
+  const std::string& startwith() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_startwith(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_startwith();
+  PROTOBUF_NODISCARD std::string* release_startwith();
+  void set_allocated_startwith(std::string* startwith);
+  private:
+  const std::string& _internal_startwith() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_startwith(const std::string& value);
+  std::string* _internal_mutable_startwith();
+  public:
+
+  // uint64 limit = 3;
+  void clear_limit();
+  uint64_t limit() const;
+  void set_limit(uint64_t value);
+  private:
+  uint64_t _internal_limit() const;
+  void _internal_set_limit(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.ListCollectionsParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr startwith_;
+    uint64_t limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListCollectionsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.ListCollectionsResponse) */ {
+ public:
+  inline ListCollectionsResponse() : ListCollectionsResponse(nullptr) {}
+  ~ListCollectionsResponse() override;
+  explicit PROTOBUF_CONSTEXPR ListCollectionsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListCollectionsResponse(const ListCollectionsResponse& from);
+  ListCollectionsResponse(ListCollectionsResponse&& from) noexcept
+    : ListCollectionsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ListCollectionsResponse& operator=(const ListCollectionsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListCollectionsResponse& operator=(ListCollectionsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListCollectionsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListCollectionsResponse* internal_default_instance() {
+    return reinterpret_cast<const ListCollectionsResponse*>(
+               &_ListCollectionsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ListCollectionsResponse& a, ListCollectionsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListCollectionsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListCollectionsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListCollectionsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListCollectionsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListCollectionsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListCollectionsResponse& from) {
+    ListCollectionsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListCollectionsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.ListCollectionsResponse";
+  }
+  protected:
+  explicit ListCollectionsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCollectionsFieldNumber = 2,
+    kStatFieldNumber = 1,
+  };
+  // repeated string collections = 2;
+  int collections_size() const;
+  private:
+  int _internal_collections_size() const;
+  public:
+  void clear_collections();
+  const std::string& collections(int index) const;
+  std::string* mutable_collections(int index);
+  void set_collections(int index, const std::string& value);
+  void set_collections(int index, std::string&& value);
+  void set_collections(int index, const char* value);
+  void set_collections(int index, const char* value, size_t size);
+  std::string* add_collections();
+  void add_collections(const std::string& value);
+  void add_collections(std::string&& value);
+  void add_collections(const char* value);
+  void add_collections(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& collections() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_collections();
+  private:
+  const std::string& _internal_collections(int index) const;
+  std::string* _internal_add_collections();
+  public:
+
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.ListCollectionsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> collections_;
+    ::grpcinterface::Status* stat_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LookupStreamsParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.LookupStreamsParams) */ {
+ public:
+  inline LookupStreamsParams() : LookupStreamsParams(nullptr) {}
+  ~LookupStreamsParams() override;
+  explicit PROTOBUF_CONSTEXPR LookupStreamsParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LookupStreamsParams(const LookupStreamsParams& from);
+  LookupStreamsParams(LookupStreamsParams&& from) noexcept
+    : LookupStreamsParams() {
+    *this = ::std::move(from);
+  }
+
+  inline LookupStreamsParams& operator=(const LookupStreamsParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LookupStreamsParams& operator=(LookupStreamsParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LookupStreamsParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LookupStreamsParams* internal_default_instance() {
+    return reinterpret_cast<const LookupStreamsParams*>(
+               &_LookupStreamsParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(LookupStreamsParams& a, LookupStreamsParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LookupStreamsParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LookupStreamsParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LookupStreamsParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LookupStreamsParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LookupStreamsParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LookupStreamsParams& from) {
+    LookupStreamsParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LookupStreamsParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.LookupStreamsParams";
+  }
+  protected:
+  explicit LookupStreamsParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTagsFieldNumber = 3,
+    kAnnotationsFieldNumber = 4,
+    kCollectionFieldNumber = 1,
+    kIsCollectionPrefixFieldNumber = 2,
+  };
+  // repeated .grpcinterface.KeyOptValue tags = 3;
+  int tags_size() const;
+  private:
+  int _internal_tags_size() const;
+  public:
+  void clear_tags();
+  ::grpcinterface::KeyOptValue* mutable_tags(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >*
+      mutable_tags();
+  private:
+  const ::grpcinterface::KeyOptValue& _internal_tags(int index) const;
+  ::grpcinterface::KeyOptValue* _internal_add_tags();
+  public:
+  const ::grpcinterface::KeyOptValue& tags(int index) const;
+  ::grpcinterface::KeyOptValue* add_tags();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >&
+      tags() const;
+
+  // repeated .grpcinterface.KeyOptValue annotations = 4;
+  int annotations_size() const;
+  private:
+  int _internal_annotations_size() const;
+  public:
+  void clear_annotations();
+  ::grpcinterface::KeyOptValue* mutable_annotations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >*
+      mutable_annotations();
+  private:
+  const ::grpcinterface::KeyOptValue& _internal_annotations(int index) const;
+  ::grpcinterface::KeyOptValue* _internal_add_annotations();
+  public:
+  const ::grpcinterface::KeyOptValue& annotations(int index) const;
+  ::grpcinterface::KeyOptValue* add_annotations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >&
+      annotations() const;
+
+  // string collection = 1;
+  void clear_collection();
+  const std::string& collection() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_collection(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_collection();
+  PROTOBUF_NODISCARD std::string* release_collection();
+  void set_allocated_collection(std::string* collection);
+  private:
+  const std::string& _internal_collection() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_collection(const std::string& value);
+  std::string* _internal_mutable_collection();
+  public:
+
+  // bool isCollectionPrefix = 2;
+  void clear_iscollectionprefix();
+  bool iscollectionprefix() const;
+  void set_iscollectionprefix(bool value);
+  private:
+  bool _internal_iscollectionprefix() const;
+  void _internal_set_iscollectionprefix(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.LookupStreamsParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue > tags_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue > annotations_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr collection_;
+    bool iscollectionprefix_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LookupStreamsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.LookupStreamsResponse) */ {
+ public:
+  inline LookupStreamsResponse() : LookupStreamsResponse(nullptr) {}
+  ~LookupStreamsResponse() override;
+  explicit PROTOBUF_CONSTEXPR LookupStreamsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LookupStreamsResponse(const LookupStreamsResponse& from);
+  LookupStreamsResponse(LookupStreamsResponse&& from) noexcept
+    : LookupStreamsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline LookupStreamsResponse& operator=(const LookupStreamsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LookupStreamsResponse& operator=(LookupStreamsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LookupStreamsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LookupStreamsResponse* internal_default_instance() {
+    return reinterpret_cast<const LookupStreamsResponse*>(
+               &_LookupStreamsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(LookupStreamsResponse& a, LookupStreamsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LookupStreamsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LookupStreamsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LookupStreamsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LookupStreamsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LookupStreamsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LookupStreamsResponse& from) {
+    LookupStreamsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LookupStreamsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.LookupStreamsResponse";
+  }
+  protected:
+  explicit LookupStreamsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValuesFieldNumber = 2,
+    kStatFieldNumber = 1,
+  };
+  // repeated .grpcinterface.StreamDescriptor values = 2;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  ::grpcinterface::StreamDescriptor* mutable_values(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StreamDescriptor >*
+      mutable_values();
+  private:
+  const ::grpcinterface::StreamDescriptor& _internal_values(int index) const;
+  ::grpcinterface::StreamDescriptor* _internal_add_values();
+  public:
+  const ::grpcinterface::StreamDescriptor& values(int index) const;
+  ::grpcinterface::StreamDescriptor* add_values();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StreamDescriptor >&
+      values() const;
+
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.LookupStreamsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StreamDescriptor > values_;
+    ::grpcinterface::Status* stat_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NearestParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.NearestParams) */ {
+ public:
+  inline NearestParams() : NearestParams(nullptr) {}
+  ~NearestParams() override;
+  explicit PROTOBUF_CONSTEXPR NearestParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NearestParams(const NearestParams& from);
+  NearestParams(NearestParams&& from) noexcept
+    : NearestParams() {
+    *this = ::std::move(from);
+  }
+
+  inline NearestParams& operator=(const NearestParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NearestParams& operator=(NearestParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NearestParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NearestParams* internal_default_instance() {
+    return reinterpret_cast<const NearestParams*>(
+               &_NearestParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(NearestParams& a, NearestParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NearestParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NearestParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NearestParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NearestParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NearestParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NearestParams& from) {
+    NearestParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NearestParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.NearestParams";
+  }
+  protected:
+  explicit NearestParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kTimeFieldNumber = 2,
+    kVersionMajorFieldNumber = 3,
+    kBackwardFieldNumber = 4,
+  };
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // sfixed64 time = 2;
+  void clear_time();
+  int64_t time() const;
+  void set_time(int64_t value);
+  private:
+  int64_t _internal_time() const;
+  void _internal_set_time(int64_t value);
+  public:
+
+  // uint64 versionMajor = 3;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // bool backward = 4;
+  void clear_backward();
+  bool backward() const;
+  void set_backward(bool value);
+  private:
+  bool _internal_backward() const;
+  void _internal_set_backward(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.NearestParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    int64_t time_;
+    uint64_t versionmajor_;
+    bool backward_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NearestResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.NearestResponse) */ {
+ public:
+  inline NearestResponse() : NearestResponse(nullptr) {}
+  ~NearestResponse() override;
+  explicit PROTOBUF_CONSTEXPR NearestResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NearestResponse(const NearestResponse& from);
+  NearestResponse(NearestResponse&& from) noexcept
+    : NearestResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline NearestResponse& operator=(const NearestResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NearestResponse& operator=(NearestResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NearestResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NearestResponse* internal_default_instance() {
+    return reinterpret_cast<const NearestResponse*>(
+               &_NearestResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(NearestResponse& a, NearestResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NearestResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NearestResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NearestResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NearestResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NearestResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NearestResponse& from) {
+    NearestResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NearestResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.NearestResponse";
+  }
+  protected:
+  explicit NearestResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatFieldNumber = 1,
+    kValueFieldNumber = 4,
+    kVersionMajorFieldNumber = 2,
+    kVersionMinorFieldNumber = 3,
+  };
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // .grpcinterface.RawPoint value = 4;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const ::grpcinterface::RawPoint& value() const;
+  PROTOBUF_NODISCARD ::grpcinterface::RawPoint* release_value();
+  ::grpcinterface::RawPoint* mutable_value();
+  void set_allocated_value(::grpcinterface::RawPoint* value);
+  private:
+  const ::grpcinterface::RawPoint& _internal_value() const;
+  ::grpcinterface::RawPoint* _internal_mutable_value();
+  public:
+  void unsafe_arena_set_allocated_value(
+      ::grpcinterface::RawPoint* value);
+  ::grpcinterface::RawPoint* unsafe_arena_release_value();
+
+  // uint64 versionMajor = 2;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // uint64 versionMinor = 3;
+  void clear_versionminor();
+  uint64_t versionminor() const;
+  void set_versionminor(uint64_t value);
+  private:
+  uint64_t _internal_versionminor() const;
+  void _internal_set_versionminor(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.NearestResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::grpcinterface::Status* stat_;
+    ::grpcinterface::RawPoint* value_;
+    uint64_t versionmajor_;
+    uint64_t versionminor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangesParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.ChangesParams) */ {
+ public:
+  inline ChangesParams() : ChangesParams(nullptr) {}
+  ~ChangesParams() override;
+  explicit PROTOBUF_CONSTEXPR ChangesParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangesParams(const ChangesParams& from);
+  ChangesParams(ChangesParams&& from) noexcept
+    : ChangesParams() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangesParams& operator=(const ChangesParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangesParams& operator=(ChangesParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangesParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangesParams* internal_default_instance() {
+    return reinterpret_cast<const ChangesParams*>(
+               &_ChangesParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(ChangesParams& a, ChangesParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangesParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangesParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangesParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangesParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangesParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangesParams& from) {
+    ChangesParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangesParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.ChangesParams";
+  }
+  protected:
+  explicit ChangesParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kFromMajorFieldNumber = 2,
+    kToMajorFieldNumber = 3,
+    kResolutionFieldNumber = 4,
+  };
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // uint64 fromMajor = 2;
+  void clear_frommajor();
+  uint64_t frommajor() const;
+  void set_frommajor(uint64_t value);
+  private:
+  uint64_t _internal_frommajor() const;
+  void _internal_set_frommajor(uint64_t value);
+  public:
+
+  // uint64 toMajor = 3;
+  void clear_tomajor();
+  uint64_t tomajor() const;
+  void set_tomajor(uint64_t value);
+  private:
+  uint64_t _internal_tomajor() const;
+  void _internal_set_tomajor(uint64_t value);
+  public:
+
+  // uint32 resolution = 4;
+  void clear_resolution();
+  uint32_t resolution() const;
+  void set_resolution(uint32_t value);
+  private:
+  uint32_t _internal_resolution() const;
+  void _internal_set_resolution(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.ChangesParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    uint64_t frommajor_;
+    uint64_t tomajor_;
+    uint32_t resolution_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangesResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.ChangesResponse) */ {
+ public:
+  inline ChangesResponse() : ChangesResponse(nullptr) {}
+  ~ChangesResponse() override;
+  explicit PROTOBUF_CONSTEXPR ChangesResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangesResponse(const ChangesResponse& from);
+  ChangesResponse(ChangesResponse&& from) noexcept
+    : ChangesResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangesResponse& operator=(const ChangesResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangesResponse& operator=(ChangesResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangesResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangesResponse* internal_default_instance() {
+    return reinterpret_cast<const ChangesResponse*>(
+               &_ChangesResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(ChangesResponse& a, ChangesResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangesResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangesResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangesResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangesResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangesResponse& from) {
+    ChangesResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangesResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.ChangesResponse";
+  }
+  protected:
+  explicit ChangesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValuesFieldNumber = 4,
+    kStatFieldNumber = 1,
+    kVersionMajorFieldNumber = 2,
+    kVersionMinorFieldNumber = 3,
+  };
+  // repeated .grpcinterface.ChangedRange values = 4;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  ::grpcinterface::ChangedRange* mutable_values(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::ChangedRange >*
+      mutable_values();
+  private:
+  const ::grpcinterface::ChangedRange& _internal_values(int index) const;
+  ::grpcinterface::ChangedRange* _internal_add_values();
+  public:
+  const ::grpcinterface::ChangedRange& values(int index) const;
+  ::grpcinterface::ChangedRange* add_values();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::ChangedRange >&
+      values() const;
+
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // uint64 versionMajor = 2;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // uint64 versionMinor = 3;
+  void clear_versionminor();
+  uint64_t versionminor() const;
+  void set_versionminor(uint64_t value);
+  private:
+  uint64_t _internal_versionminor() const;
+  void _internal_set_versionminor(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.ChangesResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::ChangedRange > values_;
+    ::grpcinterface::Status* stat_;
+    uint64_t versionmajor_;
+    uint64_t versionminor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InsertParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.InsertParams) */ {
+ public:
+  inline InsertParams() : InsertParams(nullptr) {}
+  ~InsertParams() override;
+  explicit PROTOBUF_CONSTEXPR InsertParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InsertParams(const InsertParams& from);
+  InsertParams(InsertParams&& from) noexcept
+    : InsertParams() {
+    *this = ::std::move(from);
+  }
+
+  inline InsertParams& operator=(const InsertParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InsertParams& operator=(InsertParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InsertParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InsertParams* internal_default_instance() {
+    return reinterpret_cast<const InsertParams*>(
+               &_InsertParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(InsertParams& a, InsertParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InsertParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InsertParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InsertParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InsertParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InsertParams& from) {
+    InsertParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InsertParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.InsertParams";
+  }
+  protected:
+  explicit InsertParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValuesFieldNumber = 3,
+    kUuidFieldNumber = 1,
+    kSyncFieldNumber = 2,
+  };
+  // repeated .grpcinterface.RawPoint values = 3;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  ::grpcinterface::RawPoint* mutable_values(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::RawPoint >*
+      mutable_values();
+  private:
+  const ::grpcinterface::RawPoint& _internal_values(int index) const;
+  ::grpcinterface::RawPoint* _internal_add_values();
+  public:
+  const ::grpcinterface::RawPoint& values(int index) const;
+  ::grpcinterface::RawPoint* add_values();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::RawPoint >&
+      values() const;
+
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // bool sync = 2;
+  void clear_sync();
+  bool sync() const;
+  void set_sync(bool value);
+  private:
+  bool _internal_sync() const;
+  void _internal_set_sync(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.InsertParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::RawPoint > values_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    bool sync_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InsertResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.InsertResponse) */ {
+ public:
+  inline InsertResponse() : InsertResponse(nullptr) {}
+  ~InsertResponse() override;
+  explicit PROTOBUF_CONSTEXPR InsertResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InsertResponse(const InsertResponse& from);
+  InsertResponse(InsertResponse&& from) noexcept
+    : InsertResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline InsertResponse& operator=(const InsertResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InsertResponse& operator=(InsertResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InsertResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InsertResponse* internal_default_instance() {
+    return reinterpret_cast<const InsertResponse*>(
+               &_InsertResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(InsertResponse& a, InsertResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InsertResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InsertResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InsertResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InsertResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InsertResponse& from) {
+    InsertResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InsertResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.InsertResponse";
+  }
+  protected:
+  explicit InsertResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatFieldNumber = 1,
+    kVersionMajorFieldNumber = 2,
+    kVersionMinorFieldNumber = 3,
+  };
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // uint64 versionMajor = 2;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // uint64 versionMinor = 3;
+  void clear_versionminor();
+  uint64_t versionminor() const;
+  void set_versionminor(uint64_t value);
+  private:
+  uint64_t _internal_versionminor() const;
+  void _internal_set_versionminor(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.InsertResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::grpcinterface::Status* stat_;
+    uint64_t versionmajor_;
+    uint64_t versionminor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeleteParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.DeleteParams) */ {
+ public:
+  inline DeleteParams() : DeleteParams(nullptr) {}
+  ~DeleteParams() override;
+  explicit PROTOBUF_CONSTEXPR DeleteParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeleteParams(const DeleteParams& from);
+  DeleteParams(DeleteParams&& from) noexcept
+    : DeleteParams() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteParams& operator=(const DeleteParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteParams& operator=(DeleteParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeleteParams* internal_default_instance() {
+    return reinterpret_cast<const DeleteParams*>(
+               &_DeleteParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(DeleteParams& a, DeleteParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeleteParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeleteParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeleteParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteParams& from) {
+    DeleteParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeleteParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.DeleteParams";
+  }
+  protected:
+  explicit DeleteParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kStartFieldNumber = 2,
+    kEndFieldNumber = 3,
+  };
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // sfixed64 start = 2;
+  void clear_start();
+  int64_t start() const;
+  void set_start(int64_t value);
+  private:
+  int64_t _internal_start() const;
+  void _internal_set_start(int64_t value);
+  public:
+
+  // sfixed64 end = 3;
+  void clear_end();
+  int64_t end() const;
+  void set_end(int64_t value);
+  private:
+  int64_t _internal_end() const;
+  void _internal_set_end(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.DeleteParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    int64_t start_;
+    int64_t end_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeleteResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.DeleteResponse) */ {
+ public:
+  inline DeleteResponse() : DeleteResponse(nullptr) {}
+  ~DeleteResponse() override;
+  explicit PROTOBUF_CONSTEXPR DeleteResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeleteResponse(const DeleteResponse& from);
+  DeleteResponse(DeleteResponse&& from) noexcept
+    : DeleteResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteResponse& operator=(const DeleteResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteResponse& operator=(DeleteResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeleteResponse* internal_default_instance() {
+    return reinterpret_cast<const DeleteResponse*>(
+               &_DeleteResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(DeleteResponse& a, DeleteResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeleteResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeleteResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeleteResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteResponse& from) {
+    DeleteResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeleteResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.DeleteResponse";
+  }
+  protected:
+  explicit DeleteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatFieldNumber = 1,
+    kVersionMajorFieldNumber = 2,
+    kVersionMinorFieldNumber = 3,
+  };
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // uint64 versionMajor = 2;
+  void clear_versionmajor();
+  uint64_t versionmajor() const;
+  void set_versionmajor(uint64_t value);
+  private:
+  uint64_t _internal_versionmajor() const;
+  void _internal_set_versionmajor(uint64_t value);
+  public:
+
+  // uint64 versionMinor = 3;
+  void clear_versionminor();
+  uint64_t versionminor() const;
+  void set_versionminor(uint64_t value);
+  private:
+  uint64_t _internal_versionminor() const;
+  void _internal_set_versionminor(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.DeleteResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::grpcinterface::Status* stat_;
+    uint64_t versionmajor_;
+    uint64_t versionminor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InfoParams final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:grpcinterface.InfoParams) */ {
+ public:
+  inline InfoParams() : InfoParams(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR InfoParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InfoParams(const InfoParams& from);
+  InfoParams(InfoParams&& from) noexcept
+    : InfoParams() {
+    *this = ::std::move(from);
+  }
+
+  inline InfoParams& operator=(const InfoParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InfoParams& operator=(InfoParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InfoParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InfoParams* internal_default_instance() {
+    return reinterpret_cast<const InfoParams*>(
+               &_InfoParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(InfoParams& a, InfoParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InfoParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InfoParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InfoParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InfoParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const InfoParams& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const InfoParams& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.InfoParams";
+  }
+  protected:
+  explicit InfoParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.InfoParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InfoResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.InfoResponse) */ {
+ public:
+  inline InfoResponse() : InfoResponse(nullptr) {}
+  ~InfoResponse() override;
+  explicit PROTOBUF_CONSTEXPR InfoResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InfoResponse(const InfoResponse& from);
+  InfoResponse(InfoResponse&& from) noexcept
+    : InfoResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline InfoResponse& operator=(const InfoResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InfoResponse& operator=(InfoResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InfoResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InfoResponse* internal_default_instance() {
+    return reinterpret_cast<const InfoResponse*>(
+               &_InfoResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(InfoResponse& a, InfoResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InfoResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InfoResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InfoResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InfoResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InfoResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InfoResponse& from) {
+    InfoResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InfoResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.InfoResponse";
+  }
+  protected:
+  explicit InfoResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBuildFieldNumber = 5,
+    kStatFieldNumber = 1,
+    kMashFieldNumber = 2,
+    kMajorVersionFieldNumber = 3,
+    kMinorVersionFieldNumber = 4,
+  };
+  // string build = 5;
+  void clear_build();
+  const std::string& build() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_build(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_build();
+  PROTOBUF_NODISCARD std::string* release_build();
+  void set_allocated_build(std::string* build);
+  private:
+  const std::string& _internal_build() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_build(const std::string& value);
+  std::string* _internal_mutable_build();
+  public:
+
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // .grpcinterface.Mash mash = 2;
+  bool has_mash() const;
+  private:
+  bool _internal_has_mash() const;
+  public:
+  void clear_mash();
+  const ::grpcinterface::Mash& mash() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Mash* release_mash();
+  ::grpcinterface::Mash* mutable_mash();
+  void set_allocated_mash(::grpcinterface::Mash* mash);
+  private:
+  const ::grpcinterface::Mash& _internal_mash() const;
+  ::grpcinterface::Mash* _internal_mutable_mash();
+  public:
+  void unsafe_arena_set_allocated_mash(
+      ::grpcinterface::Mash* mash);
+  ::grpcinterface::Mash* unsafe_arena_release_mash();
+
+  // uint32 majorVersion = 3;
+  void clear_majorversion();
+  uint32_t majorversion() const;
+  void set_majorversion(uint32_t value);
+  private:
+  uint32_t _internal_majorversion() const;
+  void _internal_set_majorversion(uint32_t value);
+  public:
+
+  // uint32 minorVersion = 4;
+  void clear_minorversion();
+  uint32_t minorversion() const;
+  void set_minorversion(uint32_t value);
+  private:
+  uint32_t _internal_minorversion() const;
+  void _internal_set_minorversion(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.InfoResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr build_;
+    ::grpcinterface::Status* stat_;
+    ::grpcinterface::Mash* mash_;
+    uint32_t majorversion_;
+    uint32_t minorversion_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FaultInjectParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.FaultInjectParams) */ {
+ public:
+  inline FaultInjectParams() : FaultInjectParams(nullptr) {}
+  ~FaultInjectParams() override;
+  explicit PROTOBUF_CONSTEXPR FaultInjectParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FaultInjectParams(const FaultInjectParams& from);
+  FaultInjectParams(FaultInjectParams&& from) noexcept
+    : FaultInjectParams() {
+    *this = ::std::move(from);
+  }
+
+  inline FaultInjectParams& operator=(const FaultInjectParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FaultInjectParams& operator=(FaultInjectParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FaultInjectParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FaultInjectParams* internal_default_instance() {
+    return reinterpret_cast<const FaultInjectParams*>(
+               &_FaultInjectParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(FaultInjectParams& a, FaultInjectParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FaultInjectParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FaultInjectParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FaultInjectParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FaultInjectParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FaultInjectParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FaultInjectParams& from) {
+    FaultInjectParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FaultInjectParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.FaultInjectParams";
+  }
+  protected:
+  explicit FaultInjectParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParamsFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
+  // bytes params = 2;
+  void clear_params();
+  const std::string& params() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_params(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_params();
+  PROTOBUF_NODISCARD std::string* release_params();
+  void set_allocated_params(std::string* params);
+  private:
+  const std::string& _internal_params() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_params(const std::string& value);
+  std::string* _internal_mutable_params();
+  public:
+
+  // uint64 type = 1;
+  void clear_type();
+  uint64_t type() const;
+  void set_type(uint64_t value);
+  private:
+  uint64_t _internal_type() const;
+  void _internal_set_type(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.FaultInjectParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr params_;
+    uint64_t type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FaultInjectResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.FaultInjectResponse) */ {
+ public:
+  inline FaultInjectResponse() : FaultInjectResponse(nullptr) {}
+  ~FaultInjectResponse() override;
+  explicit PROTOBUF_CONSTEXPR FaultInjectResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FaultInjectResponse(const FaultInjectResponse& from);
+  FaultInjectResponse(FaultInjectResponse&& from) noexcept
+    : FaultInjectResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline FaultInjectResponse& operator=(const FaultInjectResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FaultInjectResponse& operator=(FaultInjectResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FaultInjectResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FaultInjectResponse* internal_default_instance() {
+    return reinterpret_cast<const FaultInjectResponse*>(
+               &_FaultInjectResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(FaultInjectResponse& a, FaultInjectResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FaultInjectResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FaultInjectResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FaultInjectResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FaultInjectResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FaultInjectResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FaultInjectResponse& from) {
+    FaultInjectResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FaultInjectResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.FaultInjectResponse";
+  }
+  protected:
+  explicit FaultInjectResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRvFieldNumber = 2,
+    kStatFieldNumber = 1,
+  };
+  // bytes rv = 2;
+  void clear_rv();
+  const std::string& rv() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rv(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rv();
+  PROTOBUF_NODISCARD std::string* release_rv();
+  void set_allocated_rv(std::string* rv);
+  private:
+  const std::string& _internal_rv() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rv(const std::string& value);
+  std::string* _internal_mutable_rv();
+  public:
+
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.FaultInjectResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rv_;
+    ::grpcinterface::Status* stat_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FlushParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.FlushParams) */ {
+ public:
+  inline FlushParams() : FlushParams(nullptr) {}
+  ~FlushParams() override;
+  explicit PROTOBUF_CONSTEXPR FlushParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FlushParams(const FlushParams& from);
+  FlushParams(FlushParams&& from) noexcept
+    : FlushParams() {
+    *this = ::std::move(from);
+  }
+
+  inline FlushParams& operator=(const FlushParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FlushParams& operator=(FlushParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FlushParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FlushParams* internal_default_instance() {
+    return reinterpret_cast<const FlushParams*>(
+               &_FlushParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(FlushParams& a, FlushParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FlushParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FlushParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FlushParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FlushParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FlushParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FlushParams& from) {
+    FlushParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FlushParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.FlushParams";
+  }
+  protected:
+  explicit FlushParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+  };
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.FlushParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FlushResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.FlushResponse) */ {
+ public:
+  inline FlushResponse() : FlushResponse(nullptr) {}
+  ~FlushResponse() override;
+  explicit PROTOBUF_CONSTEXPR FlushResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FlushResponse(const FlushResponse& from);
+  FlushResponse(FlushResponse&& from) noexcept
+    : FlushResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline FlushResponse& operator=(const FlushResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FlushResponse& operator=(FlushResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FlushResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FlushResponse* internal_default_instance() {
+    return reinterpret_cast<const FlushResponse*>(
+               &_FlushResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(FlushResponse& a, FlushResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FlushResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FlushResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FlushResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FlushResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FlushResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FlushResponse& from) {
+    FlushResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FlushResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.FlushResponse";
+  }
+  protected:
+  explicit FlushResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatFieldNumber = 1,
+  };
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.FlushResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::grpcinterface::Status* stat_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ObliterateParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.ObliterateParams) */ {
+ public:
+  inline ObliterateParams() : ObliterateParams(nullptr) {}
+  ~ObliterateParams() override;
+  explicit PROTOBUF_CONSTEXPR ObliterateParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ObliterateParams(const ObliterateParams& from);
+  ObliterateParams(ObliterateParams&& from) noexcept
+    : ObliterateParams() {
+    *this = ::std::move(from);
+  }
+
+  inline ObliterateParams& operator=(const ObliterateParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ObliterateParams& operator=(ObliterateParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ObliterateParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ObliterateParams* internal_default_instance() {
+    return reinterpret_cast<const ObliterateParams*>(
+               &_ObliterateParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(ObliterateParams& a, ObliterateParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ObliterateParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ObliterateParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ObliterateParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ObliterateParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ObliterateParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ObliterateParams& from) {
+    ObliterateParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ObliterateParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.ObliterateParams";
+  }
+  protected:
+  explicit ObliterateParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+  };
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.ObliterateParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ObliterateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.ObliterateResponse) */ {
+ public:
+  inline ObliterateResponse() : ObliterateResponse(nullptr) {}
+  ~ObliterateResponse() override;
+  explicit PROTOBUF_CONSTEXPR ObliterateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ObliterateResponse(const ObliterateResponse& from);
+  ObliterateResponse(ObliterateResponse&& from) noexcept
+    : ObliterateResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ObliterateResponse& operator=(const ObliterateResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ObliterateResponse& operator=(ObliterateResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ObliterateResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ObliterateResponse* internal_default_instance() {
+    return reinterpret_cast<const ObliterateResponse*>(
+               &_ObliterateResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(ObliterateResponse& a, ObliterateResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ObliterateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ObliterateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ObliterateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ObliterateResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ObliterateResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ObliterateResponse& from) {
+    ObliterateResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ObliterateResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.ObliterateResponse";
+  }
+  protected:
+  explicit ObliterateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatFieldNumber = 1,
+  };
+  // .grpcinterface.Status stat = 1;
+  bool has_stat() const;
+  private:
+  bool _internal_has_stat() const;
+  public:
+  void clear_stat();
+  const ::grpcinterface::Status& stat() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Status* release_stat();
+  ::grpcinterface::Status* mutable_stat();
+  void set_allocated_stat(::grpcinterface::Status* stat);
+  private:
+  const ::grpcinterface::Status& _internal_stat() const;
+  ::grpcinterface::Status* _internal_mutable_stat();
+  public:
+  void unsafe_arena_set_allocated_stat(
+      ::grpcinterface::Status* stat);
+  ::grpcinterface::Status* unsafe_arena_release_stat();
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.ObliterateResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::grpcinterface::Status* stat_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RawPoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.RawPoint) */ {
+ public:
+  inline RawPoint() : RawPoint(nullptr) {}
+  ~RawPoint() override;
+  explicit PROTOBUF_CONSTEXPR RawPoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RawPoint(const RawPoint& from);
+  RawPoint(RawPoint&& from) noexcept
+    : RawPoint() {
+    *this = ::std::move(from);
+  }
+
+  inline RawPoint& operator=(const RawPoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RawPoint& operator=(RawPoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RawPoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RawPoint* internal_default_instance() {
+    return reinterpret_cast<const RawPoint*>(
+               &_RawPoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(RawPoint& a, RawPoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RawPoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RawPoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RawPoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RawPoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RawPoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RawPoint& from) {
+    RawPoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RawPoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.RawPoint";
+  }
+  protected:
+  explicit RawPoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimeFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // sfixed64 time = 1;
+  void clear_time();
+  int64_t time() const;
+  void set_time(int64_t value);
+  private:
+  int64_t _internal_time() const;
+  void _internal_set_time(int64_t value);
+  public:
+
+  // double value = 2;
+  void clear_value();
+  double value() const;
+  void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.RawPoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t time_;
+    double value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatPoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.StatPoint) */ {
+ public:
+  inline StatPoint() : StatPoint(nullptr) {}
+  ~StatPoint() override;
+  explicit PROTOBUF_CONSTEXPR StatPoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatPoint(const StatPoint& from);
+  StatPoint(StatPoint&& from) noexcept
+    : StatPoint() {
+    *this = ::std::move(from);
+  }
+
+  inline StatPoint& operator=(const StatPoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatPoint& operator=(StatPoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatPoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatPoint* internal_default_instance() {
+    return reinterpret_cast<const StatPoint*>(
+               &_StatPoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(StatPoint& a, StatPoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatPoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatPoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatPoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatPoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatPoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatPoint& from) {
+    StatPoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatPoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.StatPoint";
+  }
+  protected:
+  explicit StatPoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimeFieldNumber = 1,
+    kMinFieldNumber = 2,
+    kMeanFieldNumber = 3,
+    kMaxFieldNumber = 4,
+    kCountFieldNumber = 5,
+  };
+  // sfixed64 time = 1;
+  void clear_time();
+  int64_t time() const;
+  void set_time(int64_t value);
+  private:
+  int64_t _internal_time() const;
+  void _internal_set_time(int64_t value);
+  public:
+
+  // double min = 2;
+  void clear_min();
+  double min() const;
+  void set_min(double value);
+  private:
+  double _internal_min() const;
+  void _internal_set_min(double value);
+  public:
+
+  // double mean = 3;
+  void clear_mean();
+  double mean() const;
+  void set_mean(double value);
+  private:
+  double _internal_mean() const;
+  void _internal_set_mean(double value);
+  public:
+
+  // double max = 4;
+  void clear_max();
+  double max() const;
+  void set_max(double value);
+  private:
+  double _internal_max() const;
+  void _internal_set_max(double value);
+  public:
+
+  // fixed64 count = 5;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.StatPoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t time_;
+    double min_;
+    double mean_;
+    double max_;
+    uint64_t count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangedRange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.ChangedRange) */ {
+ public:
+  inline ChangedRange() : ChangedRange(nullptr) {}
+  ~ChangedRange() override;
+  explicit PROTOBUF_CONSTEXPR ChangedRange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangedRange(const ChangedRange& from);
+  ChangedRange(ChangedRange&& from) noexcept
+    : ChangedRange() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangedRange& operator=(const ChangedRange& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangedRange& operator=(ChangedRange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangedRange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangedRange* internal_default_instance() {
+    return reinterpret_cast<const ChangedRange*>(
+               &_ChangedRange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(ChangedRange& a, ChangedRange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangedRange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangedRange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangedRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangedRange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangedRange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangedRange& from) {
+    ChangedRange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangedRange* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.ChangedRange";
+  }
+  protected:
+  explicit ChangedRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartFieldNumber = 1,
+    kEndFieldNumber = 2,
+  };
+  // sfixed64 start = 1;
+  void clear_start();
+  int64_t start() const;
+  void set_start(int64_t value);
+  private:
+  int64_t _internal_start() const;
+  void _internal_set_start(int64_t value);
+  public:
+
+  // sfixed64 end = 2;
+  void clear_end();
+  int64_t end() const;
+  void set_end(int64_t value);
+  private:
+  int64_t _internal_end() const;
+  void _internal_set_end(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.ChangedRange)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t start_;
+    int64_t end_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Status final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.Status) */ {
+ public:
+  inline Status() : Status(nullptr) {}
+  ~Status() override;
+  explicit PROTOBUF_CONSTEXPR Status(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Status(const Status& from);
+  Status(Status&& from) noexcept
+    : Status() {
+    *this = ::std::move(from);
+  }
+
+  inline Status& operator=(const Status& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Status& operator=(Status&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Status& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Status* internal_default_instance() {
+    return reinterpret_cast<const Status*>(
+               &_Status_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(Status& a, Status& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Status* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Status* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Status* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Status>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Status& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Status& from) {
+    Status::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Status* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.Status";
+  }
+  protected:
+  explicit Status(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgFieldNumber = 2,
+    kMashFieldNumber = 3,
+    kCodeFieldNumber = 1,
+  };
+  // string msg = 2;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
+  // .grpcinterface.Mash mash = 3;
+  bool has_mash() const;
+  private:
+  bool _internal_has_mash() const;
+  public:
+  void clear_mash();
+  const ::grpcinterface::Mash& mash() const;
+  PROTOBUF_NODISCARD ::grpcinterface::Mash* release_mash();
+  ::grpcinterface::Mash* mutable_mash();
+  void set_allocated_mash(::grpcinterface::Mash* mash);
+  private:
+  const ::grpcinterface::Mash& _internal_mash() const;
+  ::grpcinterface::Mash* _internal_mutable_mash();
+  public:
+  void unsafe_arena_set_allocated_mash(
+      ::grpcinterface::Mash* mash);
+  ::grpcinterface::Mash* unsafe_arena_release_mash();
+
+  // uint32 code = 1;
+  void clear_code();
+  uint32_t code() const;
+  void set_code(uint32_t value);
+  private:
+  uint32_t _internal_code() const;
+  void _internal_set_code(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.Status)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    ::grpcinterface::Mash* mash_;
+    uint32_t code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Mash final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.Mash) */ {
+ public:
+  inline Mash() : Mash(nullptr) {}
+  ~Mash() override;
+  explicit PROTOBUF_CONSTEXPR Mash(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Mash(const Mash& from);
+  Mash(Mash&& from) noexcept
+    : Mash() {
+    *this = ::std::move(from);
+  }
+
+  inline Mash& operator=(const Mash& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Mash& operator=(Mash&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mash& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Mash* internal_default_instance() {
+    return reinterpret_cast<const Mash*>(
+               &_Mash_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(Mash& a, Mash& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Mash* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mash* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Mash* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Mash>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Mash& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Mash& from) {
+    Mash::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Mash* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.Mash";
+  }
+  protected:
+  explicit Mash(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMembersFieldNumber = 7,
+    kLeaderFieldNumber = 2,
+    kRevisionFieldNumber = 1,
+    kLeaderRevisionFieldNumber = 3,
+    kTotalWeightFieldNumber = 4,
+    kUnmappedFieldNumber = 6,
+    kHealthyFieldNumber = 5,
+  };
+  // repeated .grpcinterface.Member members = 7;
+  int members_size() const;
+  private:
+  int _internal_members_size() const;
+  public:
+  void clear_members();
+  ::grpcinterface::Member* mutable_members(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::Member >*
+      mutable_members();
+  private:
+  const ::grpcinterface::Member& _internal_members(int index) const;
+  ::grpcinterface::Member* _internal_add_members();
+  public:
+  const ::grpcinterface::Member& members(int index) const;
+  ::grpcinterface::Member* add_members();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::Member >&
+      members() const;
+
+  // string leader = 2;
+  void clear_leader();
+  const std::string& leader() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader();
+  PROTOBUF_NODISCARD std::string* release_leader();
+  void set_allocated_leader(std::string* leader);
+  private:
+  const std::string& _internal_leader() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader(const std::string& value);
+  std::string* _internal_mutable_leader();
+  public:
+
+  // int64 revision = 1;
+  void clear_revision();
+  int64_t revision() const;
+  void set_revision(int64_t value);
+  private:
+  int64_t _internal_revision() const;
+  void _internal_set_revision(int64_t value);
+  public:
+
+  // int64 leaderRevision = 3;
+  void clear_leaderrevision();
+  int64_t leaderrevision() const;
+  void set_leaderrevision(int64_t value);
+  private:
+  int64_t _internal_leaderrevision() const;
+  void _internal_set_leaderrevision(int64_t value);
+  public:
+
+  // int64 totalWeight = 4;
+  void clear_totalweight();
+  int64_t totalweight() const;
+  void set_totalweight(int64_t value);
+  private:
+  int64_t _internal_totalweight() const;
+  void _internal_set_totalweight(int64_t value);
+  public:
+
+  // double unmapped = 6;
+  void clear_unmapped();
+  double unmapped() const;
+  void set_unmapped(double value);
+  private:
+  double _internal_unmapped() const;
+  void _internal_set_unmapped(double value);
+  public:
+
+  // bool healthy = 5;
+  void clear_healthy();
+  bool healthy() const;
+  void set_healthy(bool value);
+  private:
+  bool _internal_healthy() const;
+  void _internal_set_healthy(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.Mash)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::Member > members_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_;
+    int64_t revision_;
+    int64_t leaderrevision_;
+    int64_t totalweight_;
+    double unmapped_;
+    bool healthy_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Member final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.Member) */ {
+ public:
+  inline Member() : Member(nullptr) {}
+  ~Member() override;
+  explicit PROTOBUF_CONSTEXPR Member(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Member(const Member& from);
+  Member(Member&& from) noexcept
+    : Member() {
+    *this = ::std::move(from);
+  }
+
+  inline Member& operator=(const Member& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Member& operator=(Member&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Member& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Member* internal_default_instance() {
+    return reinterpret_cast<const Member*>(
+               &_Member_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(Member& a, Member& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Member* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Member* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Member* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Member>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Member& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Member& from) {
+    Member::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Member* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.Member";
+  }
+  protected:
+  explicit Member(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodenameFieldNumber = 2,
+    kHttpEndpointsFieldNumber = 10,
+    kGrpcEndpointsFieldNumber = 11,
+    kHashFieldNumber = 1,
+    kUpFieldNumber = 3,
+    kInFieldNumber = 4,
+    kEnabledFieldNumber = 5,
+    kStartFieldNumber = 6,
+    kEndFieldNumber = 7,
+    kWeightFieldNumber = 8,
+    kReadPreferenceFieldNumber = 9,
+  };
+  // string nodename = 2;
+  void clear_nodename();
+  const std::string& nodename() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nodename(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nodename();
+  PROTOBUF_NODISCARD std::string* release_nodename();
+  void set_allocated_nodename(std::string* nodename);
+  private:
+  const std::string& _internal_nodename() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nodename(const std::string& value);
+  std::string* _internal_mutable_nodename();
+  public:
+
+  // string httpEndpoints = 10;
+  void clear_httpendpoints();
+  const std::string& httpendpoints() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_httpendpoints(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_httpendpoints();
+  PROTOBUF_NODISCARD std::string* release_httpendpoints();
+  void set_allocated_httpendpoints(std::string* httpendpoints);
+  private:
+  const std::string& _internal_httpendpoints() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_httpendpoints(const std::string& value);
+  std::string* _internal_mutable_httpendpoints();
+  public:
+
+  // string grpcEndpoints = 11;
+  void clear_grpcendpoints();
+  const std::string& grpcendpoints() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_grpcendpoints(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_grpcendpoints();
+  PROTOBUF_NODISCARD std::string* release_grpcendpoints();
+  void set_allocated_grpcendpoints(std::string* grpcendpoints);
+  private:
+  const std::string& _internal_grpcendpoints() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_grpcendpoints(const std::string& value);
+  std::string* _internal_mutable_grpcendpoints();
+  public:
+
+  // uint32 hash = 1;
+  void clear_hash();
+  uint32_t hash() const;
+  void set_hash(uint32_t value);
+  private:
+  uint32_t _internal_hash() const;
+  void _internal_set_hash(uint32_t value);
+  public:
+
+  // bool up = 3;
+  void clear_up();
+  bool up() const;
+  void set_up(bool value);
+  private:
+  bool _internal_up() const;
+  void _internal_set_up(bool value);
+  public:
+
+  // bool in = 4;
+  void clear_in();
+  bool in() const;
+  void set_in(bool value);
+  private:
+  bool _internal_in() const;
+  void _internal_set_in(bool value);
+  public:
+
+  // bool enabled = 5;
+  void clear_enabled();
+  bool enabled() const;
+  void set_enabled(bool value);
+  private:
+  bool _internal_enabled() const;
+  void _internal_set_enabled(bool value);
+  public:
+
+  // int64 start = 6;
+  void clear_start();
+  int64_t start() const;
+  void set_start(int64_t value);
+  private:
+  int64_t _internal_start() const;
+  void _internal_set_start(int64_t value);
+  public:
+
+  // int64 end = 7;
+  void clear_end();
+  int64_t end() const;
+  void set_end(int64_t value);
+  private:
+  int64_t _internal_end() const;
+  void _internal_set_end(int64_t value);
+  public:
+
+  // int64 weight = 8;
+  void clear_weight();
+  int64_t weight() const;
+  void set_weight(int64_t value);
+  private:
+  int64_t _internal_weight() const;
+  void _internal_set_weight(int64_t value);
+  public:
+
+  // double readPreference = 9;
+  void clear_readpreference();
+  double readpreference() const;
+  void set_readpreference(double value);
+  private:
+  double _internal_readpreference() const;
+  void _internal_set_readpreference(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.Member)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nodename_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr httpendpoints_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr grpcendpoints_;
+    uint32_t hash_;
+    bool up_;
+    bool in_;
+    bool enabled_;
+    int64_t start_;
+    int64_t end_;
+    int64_t weight_;
+    double readpreference_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeyOptValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.KeyOptValue) */ {
+ public:
+  inline KeyOptValue() : KeyOptValue(nullptr) {}
+  ~KeyOptValue() override;
+  explicit PROTOBUF_CONSTEXPR KeyOptValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeyOptValue(const KeyOptValue& from);
+  KeyOptValue(KeyOptValue&& from) noexcept
+    : KeyOptValue() {
+    *this = ::std::move(from);
+  }
+
+  inline KeyOptValue& operator=(const KeyOptValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeyOptValue& operator=(KeyOptValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeyOptValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeyOptValue* internal_default_instance() {
+    return reinterpret_cast<const KeyOptValue*>(
+               &_KeyOptValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    39;
+
+  friend void swap(KeyOptValue& a, KeyOptValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeyOptValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeyOptValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeyOptValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeyOptValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeyOptValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeyOptValue& from) {
+    KeyOptValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeyOptValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.KeyOptValue";
+  }
+  protected:
+  explicit KeyOptValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // .grpcinterface.OptValue val = 2;
+  bool has_val() const;
+  private:
+  bool _internal_has_val() const;
+  public:
+  void clear_val();
+  const ::grpcinterface::OptValue& val() const;
+  PROTOBUF_NODISCARD ::grpcinterface::OptValue* release_val();
+  ::grpcinterface::OptValue* mutable_val();
+  void set_allocated_val(::grpcinterface::OptValue* val);
+  private:
+  const ::grpcinterface::OptValue& _internal_val() const;
+  ::grpcinterface::OptValue* _internal_mutable_val();
+  public:
+  void unsafe_arena_set_allocated_val(
+      ::grpcinterface::OptValue* val);
+  ::grpcinterface::OptValue* unsafe_arena_release_val();
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.KeyOptValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::grpcinterface::OptValue* val_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OptValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.OptValue) */ {
+ public:
+  inline OptValue() : OptValue(nullptr) {}
+  ~OptValue() override;
+  explicit PROTOBUF_CONSTEXPR OptValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OptValue(const OptValue& from);
+  OptValue(OptValue&& from) noexcept
+    : OptValue() {
+    *this = ::std::move(from);
+  }
+
+  inline OptValue& operator=(const OptValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OptValue& operator=(OptValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OptValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OptValue* internal_default_instance() {
+    return reinterpret_cast<const OptValue*>(
+               &_OptValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    40;
+
+  friend void swap(OptValue& a, OptValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OptValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OptValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OptValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OptValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OptValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OptValue& from) {
+    OptValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OptValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.OptValue";
+  }
+  protected:
+  explicit OptValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // bytes value = 1;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.OptValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeyValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:grpcinterface.KeyValue) */ {
+ public:
+  inline KeyValue() : KeyValue(nullptr) {}
+  ~KeyValue() override;
+  explicit PROTOBUF_CONSTEXPR KeyValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeyValue(const KeyValue& from);
+  KeyValue(KeyValue&& from) noexcept
+    : KeyValue() {
+    *this = ::std::move(from);
+  }
+
+  inline KeyValue& operator=(const KeyValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeyValue& operator=(KeyValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeyValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeyValue* internal_default_instance() {
+    return reinterpret_cast<const KeyValue*>(
+               &_KeyValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    41;
+
+  friend void swap(KeyValue& a, KeyValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeyValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeyValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeyValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeyValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeyValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeyValue& from) {
+    KeyValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeyValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "grpcinterface.KeyValue";
+  }
+  protected:
+  explicit KeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:grpcinterface.KeyValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_btrdb_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RawValuesParams
+
+// bytes uuid = 1;
+inline void RawValuesParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& RawValuesParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.RawValuesParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RawValuesParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.RawValuesParams.uuid)
+}
+inline std::string* RawValuesParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.RawValuesParams.uuid)
+  return _s;
+}
+inline const std::string& RawValuesParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void RawValuesParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RawValuesParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RawValuesParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.RawValuesParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void RawValuesParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.RawValuesParams.uuid)
+}
+
+// sfixed64 start = 2;
+inline void RawValuesParams::clear_start() {
+  _impl_.start_ = int64_t{0};
+}
+inline int64_t RawValuesParams::_internal_start() const {
+  return _impl_.start_;
+}
+inline int64_t RawValuesParams::start() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.RawValuesParams.start)
+  return _internal_start();
+}
+inline void RawValuesParams::_internal_set_start(int64_t value) {
+  
+  _impl_.start_ = value;
+}
+inline void RawValuesParams::set_start(int64_t value) {
+  _internal_set_start(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.RawValuesParams.start)
+}
+
+// sfixed64 end = 3;
+inline void RawValuesParams::clear_end() {
+  _impl_.end_ = int64_t{0};
+}
+inline int64_t RawValuesParams::_internal_end() const {
+  return _impl_.end_;
+}
+inline int64_t RawValuesParams::end() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.RawValuesParams.end)
+  return _internal_end();
+}
+inline void RawValuesParams::_internal_set_end(int64_t value) {
+  
+  _impl_.end_ = value;
+}
+inline void RawValuesParams::set_end(int64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.RawValuesParams.end)
+}
+
+// uint64 versionMajor = 4;
+inline void RawValuesParams::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t RawValuesParams::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t RawValuesParams::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.RawValuesParams.versionMajor)
+  return _internal_versionmajor();
+}
+inline void RawValuesParams::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void RawValuesParams::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.RawValuesParams.versionMajor)
+}
+
+// -------------------------------------------------------------------
+
+// RawValuesResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool RawValuesResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool RawValuesResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void RawValuesResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& RawValuesResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& RawValuesResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.RawValuesResponse.stat)
+  return _internal_stat();
+}
+inline void RawValuesResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.RawValuesResponse.stat)
+}
+inline ::grpcinterface::Status* RawValuesResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* RawValuesResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.RawValuesResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* RawValuesResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* RawValuesResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.RawValuesResponse.stat)
+  return _msg;
+}
+inline void RawValuesResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.RawValuesResponse.stat)
+}
+
+// uint64 versionMajor = 2;
+inline void RawValuesResponse::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t RawValuesResponse::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t RawValuesResponse::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.RawValuesResponse.versionMajor)
+  return _internal_versionmajor();
+}
+inline void RawValuesResponse::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void RawValuesResponse::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.RawValuesResponse.versionMajor)
+}
+
+// uint64 versionMinor = 3;
+inline void RawValuesResponse::clear_versionminor() {
+  _impl_.versionminor_ = uint64_t{0u};
+}
+inline uint64_t RawValuesResponse::_internal_versionminor() const {
+  return _impl_.versionminor_;
+}
+inline uint64_t RawValuesResponse::versionminor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.RawValuesResponse.versionMinor)
+  return _internal_versionminor();
+}
+inline void RawValuesResponse::_internal_set_versionminor(uint64_t value) {
+  
+  _impl_.versionminor_ = value;
+}
+inline void RawValuesResponse::set_versionminor(uint64_t value) {
+  _internal_set_versionminor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.RawValuesResponse.versionMinor)
+}
+
+// repeated .grpcinterface.RawPoint values = 4;
+inline int RawValuesResponse::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int RawValuesResponse::values_size() const {
+  return _internal_values_size();
+}
+inline void RawValuesResponse::clear_values() {
+  _impl_.values_.Clear();
+}
+inline ::grpcinterface::RawPoint* RawValuesResponse::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.RawValuesResponse.values)
+  return _impl_.values_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::RawPoint >*
+RawValuesResponse::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.RawValuesResponse.values)
+  return &_impl_.values_;
+}
+inline const ::grpcinterface::RawPoint& RawValuesResponse::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const ::grpcinterface::RawPoint& RawValuesResponse::values(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.RawValuesResponse.values)
+  return _internal_values(index);
+}
+inline ::grpcinterface::RawPoint* RawValuesResponse::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline ::grpcinterface::RawPoint* RawValuesResponse::add_values() {
+  ::grpcinterface::RawPoint* _add = _internal_add_values();
+  // @@protoc_insertion_point(field_add:grpcinterface.RawValuesResponse.values)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::RawPoint >&
+RawValuesResponse::values() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.RawValuesResponse.values)
+  return _impl_.values_;
+}
+
+// -------------------------------------------------------------------
+
+// AlignedWindowsParams
+
+// bytes uuid = 1;
+inline void AlignedWindowsParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& AlignedWindowsParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.AlignedWindowsParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AlignedWindowsParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.AlignedWindowsParams.uuid)
+}
+inline std::string* AlignedWindowsParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.AlignedWindowsParams.uuid)
+  return _s;
+}
+inline const std::string& AlignedWindowsParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void AlignedWindowsParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AlignedWindowsParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AlignedWindowsParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.AlignedWindowsParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void AlignedWindowsParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.AlignedWindowsParams.uuid)
+}
+
+// sfixed64 start = 2;
+inline void AlignedWindowsParams::clear_start() {
+  _impl_.start_ = int64_t{0};
+}
+inline int64_t AlignedWindowsParams::_internal_start() const {
+  return _impl_.start_;
+}
+inline int64_t AlignedWindowsParams::start() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.AlignedWindowsParams.start)
+  return _internal_start();
+}
+inline void AlignedWindowsParams::_internal_set_start(int64_t value) {
+  
+  _impl_.start_ = value;
+}
+inline void AlignedWindowsParams::set_start(int64_t value) {
+  _internal_set_start(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.AlignedWindowsParams.start)
+}
+
+// sfixed64 end = 3;
+inline void AlignedWindowsParams::clear_end() {
+  _impl_.end_ = int64_t{0};
+}
+inline int64_t AlignedWindowsParams::_internal_end() const {
+  return _impl_.end_;
+}
+inline int64_t AlignedWindowsParams::end() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.AlignedWindowsParams.end)
+  return _internal_end();
+}
+inline void AlignedWindowsParams::_internal_set_end(int64_t value) {
+  
+  _impl_.end_ = value;
+}
+inline void AlignedWindowsParams::set_end(int64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.AlignedWindowsParams.end)
+}
+
+// uint64 versionMajor = 4;
+inline void AlignedWindowsParams::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t AlignedWindowsParams::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t AlignedWindowsParams::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.AlignedWindowsParams.versionMajor)
+  return _internal_versionmajor();
+}
+inline void AlignedWindowsParams::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void AlignedWindowsParams::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.AlignedWindowsParams.versionMajor)
+}
+
+// uint32 pointWidth = 5;
+inline void AlignedWindowsParams::clear_pointwidth() {
+  _impl_.pointwidth_ = 0u;
+}
+inline uint32_t AlignedWindowsParams::_internal_pointwidth() const {
+  return _impl_.pointwidth_;
+}
+inline uint32_t AlignedWindowsParams::pointwidth() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.AlignedWindowsParams.pointWidth)
+  return _internal_pointwidth();
+}
+inline void AlignedWindowsParams::_internal_set_pointwidth(uint32_t value) {
+  
+  _impl_.pointwidth_ = value;
+}
+inline void AlignedWindowsParams::set_pointwidth(uint32_t value) {
+  _internal_set_pointwidth(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.AlignedWindowsParams.pointWidth)
+}
+
+// -------------------------------------------------------------------
+
+// AlignedWindowsResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool AlignedWindowsResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool AlignedWindowsResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void AlignedWindowsResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& AlignedWindowsResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& AlignedWindowsResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.AlignedWindowsResponse.stat)
+  return _internal_stat();
+}
+inline void AlignedWindowsResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.AlignedWindowsResponse.stat)
+}
+inline ::grpcinterface::Status* AlignedWindowsResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* AlignedWindowsResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.AlignedWindowsResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* AlignedWindowsResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* AlignedWindowsResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.AlignedWindowsResponse.stat)
+  return _msg;
+}
+inline void AlignedWindowsResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.AlignedWindowsResponse.stat)
+}
+
+// uint64 versionMajor = 2;
+inline void AlignedWindowsResponse::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t AlignedWindowsResponse::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t AlignedWindowsResponse::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.AlignedWindowsResponse.versionMajor)
+  return _internal_versionmajor();
+}
+inline void AlignedWindowsResponse::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void AlignedWindowsResponse::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.AlignedWindowsResponse.versionMajor)
+}
+
+// uint64 versionMinor = 3;
+inline void AlignedWindowsResponse::clear_versionminor() {
+  _impl_.versionminor_ = uint64_t{0u};
+}
+inline uint64_t AlignedWindowsResponse::_internal_versionminor() const {
+  return _impl_.versionminor_;
+}
+inline uint64_t AlignedWindowsResponse::versionminor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.AlignedWindowsResponse.versionMinor)
+  return _internal_versionminor();
+}
+inline void AlignedWindowsResponse::_internal_set_versionminor(uint64_t value) {
+  
+  _impl_.versionminor_ = value;
+}
+inline void AlignedWindowsResponse::set_versionminor(uint64_t value) {
+  _internal_set_versionminor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.AlignedWindowsResponse.versionMinor)
+}
+
+// repeated .grpcinterface.StatPoint values = 4;
+inline int AlignedWindowsResponse::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int AlignedWindowsResponse::values_size() const {
+  return _internal_values_size();
+}
+inline void AlignedWindowsResponse::clear_values() {
+  _impl_.values_.Clear();
+}
+inline ::grpcinterface::StatPoint* AlignedWindowsResponse::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.AlignedWindowsResponse.values)
+  return _impl_.values_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StatPoint >*
+AlignedWindowsResponse::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.AlignedWindowsResponse.values)
+  return &_impl_.values_;
+}
+inline const ::grpcinterface::StatPoint& AlignedWindowsResponse::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const ::grpcinterface::StatPoint& AlignedWindowsResponse::values(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.AlignedWindowsResponse.values)
+  return _internal_values(index);
+}
+inline ::grpcinterface::StatPoint* AlignedWindowsResponse::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline ::grpcinterface::StatPoint* AlignedWindowsResponse::add_values() {
+  ::grpcinterface::StatPoint* _add = _internal_add_values();
+  // @@protoc_insertion_point(field_add:grpcinterface.AlignedWindowsResponse.values)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StatPoint >&
+AlignedWindowsResponse::values() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.AlignedWindowsResponse.values)
+  return _impl_.values_;
+}
+
+// -------------------------------------------------------------------
+
+// WindowsParams
+
+// bytes uuid = 1;
+inline void WindowsParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& WindowsParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.WindowsParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WindowsParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.WindowsParams.uuid)
+}
+inline std::string* WindowsParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.WindowsParams.uuid)
+  return _s;
+}
+inline const std::string& WindowsParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void WindowsParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WindowsParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WindowsParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.WindowsParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void WindowsParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.WindowsParams.uuid)
+}
+
+// sfixed64 start = 2;
+inline void WindowsParams::clear_start() {
+  _impl_.start_ = int64_t{0};
+}
+inline int64_t WindowsParams::_internal_start() const {
+  return _impl_.start_;
+}
+inline int64_t WindowsParams::start() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.WindowsParams.start)
+  return _internal_start();
+}
+inline void WindowsParams::_internal_set_start(int64_t value) {
+  
+  _impl_.start_ = value;
+}
+inline void WindowsParams::set_start(int64_t value) {
+  _internal_set_start(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.WindowsParams.start)
+}
+
+// sfixed64 end = 3;
+inline void WindowsParams::clear_end() {
+  _impl_.end_ = int64_t{0};
+}
+inline int64_t WindowsParams::_internal_end() const {
+  return _impl_.end_;
+}
+inline int64_t WindowsParams::end() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.WindowsParams.end)
+  return _internal_end();
+}
+inline void WindowsParams::_internal_set_end(int64_t value) {
+  
+  _impl_.end_ = value;
+}
+inline void WindowsParams::set_end(int64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.WindowsParams.end)
+}
+
+// uint64 versionMajor = 4;
+inline void WindowsParams::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t WindowsParams::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t WindowsParams::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.WindowsParams.versionMajor)
+  return _internal_versionmajor();
+}
+inline void WindowsParams::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void WindowsParams::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.WindowsParams.versionMajor)
+}
+
+// uint64 width = 5;
+inline void WindowsParams::clear_width() {
+  _impl_.width_ = uint64_t{0u};
+}
+inline uint64_t WindowsParams::_internal_width() const {
+  return _impl_.width_;
+}
+inline uint64_t WindowsParams::width() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.WindowsParams.width)
+  return _internal_width();
+}
+inline void WindowsParams::_internal_set_width(uint64_t value) {
+  
+  _impl_.width_ = value;
+}
+inline void WindowsParams::set_width(uint64_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.WindowsParams.width)
+}
+
+// uint32 depth = 6;
+inline void WindowsParams::clear_depth() {
+  _impl_.depth_ = 0u;
+}
+inline uint32_t WindowsParams::_internal_depth() const {
+  return _impl_.depth_;
+}
+inline uint32_t WindowsParams::depth() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.WindowsParams.depth)
+  return _internal_depth();
+}
+inline void WindowsParams::_internal_set_depth(uint32_t value) {
+  
+  _impl_.depth_ = value;
+}
+inline void WindowsParams::set_depth(uint32_t value) {
+  _internal_set_depth(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.WindowsParams.depth)
+}
+
+// -------------------------------------------------------------------
+
+// WindowsResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool WindowsResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool WindowsResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void WindowsResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& WindowsResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& WindowsResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.WindowsResponse.stat)
+  return _internal_stat();
+}
+inline void WindowsResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.WindowsResponse.stat)
+}
+inline ::grpcinterface::Status* WindowsResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* WindowsResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.WindowsResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* WindowsResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* WindowsResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.WindowsResponse.stat)
+  return _msg;
+}
+inline void WindowsResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.WindowsResponse.stat)
+}
+
+// uint64 versionMajor = 2;
+inline void WindowsResponse::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t WindowsResponse::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t WindowsResponse::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.WindowsResponse.versionMajor)
+  return _internal_versionmajor();
+}
+inline void WindowsResponse::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void WindowsResponse::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.WindowsResponse.versionMajor)
+}
+
+// uint64 versionMinor = 3;
+inline void WindowsResponse::clear_versionminor() {
+  _impl_.versionminor_ = uint64_t{0u};
+}
+inline uint64_t WindowsResponse::_internal_versionminor() const {
+  return _impl_.versionminor_;
+}
+inline uint64_t WindowsResponse::versionminor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.WindowsResponse.versionMinor)
+  return _internal_versionminor();
+}
+inline void WindowsResponse::_internal_set_versionminor(uint64_t value) {
+  
+  _impl_.versionminor_ = value;
+}
+inline void WindowsResponse::set_versionminor(uint64_t value) {
+  _internal_set_versionminor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.WindowsResponse.versionMinor)
+}
+
+// repeated .grpcinterface.StatPoint values = 4;
+inline int WindowsResponse::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int WindowsResponse::values_size() const {
+  return _internal_values_size();
+}
+inline void WindowsResponse::clear_values() {
+  _impl_.values_.Clear();
+}
+inline ::grpcinterface::StatPoint* WindowsResponse::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.WindowsResponse.values)
+  return _impl_.values_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StatPoint >*
+WindowsResponse::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.WindowsResponse.values)
+  return &_impl_.values_;
+}
+inline const ::grpcinterface::StatPoint& WindowsResponse::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const ::grpcinterface::StatPoint& WindowsResponse::values(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.WindowsResponse.values)
+  return _internal_values(index);
+}
+inline ::grpcinterface::StatPoint* WindowsResponse::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline ::grpcinterface::StatPoint* WindowsResponse::add_values() {
+  ::grpcinterface::StatPoint* _add = _internal_add_values();
+  // @@protoc_insertion_point(field_add:grpcinterface.WindowsResponse.values)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StatPoint >&
+WindowsResponse::values() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.WindowsResponse.values)
+  return _impl_.values_;
+}
+
+// -------------------------------------------------------------------
+
+// StreamInfoParams
+
+// bytes uuid = 1;
+inline void StreamInfoParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& StreamInfoParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamInfoParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StreamInfoParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.StreamInfoParams.uuid)
+}
+inline std::string* StreamInfoParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.StreamInfoParams.uuid)
+  return _s;
+}
+inline const std::string& StreamInfoParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void StreamInfoParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StreamInfoParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StreamInfoParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.StreamInfoParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void StreamInfoParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.StreamInfoParams.uuid)
+}
+
+// bool omitVersion = 2;
+inline void StreamInfoParams::clear_omitversion() {
+  _impl_.omitversion_ = false;
+}
+inline bool StreamInfoParams::_internal_omitversion() const {
+  return _impl_.omitversion_;
+}
+inline bool StreamInfoParams::omitversion() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamInfoParams.omitVersion)
+  return _internal_omitversion();
+}
+inline void StreamInfoParams::_internal_set_omitversion(bool value) {
+  
+  _impl_.omitversion_ = value;
+}
+inline void StreamInfoParams::set_omitversion(bool value) {
+  _internal_set_omitversion(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.StreamInfoParams.omitVersion)
+}
+
+// bool omitDescriptor = 3;
+inline void StreamInfoParams::clear_omitdescriptor() {
+  _impl_.omitdescriptor_ = false;
+}
+inline bool StreamInfoParams::_internal_omitdescriptor() const {
+  return _impl_.omitdescriptor_;
+}
+inline bool StreamInfoParams::omitdescriptor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamInfoParams.omitDescriptor)
+  return _internal_omitdescriptor();
+}
+inline void StreamInfoParams::_internal_set_omitdescriptor(bool value) {
+  
+  _impl_.omitdescriptor_ = value;
+}
+inline void StreamInfoParams::set_omitdescriptor(bool value) {
+  _internal_set_omitdescriptor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.StreamInfoParams.omitDescriptor)
+}
+
+// -------------------------------------------------------------------
+
+// StreamInfoResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool StreamInfoResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool StreamInfoResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void StreamInfoResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& StreamInfoResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& StreamInfoResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamInfoResponse.stat)
+  return _internal_stat();
+}
+inline void StreamInfoResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.StreamInfoResponse.stat)
+}
+inline ::grpcinterface::Status* StreamInfoResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* StreamInfoResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.StreamInfoResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* StreamInfoResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* StreamInfoResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.StreamInfoResponse.stat)
+  return _msg;
+}
+inline void StreamInfoResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.StreamInfoResponse.stat)
+}
+
+// uint64 versionMajor = 2;
+inline void StreamInfoResponse::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t StreamInfoResponse::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t StreamInfoResponse::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamInfoResponse.versionMajor)
+  return _internal_versionmajor();
+}
+inline void StreamInfoResponse::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void StreamInfoResponse::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.StreamInfoResponse.versionMajor)
+}
+
+// uint64 versionMinor = 3;
+inline void StreamInfoResponse::clear_versionminor() {
+  _impl_.versionminor_ = uint64_t{0u};
+}
+inline uint64_t StreamInfoResponse::_internal_versionminor() const {
+  return _impl_.versionminor_;
+}
+inline uint64_t StreamInfoResponse::versionminor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamInfoResponse.versionMinor)
+  return _internal_versionminor();
+}
+inline void StreamInfoResponse::_internal_set_versionminor(uint64_t value) {
+  
+  _impl_.versionminor_ = value;
+}
+inline void StreamInfoResponse::set_versionminor(uint64_t value) {
+  _internal_set_versionminor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.StreamInfoResponse.versionMinor)
+}
+
+// .grpcinterface.StreamDescriptor streamDescriptor = 4;
+inline bool StreamInfoResponse::_internal_has_streamdescriptor() const {
+  return this != internal_default_instance() && _impl_.streamdescriptor_ != nullptr;
+}
+inline bool StreamInfoResponse::has_streamdescriptor() const {
+  return _internal_has_streamdescriptor();
+}
+inline void StreamInfoResponse::clear_streamdescriptor() {
+  if (GetArenaForAllocation() == nullptr && _impl_.streamdescriptor_ != nullptr) {
+    delete _impl_.streamdescriptor_;
+  }
+  _impl_.streamdescriptor_ = nullptr;
+}
+inline const ::grpcinterface::StreamDescriptor& StreamInfoResponse::_internal_streamdescriptor() const {
+  const ::grpcinterface::StreamDescriptor* p = _impl_.streamdescriptor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::StreamDescriptor&>(
+      ::grpcinterface::_StreamDescriptor_default_instance_);
+}
+inline const ::grpcinterface::StreamDescriptor& StreamInfoResponse::streamdescriptor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamInfoResponse.streamDescriptor)
+  return _internal_streamdescriptor();
+}
+inline void StreamInfoResponse::unsafe_arena_set_allocated_streamdescriptor(
+    ::grpcinterface::StreamDescriptor* streamdescriptor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.streamdescriptor_);
+  }
+  _impl_.streamdescriptor_ = streamdescriptor;
+  if (streamdescriptor) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.StreamInfoResponse.streamDescriptor)
+}
+inline ::grpcinterface::StreamDescriptor* StreamInfoResponse::release_streamdescriptor() {
+  
+  ::grpcinterface::StreamDescriptor* temp = _impl_.streamdescriptor_;
+  _impl_.streamdescriptor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::StreamDescriptor* StreamInfoResponse::unsafe_arena_release_streamdescriptor() {
+  // @@protoc_insertion_point(field_release:grpcinterface.StreamInfoResponse.streamDescriptor)
+  
+  ::grpcinterface::StreamDescriptor* temp = _impl_.streamdescriptor_;
+  _impl_.streamdescriptor_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::StreamDescriptor* StreamInfoResponse::_internal_mutable_streamdescriptor() {
+  
+  if (_impl_.streamdescriptor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::StreamDescriptor>(GetArenaForAllocation());
+    _impl_.streamdescriptor_ = p;
+  }
+  return _impl_.streamdescriptor_;
+}
+inline ::grpcinterface::StreamDescriptor* StreamInfoResponse::mutable_streamdescriptor() {
+  ::grpcinterface::StreamDescriptor* _msg = _internal_mutable_streamdescriptor();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.StreamInfoResponse.streamDescriptor)
+  return _msg;
+}
+inline void StreamInfoResponse::set_allocated_streamdescriptor(::grpcinterface::StreamDescriptor* streamdescriptor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.streamdescriptor_;
+  }
+  if (streamdescriptor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(streamdescriptor);
+    if (message_arena != submessage_arena) {
+      streamdescriptor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, streamdescriptor, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.streamdescriptor_ = streamdescriptor;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.StreamInfoResponse.streamDescriptor)
+}
+
+// -------------------------------------------------------------------
+
+// StreamDescriptor
+
+// bytes uuid = 1;
+inline void StreamDescriptor::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& StreamDescriptor::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamDescriptor.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StreamDescriptor::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.StreamDescriptor.uuid)
+}
+inline std::string* StreamDescriptor::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.StreamDescriptor.uuid)
+  return _s;
+}
+inline const std::string& StreamDescriptor::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void StreamDescriptor::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StreamDescriptor::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StreamDescriptor::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.StreamDescriptor.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void StreamDescriptor::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.StreamDescriptor.uuid)
+}
+
+// string collection = 2;
+inline void StreamDescriptor::clear_collection() {
+  _impl_.collection_.ClearToEmpty();
+}
+inline const std::string& StreamDescriptor::collection() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamDescriptor.collection)
+  return _internal_collection();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StreamDescriptor::set_collection(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.collection_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.StreamDescriptor.collection)
+}
+inline std::string* StreamDescriptor::mutable_collection() {
+  std::string* _s = _internal_mutable_collection();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.StreamDescriptor.collection)
+  return _s;
+}
+inline const std::string& StreamDescriptor::_internal_collection() const {
+  return _impl_.collection_.Get();
+}
+inline void StreamDescriptor::_internal_set_collection(const std::string& value) {
+  
+  _impl_.collection_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StreamDescriptor::_internal_mutable_collection() {
+  
+  return _impl_.collection_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StreamDescriptor::release_collection() {
+  // @@protoc_insertion_point(field_release:grpcinterface.StreamDescriptor.collection)
+  return _impl_.collection_.Release();
+}
+inline void StreamDescriptor::set_allocated_collection(std::string* collection) {
+  if (collection != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.collection_.SetAllocated(collection, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.collection_.IsDefault()) {
+    _impl_.collection_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.StreamDescriptor.collection)
+}
+
+// repeated .grpcinterface.KeyValue tags = 3;
+inline int StreamDescriptor::_internal_tags_size() const {
+  return _impl_.tags_.size();
+}
+inline int StreamDescriptor::tags_size() const {
+  return _internal_tags_size();
+}
+inline void StreamDescriptor::clear_tags() {
+  _impl_.tags_.Clear();
+}
+inline ::grpcinterface::KeyValue* StreamDescriptor::mutable_tags(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.StreamDescriptor.tags)
+  return _impl_.tags_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >*
+StreamDescriptor::mutable_tags() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.StreamDescriptor.tags)
+  return &_impl_.tags_;
+}
+inline const ::grpcinterface::KeyValue& StreamDescriptor::_internal_tags(int index) const {
+  return _impl_.tags_.Get(index);
+}
+inline const ::grpcinterface::KeyValue& StreamDescriptor::tags(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamDescriptor.tags)
+  return _internal_tags(index);
+}
+inline ::grpcinterface::KeyValue* StreamDescriptor::_internal_add_tags() {
+  return _impl_.tags_.Add();
+}
+inline ::grpcinterface::KeyValue* StreamDescriptor::add_tags() {
+  ::grpcinterface::KeyValue* _add = _internal_add_tags();
+  // @@protoc_insertion_point(field_add:grpcinterface.StreamDescriptor.tags)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >&
+StreamDescriptor::tags() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.StreamDescriptor.tags)
+  return _impl_.tags_;
+}
+
+// repeated .grpcinterface.KeyValue annotations = 4;
+inline int StreamDescriptor::_internal_annotations_size() const {
+  return _impl_.annotations_.size();
+}
+inline int StreamDescriptor::annotations_size() const {
+  return _internal_annotations_size();
+}
+inline void StreamDescriptor::clear_annotations() {
+  _impl_.annotations_.Clear();
+}
+inline ::grpcinterface::KeyValue* StreamDescriptor::mutable_annotations(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.StreamDescriptor.annotations)
+  return _impl_.annotations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >*
+StreamDescriptor::mutable_annotations() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.StreamDescriptor.annotations)
+  return &_impl_.annotations_;
+}
+inline const ::grpcinterface::KeyValue& StreamDescriptor::_internal_annotations(int index) const {
+  return _impl_.annotations_.Get(index);
+}
+inline const ::grpcinterface::KeyValue& StreamDescriptor::annotations(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamDescriptor.annotations)
+  return _internal_annotations(index);
+}
+inline ::grpcinterface::KeyValue* StreamDescriptor::_internal_add_annotations() {
+  return _impl_.annotations_.Add();
+}
+inline ::grpcinterface::KeyValue* StreamDescriptor::add_annotations() {
+  ::grpcinterface::KeyValue* _add = _internal_add_annotations();
+  // @@protoc_insertion_point(field_add:grpcinterface.StreamDescriptor.annotations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >&
+StreamDescriptor::annotations() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.StreamDescriptor.annotations)
+  return _impl_.annotations_;
+}
+
+// uint64 annotationVersion = 5;
+inline void StreamDescriptor::clear_annotationversion() {
+  _impl_.annotationversion_ = uint64_t{0u};
+}
+inline uint64_t StreamDescriptor::_internal_annotationversion() const {
+  return _impl_.annotationversion_;
+}
+inline uint64_t StreamDescriptor::annotationversion() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StreamDescriptor.annotationVersion)
+  return _internal_annotationversion();
+}
+inline void StreamDescriptor::_internal_set_annotationversion(uint64_t value) {
+  
+  _impl_.annotationversion_ = value;
+}
+inline void StreamDescriptor::set_annotationversion(uint64_t value) {
+  _internal_set_annotationversion(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.StreamDescriptor.annotationVersion)
+}
+
+// -------------------------------------------------------------------
+
+// SetStreamAnnotationsParams
+
+// bytes uuid = 1;
+inline void SetStreamAnnotationsParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& SetStreamAnnotationsParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.SetStreamAnnotationsParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetStreamAnnotationsParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.SetStreamAnnotationsParams.uuid)
+}
+inline std::string* SetStreamAnnotationsParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.SetStreamAnnotationsParams.uuid)
+  return _s;
+}
+inline const std::string& SetStreamAnnotationsParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void SetStreamAnnotationsParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetStreamAnnotationsParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SetStreamAnnotationsParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.SetStreamAnnotationsParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void SetStreamAnnotationsParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.SetStreamAnnotationsParams.uuid)
+}
+
+// uint64 expectedAnnotationVersion = 2;
+inline void SetStreamAnnotationsParams::clear_expectedannotationversion() {
+  _impl_.expectedannotationversion_ = uint64_t{0u};
+}
+inline uint64_t SetStreamAnnotationsParams::_internal_expectedannotationversion() const {
+  return _impl_.expectedannotationversion_;
+}
+inline uint64_t SetStreamAnnotationsParams::expectedannotationversion() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.SetStreamAnnotationsParams.expectedAnnotationVersion)
+  return _internal_expectedannotationversion();
+}
+inline void SetStreamAnnotationsParams::_internal_set_expectedannotationversion(uint64_t value) {
+  
+  _impl_.expectedannotationversion_ = value;
+}
+inline void SetStreamAnnotationsParams::set_expectedannotationversion(uint64_t value) {
+  _internal_set_expectedannotationversion(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.SetStreamAnnotationsParams.expectedAnnotationVersion)
+}
+
+// repeated .grpcinterface.KeyOptValue annotations = 3;
+inline int SetStreamAnnotationsParams::_internal_annotations_size() const {
+  return _impl_.annotations_.size();
+}
+inline int SetStreamAnnotationsParams::annotations_size() const {
+  return _internal_annotations_size();
+}
+inline void SetStreamAnnotationsParams::clear_annotations() {
+  _impl_.annotations_.Clear();
+}
+inline ::grpcinterface::KeyOptValue* SetStreamAnnotationsParams::mutable_annotations(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.SetStreamAnnotationsParams.annotations)
+  return _impl_.annotations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >*
+SetStreamAnnotationsParams::mutable_annotations() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.SetStreamAnnotationsParams.annotations)
+  return &_impl_.annotations_;
+}
+inline const ::grpcinterface::KeyOptValue& SetStreamAnnotationsParams::_internal_annotations(int index) const {
+  return _impl_.annotations_.Get(index);
+}
+inline const ::grpcinterface::KeyOptValue& SetStreamAnnotationsParams::annotations(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.SetStreamAnnotationsParams.annotations)
+  return _internal_annotations(index);
+}
+inline ::grpcinterface::KeyOptValue* SetStreamAnnotationsParams::_internal_add_annotations() {
+  return _impl_.annotations_.Add();
+}
+inline ::grpcinterface::KeyOptValue* SetStreamAnnotationsParams::add_annotations() {
+  ::grpcinterface::KeyOptValue* _add = _internal_add_annotations();
+  // @@protoc_insertion_point(field_add:grpcinterface.SetStreamAnnotationsParams.annotations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >&
+SetStreamAnnotationsParams::annotations() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.SetStreamAnnotationsParams.annotations)
+  return _impl_.annotations_;
+}
+
+// -------------------------------------------------------------------
+
+// SetStreamAnnotationsResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool SetStreamAnnotationsResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool SetStreamAnnotationsResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void SetStreamAnnotationsResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& SetStreamAnnotationsResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& SetStreamAnnotationsResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.SetStreamAnnotationsResponse.stat)
+  return _internal_stat();
+}
+inline void SetStreamAnnotationsResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.SetStreamAnnotationsResponse.stat)
+}
+inline ::grpcinterface::Status* SetStreamAnnotationsResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* SetStreamAnnotationsResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.SetStreamAnnotationsResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* SetStreamAnnotationsResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* SetStreamAnnotationsResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.SetStreamAnnotationsResponse.stat)
+  return _msg;
+}
+inline void SetStreamAnnotationsResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.SetStreamAnnotationsResponse.stat)
+}
+
+// -------------------------------------------------------------------
+
+// CreateParams
+
+// bytes uuid = 1;
+inline void CreateParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& CreateParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.CreateParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.CreateParams.uuid)
+}
+inline std::string* CreateParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.CreateParams.uuid)
+  return _s;
+}
+inline const std::string& CreateParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void CreateParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.CreateParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void CreateParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.CreateParams.uuid)
+}
+
+// string collection = 2;
+inline void CreateParams::clear_collection() {
+  _impl_.collection_.ClearToEmpty();
+}
+inline const std::string& CreateParams::collection() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.CreateParams.collection)
+  return _internal_collection();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateParams::set_collection(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.collection_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.CreateParams.collection)
+}
+inline std::string* CreateParams::mutable_collection() {
+  std::string* _s = _internal_mutable_collection();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.CreateParams.collection)
+  return _s;
+}
+inline const std::string& CreateParams::_internal_collection() const {
+  return _impl_.collection_.Get();
+}
+inline void CreateParams::_internal_set_collection(const std::string& value) {
+  
+  _impl_.collection_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateParams::_internal_mutable_collection() {
+  
+  return _impl_.collection_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateParams::release_collection() {
+  // @@protoc_insertion_point(field_release:grpcinterface.CreateParams.collection)
+  return _impl_.collection_.Release();
+}
+inline void CreateParams::set_allocated_collection(std::string* collection) {
+  if (collection != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.collection_.SetAllocated(collection, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.collection_.IsDefault()) {
+    _impl_.collection_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.CreateParams.collection)
+}
+
+// repeated .grpcinterface.KeyValue tags = 3;
+inline int CreateParams::_internal_tags_size() const {
+  return _impl_.tags_.size();
+}
+inline int CreateParams::tags_size() const {
+  return _internal_tags_size();
+}
+inline void CreateParams::clear_tags() {
+  _impl_.tags_.Clear();
+}
+inline ::grpcinterface::KeyValue* CreateParams::mutable_tags(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.CreateParams.tags)
+  return _impl_.tags_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >*
+CreateParams::mutable_tags() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.CreateParams.tags)
+  return &_impl_.tags_;
+}
+inline const ::grpcinterface::KeyValue& CreateParams::_internal_tags(int index) const {
+  return _impl_.tags_.Get(index);
+}
+inline const ::grpcinterface::KeyValue& CreateParams::tags(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.CreateParams.tags)
+  return _internal_tags(index);
+}
+inline ::grpcinterface::KeyValue* CreateParams::_internal_add_tags() {
+  return _impl_.tags_.Add();
+}
+inline ::grpcinterface::KeyValue* CreateParams::add_tags() {
+  ::grpcinterface::KeyValue* _add = _internal_add_tags();
+  // @@protoc_insertion_point(field_add:grpcinterface.CreateParams.tags)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >&
+CreateParams::tags() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.CreateParams.tags)
+  return _impl_.tags_;
+}
+
+// repeated .grpcinterface.KeyValue annotations = 4;
+inline int CreateParams::_internal_annotations_size() const {
+  return _impl_.annotations_.size();
+}
+inline int CreateParams::annotations_size() const {
+  return _internal_annotations_size();
+}
+inline void CreateParams::clear_annotations() {
+  _impl_.annotations_.Clear();
+}
+inline ::grpcinterface::KeyValue* CreateParams::mutable_annotations(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.CreateParams.annotations)
+  return _impl_.annotations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >*
+CreateParams::mutable_annotations() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.CreateParams.annotations)
+  return &_impl_.annotations_;
+}
+inline const ::grpcinterface::KeyValue& CreateParams::_internal_annotations(int index) const {
+  return _impl_.annotations_.Get(index);
+}
+inline const ::grpcinterface::KeyValue& CreateParams::annotations(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.CreateParams.annotations)
+  return _internal_annotations(index);
+}
+inline ::grpcinterface::KeyValue* CreateParams::_internal_add_annotations() {
+  return _impl_.annotations_.Add();
+}
+inline ::grpcinterface::KeyValue* CreateParams::add_annotations() {
+  ::grpcinterface::KeyValue* _add = _internal_add_annotations();
+  // @@protoc_insertion_point(field_add:grpcinterface.CreateParams.annotations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyValue >&
+CreateParams::annotations() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.CreateParams.annotations)
+  return _impl_.annotations_;
+}
+
+// -------------------------------------------------------------------
+
+// CreateResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool CreateResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool CreateResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void CreateResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& CreateResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& CreateResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.CreateResponse.stat)
+  return _internal_stat();
+}
+inline void CreateResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.CreateResponse.stat)
+}
+inline ::grpcinterface::Status* CreateResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* CreateResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.CreateResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* CreateResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* CreateResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.CreateResponse.stat)
+  return _msg;
+}
+inline void CreateResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.CreateResponse.stat)
+}
+
+// -------------------------------------------------------------------
+
+// ListCollectionsParams
+
+// string prefix = 1;
+inline void ListCollectionsParams::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+}
+inline const std::string& ListCollectionsParams::prefix() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ListCollectionsParams.prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListCollectionsParams::set_prefix(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.ListCollectionsParams.prefix)
+}
+inline std::string* ListCollectionsParams::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.ListCollectionsParams.prefix)
+  return _s;
+}
+inline const std::string& ListCollectionsParams::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void ListCollectionsParams::_internal_set_prefix(const std::string& value) {
+  
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListCollectionsParams::_internal_mutable_prefix() {
+  
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListCollectionsParams::release_prefix() {
+  // @@protoc_insertion_point(field_release:grpcinterface.ListCollectionsParams.prefix)
+  return _impl_.prefix_.Release();
+}
+inline void ListCollectionsParams::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.ListCollectionsParams.prefix)
+}
+
+// string startWith = 2;
+inline void ListCollectionsParams::clear_startwith() {
+  _impl_.startwith_.ClearToEmpty();
+}
+inline const std::string& ListCollectionsParams::startwith() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ListCollectionsParams.startWith)
+  return _internal_startwith();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListCollectionsParams::set_startwith(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.startwith_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.ListCollectionsParams.startWith)
+}
+inline std::string* ListCollectionsParams::mutable_startwith() {
+  std::string* _s = _internal_mutable_startwith();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.ListCollectionsParams.startWith)
+  return _s;
+}
+inline const std::string& ListCollectionsParams::_internal_startwith() const {
+  return _impl_.startwith_.Get();
+}
+inline void ListCollectionsParams::_internal_set_startwith(const std::string& value) {
+  
+  _impl_.startwith_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListCollectionsParams::_internal_mutable_startwith() {
+  
+  return _impl_.startwith_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListCollectionsParams::release_startwith() {
+  // @@protoc_insertion_point(field_release:grpcinterface.ListCollectionsParams.startWith)
+  return _impl_.startwith_.Release();
+}
+inline void ListCollectionsParams::set_allocated_startwith(std::string* startwith) {
+  if (startwith != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.startwith_.SetAllocated(startwith, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.startwith_.IsDefault()) {
+    _impl_.startwith_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.ListCollectionsParams.startWith)
+}
+
+// uint64 limit = 3;
+inline void ListCollectionsParams::clear_limit() {
+  _impl_.limit_ = uint64_t{0u};
+}
+inline uint64_t ListCollectionsParams::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint64_t ListCollectionsParams::limit() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ListCollectionsParams.limit)
+  return _internal_limit();
+}
+inline void ListCollectionsParams::_internal_set_limit(uint64_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void ListCollectionsParams::set_limit(uint64_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.ListCollectionsParams.limit)
+}
+
+// -------------------------------------------------------------------
+
+// ListCollectionsResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool ListCollectionsResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool ListCollectionsResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void ListCollectionsResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& ListCollectionsResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& ListCollectionsResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ListCollectionsResponse.stat)
+  return _internal_stat();
+}
+inline void ListCollectionsResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.ListCollectionsResponse.stat)
+}
+inline ::grpcinterface::Status* ListCollectionsResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* ListCollectionsResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.ListCollectionsResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* ListCollectionsResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* ListCollectionsResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.ListCollectionsResponse.stat)
+  return _msg;
+}
+inline void ListCollectionsResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.ListCollectionsResponse.stat)
+}
+
+// repeated string collections = 2;
+inline int ListCollectionsResponse::_internal_collections_size() const {
+  return _impl_.collections_.size();
+}
+inline int ListCollectionsResponse::collections_size() const {
+  return _internal_collections_size();
+}
+inline void ListCollectionsResponse::clear_collections() {
+  _impl_.collections_.Clear();
+}
+inline std::string* ListCollectionsResponse::add_collections() {
+  std::string* _s = _internal_add_collections();
+  // @@protoc_insertion_point(field_add_mutable:grpcinterface.ListCollectionsResponse.collections)
+  return _s;
+}
+inline const std::string& ListCollectionsResponse::_internal_collections(int index) const {
+  return _impl_.collections_.Get(index);
+}
+inline const std::string& ListCollectionsResponse::collections(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ListCollectionsResponse.collections)
+  return _internal_collections(index);
+}
+inline std::string* ListCollectionsResponse::mutable_collections(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.ListCollectionsResponse.collections)
+  return _impl_.collections_.Mutable(index);
+}
+inline void ListCollectionsResponse::set_collections(int index, const std::string& value) {
+  _impl_.collections_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.ListCollectionsResponse.collections)
+}
+inline void ListCollectionsResponse::set_collections(int index, std::string&& value) {
+  _impl_.collections_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:grpcinterface.ListCollectionsResponse.collections)
+}
+inline void ListCollectionsResponse::set_collections(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.collections_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:grpcinterface.ListCollectionsResponse.collections)
+}
+inline void ListCollectionsResponse::set_collections(int index, const char* value, size_t size) {
+  _impl_.collections_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:grpcinterface.ListCollectionsResponse.collections)
+}
+inline std::string* ListCollectionsResponse::_internal_add_collections() {
+  return _impl_.collections_.Add();
+}
+inline void ListCollectionsResponse::add_collections(const std::string& value) {
+  _impl_.collections_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:grpcinterface.ListCollectionsResponse.collections)
+}
+inline void ListCollectionsResponse::add_collections(std::string&& value) {
+  _impl_.collections_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:grpcinterface.ListCollectionsResponse.collections)
+}
+inline void ListCollectionsResponse::add_collections(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.collections_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:grpcinterface.ListCollectionsResponse.collections)
+}
+inline void ListCollectionsResponse::add_collections(const char* value, size_t size) {
+  _impl_.collections_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:grpcinterface.ListCollectionsResponse.collections)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ListCollectionsResponse::collections() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.ListCollectionsResponse.collections)
+  return _impl_.collections_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ListCollectionsResponse::mutable_collections() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.ListCollectionsResponse.collections)
+  return &_impl_.collections_;
+}
+
+// -------------------------------------------------------------------
+
+// LookupStreamsParams
+
+// string collection = 1;
+inline void LookupStreamsParams::clear_collection() {
+  _impl_.collection_.ClearToEmpty();
+}
+inline const std::string& LookupStreamsParams::collection() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.LookupStreamsParams.collection)
+  return _internal_collection();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LookupStreamsParams::set_collection(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.collection_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.LookupStreamsParams.collection)
+}
+inline std::string* LookupStreamsParams::mutable_collection() {
+  std::string* _s = _internal_mutable_collection();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.LookupStreamsParams.collection)
+  return _s;
+}
+inline const std::string& LookupStreamsParams::_internal_collection() const {
+  return _impl_.collection_.Get();
+}
+inline void LookupStreamsParams::_internal_set_collection(const std::string& value) {
+  
+  _impl_.collection_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LookupStreamsParams::_internal_mutable_collection() {
+  
+  return _impl_.collection_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LookupStreamsParams::release_collection() {
+  // @@protoc_insertion_point(field_release:grpcinterface.LookupStreamsParams.collection)
+  return _impl_.collection_.Release();
+}
+inline void LookupStreamsParams::set_allocated_collection(std::string* collection) {
+  if (collection != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.collection_.SetAllocated(collection, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.collection_.IsDefault()) {
+    _impl_.collection_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.LookupStreamsParams.collection)
+}
+
+// bool isCollectionPrefix = 2;
+inline void LookupStreamsParams::clear_iscollectionprefix() {
+  _impl_.iscollectionprefix_ = false;
+}
+inline bool LookupStreamsParams::_internal_iscollectionprefix() const {
+  return _impl_.iscollectionprefix_;
+}
+inline bool LookupStreamsParams::iscollectionprefix() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.LookupStreamsParams.isCollectionPrefix)
+  return _internal_iscollectionprefix();
+}
+inline void LookupStreamsParams::_internal_set_iscollectionprefix(bool value) {
+  
+  _impl_.iscollectionprefix_ = value;
+}
+inline void LookupStreamsParams::set_iscollectionprefix(bool value) {
+  _internal_set_iscollectionprefix(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.LookupStreamsParams.isCollectionPrefix)
+}
+
+// repeated .grpcinterface.KeyOptValue tags = 3;
+inline int LookupStreamsParams::_internal_tags_size() const {
+  return _impl_.tags_.size();
+}
+inline int LookupStreamsParams::tags_size() const {
+  return _internal_tags_size();
+}
+inline void LookupStreamsParams::clear_tags() {
+  _impl_.tags_.Clear();
+}
+inline ::grpcinterface::KeyOptValue* LookupStreamsParams::mutable_tags(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.LookupStreamsParams.tags)
+  return _impl_.tags_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >*
+LookupStreamsParams::mutable_tags() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.LookupStreamsParams.tags)
+  return &_impl_.tags_;
+}
+inline const ::grpcinterface::KeyOptValue& LookupStreamsParams::_internal_tags(int index) const {
+  return _impl_.tags_.Get(index);
+}
+inline const ::grpcinterface::KeyOptValue& LookupStreamsParams::tags(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.LookupStreamsParams.tags)
+  return _internal_tags(index);
+}
+inline ::grpcinterface::KeyOptValue* LookupStreamsParams::_internal_add_tags() {
+  return _impl_.tags_.Add();
+}
+inline ::grpcinterface::KeyOptValue* LookupStreamsParams::add_tags() {
+  ::grpcinterface::KeyOptValue* _add = _internal_add_tags();
+  // @@protoc_insertion_point(field_add:grpcinterface.LookupStreamsParams.tags)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >&
+LookupStreamsParams::tags() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.LookupStreamsParams.tags)
+  return _impl_.tags_;
+}
+
+// repeated .grpcinterface.KeyOptValue annotations = 4;
+inline int LookupStreamsParams::_internal_annotations_size() const {
+  return _impl_.annotations_.size();
+}
+inline int LookupStreamsParams::annotations_size() const {
+  return _internal_annotations_size();
+}
+inline void LookupStreamsParams::clear_annotations() {
+  _impl_.annotations_.Clear();
+}
+inline ::grpcinterface::KeyOptValue* LookupStreamsParams::mutable_annotations(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.LookupStreamsParams.annotations)
+  return _impl_.annotations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >*
+LookupStreamsParams::mutable_annotations() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.LookupStreamsParams.annotations)
+  return &_impl_.annotations_;
+}
+inline const ::grpcinterface::KeyOptValue& LookupStreamsParams::_internal_annotations(int index) const {
+  return _impl_.annotations_.Get(index);
+}
+inline const ::grpcinterface::KeyOptValue& LookupStreamsParams::annotations(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.LookupStreamsParams.annotations)
+  return _internal_annotations(index);
+}
+inline ::grpcinterface::KeyOptValue* LookupStreamsParams::_internal_add_annotations() {
+  return _impl_.annotations_.Add();
+}
+inline ::grpcinterface::KeyOptValue* LookupStreamsParams::add_annotations() {
+  ::grpcinterface::KeyOptValue* _add = _internal_add_annotations();
+  // @@protoc_insertion_point(field_add:grpcinterface.LookupStreamsParams.annotations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::KeyOptValue >&
+LookupStreamsParams::annotations() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.LookupStreamsParams.annotations)
+  return _impl_.annotations_;
+}
+
+// -------------------------------------------------------------------
+
+// LookupStreamsResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool LookupStreamsResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool LookupStreamsResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void LookupStreamsResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& LookupStreamsResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& LookupStreamsResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.LookupStreamsResponse.stat)
+  return _internal_stat();
+}
+inline void LookupStreamsResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.LookupStreamsResponse.stat)
+}
+inline ::grpcinterface::Status* LookupStreamsResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* LookupStreamsResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.LookupStreamsResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* LookupStreamsResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* LookupStreamsResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.LookupStreamsResponse.stat)
+  return _msg;
+}
+inline void LookupStreamsResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.LookupStreamsResponse.stat)
+}
+
+// repeated .grpcinterface.StreamDescriptor values = 2;
+inline int LookupStreamsResponse::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int LookupStreamsResponse::values_size() const {
+  return _internal_values_size();
+}
+inline void LookupStreamsResponse::clear_values() {
+  _impl_.values_.Clear();
+}
+inline ::grpcinterface::StreamDescriptor* LookupStreamsResponse::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.LookupStreamsResponse.values)
+  return _impl_.values_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StreamDescriptor >*
+LookupStreamsResponse::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.LookupStreamsResponse.values)
+  return &_impl_.values_;
+}
+inline const ::grpcinterface::StreamDescriptor& LookupStreamsResponse::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const ::grpcinterface::StreamDescriptor& LookupStreamsResponse::values(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.LookupStreamsResponse.values)
+  return _internal_values(index);
+}
+inline ::grpcinterface::StreamDescriptor* LookupStreamsResponse::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline ::grpcinterface::StreamDescriptor* LookupStreamsResponse::add_values() {
+  ::grpcinterface::StreamDescriptor* _add = _internal_add_values();
+  // @@protoc_insertion_point(field_add:grpcinterface.LookupStreamsResponse.values)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::StreamDescriptor >&
+LookupStreamsResponse::values() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.LookupStreamsResponse.values)
+  return _impl_.values_;
+}
+
+// -------------------------------------------------------------------
+
+// NearestParams
+
+// bytes uuid = 1;
+inline void NearestParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& NearestParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.NearestParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NearestParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.NearestParams.uuid)
+}
+inline std::string* NearestParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.NearestParams.uuid)
+  return _s;
+}
+inline const std::string& NearestParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void NearestParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NearestParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NearestParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.NearestParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void NearestParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.NearestParams.uuid)
+}
+
+// sfixed64 time = 2;
+inline void NearestParams::clear_time() {
+  _impl_.time_ = int64_t{0};
+}
+inline int64_t NearestParams::_internal_time() const {
+  return _impl_.time_;
+}
+inline int64_t NearestParams::time() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.NearestParams.time)
+  return _internal_time();
+}
+inline void NearestParams::_internal_set_time(int64_t value) {
+  
+  _impl_.time_ = value;
+}
+inline void NearestParams::set_time(int64_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.NearestParams.time)
+}
+
+// uint64 versionMajor = 3;
+inline void NearestParams::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t NearestParams::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t NearestParams::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.NearestParams.versionMajor)
+  return _internal_versionmajor();
+}
+inline void NearestParams::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void NearestParams::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.NearestParams.versionMajor)
+}
+
+// bool backward = 4;
+inline void NearestParams::clear_backward() {
+  _impl_.backward_ = false;
+}
+inline bool NearestParams::_internal_backward() const {
+  return _impl_.backward_;
+}
+inline bool NearestParams::backward() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.NearestParams.backward)
+  return _internal_backward();
+}
+inline void NearestParams::_internal_set_backward(bool value) {
+  
+  _impl_.backward_ = value;
+}
+inline void NearestParams::set_backward(bool value) {
+  _internal_set_backward(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.NearestParams.backward)
+}
+
+// -------------------------------------------------------------------
+
+// NearestResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool NearestResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool NearestResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void NearestResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& NearestResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& NearestResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.NearestResponse.stat)
+  return _internal_stat();
+}
+inline void NearestResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.NearestResponse.stat)
+}
+inline ::grpcinterface::Status* NearestResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* NearestResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.NearestResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* NearestResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* NearestResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.NearestResponse.stat)
+  return _msg;
+}
+inline void NearestResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.NearestResponse.stat)
+}
+
+// uint64 versionMajor = 2;
+inline void NearestResponse::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t NearestResponse::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t NearestResponse::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.NearestResponse.versionMajor)
+  return _internal_versionmajor();
+}
+inline void NearestResponse::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void NearestResponse::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.NearestResponse.versionMajor)
+}
+
+// uint64 versionMinor = 3;
+inline void NearestResponse::clear_versionminor() {
+  _impl_.versionminor_ = uint64_t{0u};
+}
+inline uint64_t NearestResponse::_internal_versionminor() const {
+  return _impl_.versionminor_;
+}
+inline uint64_t NearestResponse::versionminor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.NearestResponse.versionMinor)
+  return _internal_versionminor();
+}
+inline void NearestResponse::_internal_set_versionminor(uint64_t value) {
+  
+  _impl_.versionminor_ = value;
+}
+inline void NearestResponse::set_versionminor(uint64_t value) {
+  _internal_set_versionminor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.NearestResponse.versionMinor)
+}
+
+// .grpcinterface.RawPoint value = 4;
+inline bool NearestResponse::_internal_has_value() const {
+  return this != internal_default_instance() && _impl_.value_ != nullptr;
+}
+inline bool NearestResponse::has_value() const {
+  return _internal_has_value();
+}
+inline void NearestResponse::clear_value() {
+  if (GetArenaForAllocation() == nullptr && _impl_.value_ != nullptr) {
+    delete _impl_.value_;
+  }
+  _impl_.value_ = nullptr;
+}
+inline const ::grpcinterface::RawPoint& NearestResponse::_internal_value() const {
+  const ::grpcinterface::RawPoint* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::RawPoint&>(
+      ::grpcinterface::_RawPoint_default_instance_);
+}
+inline const ::grpcinterface::RawPoint& NearestResponse::value() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.NearestResponse.value)
+  return _internal_value();
+}
+inline void NearestResponse::unsafe_arena_set_allocated_value(
+    ::grpcinterface::RawPoint* value) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = value;
+  if (value) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.NearestResponse.value)
+}
+inline ::grpcinterface::RawPoint* NearestResponse::release_value() {
+  
+  ::grpcinterface::RawPoint* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::RawPoint* NearestResponse::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_release:grpcinterface.NearestResponse.value)
+  
+  ::grpcinterface::RawPoint* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::RawPoint* NearestResponse::_internal_mutable_value() {
+  
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::RawPoint>(GetArenaForAllocation());
+    _impl_.value_ = p;
+  }
+  return _impl_.value_;
+}
+inline ::grpcinterface::RawPoint* NearestResponse::mutable_value() {
+  ::grpcinterface::RawPoint* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.NearestResponse.value)
+  return _msg;
+}
+inline void NearestResponse::set_allocated_value(::grpcinterface::RawPoint* value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.value_;
+  }
+  if (value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(value);
+    if (message_arena != submessage_arena) {
+      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.value_ = value;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.NearestResponse.value)
+}
+
+// -------------------------------------------------------------------
+
+// ChangesParams
+
+// bytes uuid = 1;
+inline void ChangesParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& ChangesParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ChangesParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChangesParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.ChangesParams.uuid)
+}
+inline std::string* ChangesParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.ChangesParams.uuid)
+  return _s;
+}
+inline const std::string& ChangesParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void ChangesParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChangesParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChangesParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.ChangesParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void ChangesParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.ChangesParams.uuid)
+}
+
+// uint64 fromMajor = 2;
+inline void ChangesParams::clear_frommajor() {
+  _impl_.frommajor_ = uint64_t{0u};
+}
+inline uint64_t ChangesParams::_internal_frommajor() const {
+  return _impl_.frommajor_;
+}
+inline uint64_t ChangesParams::frommajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ChangesParams.fromMajor)
+  return _internal_frommajor();
+}
+inline void ChangesParams::_internal_set_frommajor(uint64_t value) {
+  
+  _impl_.frommajor_ = value;
+}
+inline void ChangesParams::set_frommajor(uint64_t value) {
+  _internal_set_frommajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.ChangesParams.fromMajor)
+}
+
+// uint64 toMajor = 3;
+inline void ChangesParams::clear_tomajor() {
+  _impl_.tomajor_ = uint64_t{0u};
+}
+inline uint64_t ChangesParams::_internal_tomajor() const {
+  return _impl_.tomajor_;
+}
+inline uint64_t ChangesParams::tomajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ChangesParams.toMajor)
+  return _internal_tomajor();
+}
+inline void ChangesParams::_internal_set_tomajor(uint64_t value) {
+  
+  _impl_.tomajor_ = value;
+}
+inline void ChangesParams::set_tomajor(uint64_t value) {
+  _internal_set_tomajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.ChangesParams.toMajor)
+}
+
+// uint32 resolution = 4;
+inline void ChangesParams::clear_resolution() {
+  _impl_.resolution_ = 0u;
+}
+inline uint32_t ChangesParams::_internal_resolution() const {
+  return _impl_.resolution_;
+}
+inline uint32_t ChangesParams::resolution() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ChangesParams.resolution)
+  return _internal_resolution();
+}
+inline void ChangesParams::_internal_set_resolution(uint32_t value) {
+  
+  _impl_.resolution_ = value;
+}
+inline void ChangesParams::set_resolution(uint32_t value) {
+  _internal_set_resolution(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.ChangesParams.resolution)
+}
+
+// -------------------------------------------------------------------
+
+// ChangesResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool ChangesResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool ChangesResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void ChangesResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& ChangesResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& ChangesResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ChangesResponse.stat)
+  return _internal_stat();
+}
+inline void ChangesResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.ChangesResponse.stat)
+}
+inline ::grpcinterface::Status* ChangesResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* ChangesResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.ChangesResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* ChangesResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* ChangesResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.ChangesResponse.stat)
+  return _msg;
+}
+inline void ChangesResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.ChangesResponse.stat)
+}
+
+// uint64 versionMajor = 2;
+inline void ChangesResponse::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t ChangesResponse::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t ChangesResponse::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ChangesResponse.versionMajor)
+  return _internal_versionmajor();
+}
+inline void ChangesResponse::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void ChangesResponse::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.ChangesResponse.versionMajor)
+}
+
+// uint64 versionMinor = 3;
+inline void ChangesResponse::clear_versionminor() {
+  _impl_.versionminor_ = uint64_t{0u};
+}
+inline uint64_t ChangesResponse::_internal_versionminor() const {
+  return _impl_.versionminor_;
+}
+inline uint64_t ChangesResponse::versionminor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ChangesResponse.versionMinor)
+  return _internal_versionminor();
+}
+inline void ChangesResponse::_internal_set_versionminor(uint64_t value) {
+  
+  _impl_.versionminor_ = value;
+}
+inline void ChangesResponse::set_versionminor(uint64_t value) {
+  _internal_set_versionminor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.ChangesResponse.versionMinor)
+}
+
+// repeated .grpcinterface.ChangedRange values = 4;
+inline int ChangesResponse::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int ChangesResponse::values_size() const {
+  return _internal_values_size();
+}
+inline void ChangesResponse::clear_values() {
+  _impl_.values_.Clear();
+}
+inline ::grpcinterface::ChangedRange* ChangesResponse::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.ChangesResponse.values)
+  return _impl_.values_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::ChangedRange >*
+ChangesResponse::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.ChangesResponse.values)
+  return &_impl_.values_;
+}
+inline const ::grpcinterface::ChangedRange& ChangesResponse::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const ::grpcinterface::ChangedRange& ChangesResponse::values(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ChangesResponse.values)
+  return _internal_values(index);
+}
+inline ::grpcinterface::ChangedRange* ChangesResponse::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline ::grpcinterface::ChangedRange* ChangesResponse::add_values() {
+  ::grpcinterface::ChangedRange* _add = _internal_add_values();
+  // @@protoc_insertion_point(field_add:grpcinterface.ChangesResponse.values)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::ChangedRange >&
+ChangesResponse::values() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.ChangesResponse.values)
+  return _impl_.values_;
+}
+
+// -------------------------------------------------------------------
+
+// InsertParams
+
+// bytes uuid = 1;
+inline void InsertParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& InsertParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InsertParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InsertParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.InsertParams.uuid)
+}
+inline std::string* InsertParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.InsertParams.uuid)
+  return _s;
+}
+inline const std::string& InsertParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void InsertParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InsertParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InsertParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.InsertParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void InsertParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.InsertParams.uuid)
+}
+
+// bool sync = 2;
+inline void InsertParams::clear_sync() {
+  _impl_.sync_ = false;
+}
+inline bool InsertParams::_internal_sync() const {
+  return _impl_.sync_;
+}
+inline bool InsertParams::sync() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InsertParams.sync)
+  return _internal_sync();
+}
+inline void InsertParams::_internal_set_sync(bool value) {
+  
+  _impl_.sync_ = value;
+}
+inline void InsertParams::set_sync(bool value) {
+  _internal_set_sync(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.InsertParams.sync)
+}
+
+// repeated .grpcinterface.RawPoint values = 3;
+inline int InsertParams::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int InsertParams::values_size() const {
+  return _internal_values_size();
+}
+inline void InsertParams::clear_values() {
+  _impl_.values_.Clear();
+}
+inline ::grpcinterface::RawPoint* InsertParams::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.InsertParams.values)
+  return _impl_.values_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::RawPoint >*
+InsertParams::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.InsertParams.values)
+  return &_impl_.values_;
+}
+inline const ::grpcinterface::RawPoint& InsertParams::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const ::grpcinterface::RawPoint& InsertParams::values(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InsertParams.values)
+  return _internal_values(index);
+}
+inline ::grpcinterface::RawPoint* InsertParams::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline ::grpcinterface::RawPoint* InsertParams::add_values() {
+  ::grpcinterface::RawPoint* _add = _internal_add_values();
+  // @@protoc_insertion_point(field_add:grpcinterface.InsertParams.values)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::RawPoint >&
+InsertParams::values() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.InsertParams.values)
+  return _impl_.values_;
+}
+
+// -------------------------------------------------------------------
+
+// InsertResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool InsertResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool InsertResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void InsertResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& InsertResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& InsertResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InsertResponse.stat)
+  return _internal_stat();
+}
+inline void InsertResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.InsertResponse.stat)
+}
+inline ::grpcinterface::Status* InsertResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* InsertResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.InsertResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* InsertResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* InsertResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.InsertResponse.stat)
+  return _msg;
+}
+inline void InsertResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.InsertResponse.stat)
+}
+
+// uint64 versionMajor = 2;
+inline void InsertResponse::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t InsertResponse::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t InsertResponse::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InsertResponse.versionMajor)
+  return _internal_versionmajor();
+}
+inline void InsertResponse::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void InsertResponse::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.InsertResponse.versionMajor)
+}
+
+// uint64 versionMinor = 3;
+inline void InsertResponse::clear_versionminor() {
+  _impl_.versionminor_ = uint64_t{0u};
+}
+inline uint64_t InsertResponse::_internal_versionminor() const {
+  return _impl_.versionminor_;
+}
+inline uint64_t InsertResponse::versionminor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InsertResponse.versionMinor)
+  return _internal_versionminor();
+}
+inline void InsertResponse::_internal_set_versionminor(uint64_t value) {
+  
+  _impl_.versionminor_ = value;
+}
+inline void InsertResponse::set_versionminor(uint64_t value) {
+  _internal_set_versionminor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.InsertResponse.versionMinor)
+}
+
+// -------------------------------------------------------------------
+
+// DeleteParams
+
+// bytes uuid = 1;
+inline void DeleteParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& DeleteParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.DeleteParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.DeleteParams.uuid)
+}
+inline std::string* DeleteParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.DeleteParams.uuid)
+  return _s;
+}
+inline const std::string& DeleteParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void DeleteParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.DeleteParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void DeleteParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.DeleteParams.uuid)
+}
+
+// sfixed64 start = 2;
+inline void DeleteParams::clear_start() {
+  _impl_.start_ = int64_t{0};
+}
+inline int64_t DeleteParams::_internal_start() const {
+  return _impl_.start_;
+}
+inline int64_t DeleteParams::start() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.DeleteParams.start)
+  return _internal_start();
+}
+inline void DeleteParams::_internal_set_start(int64_t value) {
+  
+  _impl_.start_ = value;
+}
+inline void DeleteParams::set_start(int64_t value) {
+  _internal_set_start(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.DeleteParams.start)
+}
+
+// sfixed64 end = 3;
+inline void DeleteParams::clear_end() {
+  _impl_.end_ = int64_t{0};
+}
+inline int64_t DeleteParams::_internal_end() const {
+  return _impl_.end_;
+}
+inline int64_t DeleteParams::end() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.DeleteParams.end)
+  return _internal_end();
+}
+inline void DeleteParams::_internal_set_end(int64_t value) {
+  
+  _impl_.end_ = value;
+}
+inline void DeleteParams::set_end(int64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.DeleteParams.end)
+}
+
+// -------------------------------------------------------------------
+
+// DeleteResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool DeleteResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool DeleteResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void DeleteResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& DeleteResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& DeleteResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.DeleteResponse.stat)
+  return _internal_stat();
+}
+inline void DeleteResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.DeleteResponse.stat)
+}
+inline ::grpcinterface::Status* DeleteResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* DeleteResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.DeleteResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* DeleteResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* DeleteResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.DeleteResponse.stat)
+  return _msg;
+}
+inline void DeleteResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.DeleteResponse.stat)
+}
+
+// uint64 versionMajor = 2;
+inline void DeleteResponse::clear_versionmajor() {
+  _impl_.versionmajor_ = uint64_t{0u};
+}
+inline uint64_t DeleteResponse::_internal_versionmajor() const {
+  return _impl_.versionmajor_;
+}
+inline uint64_t DeleteResponse::versionmajor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.DeleteResponse.versionMajor)
+  return _internal_versionmajor();
+}
+inline void DeleteResponse::_internal_set_versionmajor(uint64_t value) {
+  
+  _impl_.versionmajor_ = value;
+}
+inline void DeleteResponse::set_versionmajor(uint64_t value) {
+  _internal_set_versionmajor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.DeleteResponse.versionMajor)
+}
+
+// uint64 versionMinor = 3;
+inline void DeleteResponse::clear_versionminor() {
+  _impl_.versionminor_ = uint64_t{0u};
+}
+inline uint64_t DeleteResponse::_internal_versionminor() const {
+  return _impl_.versionminor_;
+}
+inline uint64_t DeleteResponse::versionminor() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.DeleteResponse.versionMinor)
+  return _internal_versionminor();
+}
+inline void DeleteResponse::_internal_set_versionminor(uint64_t value) {
+  
+  _impl_.versionminor_ = value;
+}
+inline void DeleteResponse::set_versionminor(uint64_t value) {
+  _internal_set_versionminor(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.DeleteResponse.versionMinor)
+}
+
+// -------------------------------------------------------------------
+
+// InfoParams
+
+// -------------------------------------------------------------------
+
+// InfoResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool InfoResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool InfoResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void InfoResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& InfoResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& InfoResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InfoResponse.stat)
+  return _internal_stat();
+}
+inline void InfoResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.InfoResponse.stat)
+}
+inline ::grpcinterface::Status* InfoResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* InfoResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.InfoResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* InfoResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* InfoResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.InfoResponse.stat)
+  return _msg;
+}
+inline void InfoResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.InfoResponse.stat)
+}
+
+// .grpcinterface.Mash mash = 2;
+inline bool InfoResponse::_internal_has_mash() const {
+  return this != internal_default_instance() && _impl_.mash_ != nullptr;
+}
+inline bool InfoResponse::has_mash() const {
+  return _internal_has_mash();
+}
+inline void InfoResponse::clear_mash() {
+  if (GetArenaForAllocation() == nullptr && _impl_.mash_ != nullptr) {
+    delete _impl_.mash_;
+  }
+  _impl_.mash_ = nullptr;
+}
+inline const ::grpcinterface::Mash& InfoResponse::_internal_mash() const {
+  const ::grpcinterface::Mash* p = _impl_.mash_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Mash&>(
+      ::grpcinterface::_Mash_default_instance_);
+}
+inline const ::grpcinterface::Mash& InfoResponse::mash() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InfoResponse.mash)
+  return _internal_mash();
+}
+inline void InfoResponse::unsafe_arena_set_allocated_mash(
+    ::grpcinterface::Mash* mash) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mash_);
+  }
+  _impl_.mash_ = mash;
+  if (mash) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.InfoResponse.mash)
+}
+inline ::grpcinterface::Mash* InfoResponse::release_mash() {
+  
+  ::grpcinterface::Mash* temp = _impl_.mash_;
+  _impl_.mash_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Mash* InfoResponse::unsafe_arena_release_mash() {
+  // @@protoc_insertion_point(field_release:grpcinterface.InfoResponse.mash)
+  
+  ::grpcinterface::Mash* temp = _impl_.mash_;
+  _impl_.mash_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Mash* InfoResponse::_internal_mutable_mash() {
+  
+  if (_impl_.mash_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Mash>(GetArenaForAllocation());
+    _impl_.mash_ = p;
+  }
+  return _impl_.mash_;
+}
+inline ::grpcinterface::Mash* InfoResponse::mutable_mash() {
+  ::grpcinterface::Mash* _msg = _internal_mutable_mash();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.InfoResponse.mash)
+  return _msg;
+}
+inline void InfoResponse::set_allocated_mash(::grpcinterface::Mash* mash) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mash_;
+  }
+  if (mash) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mash);
+    if (message_arena != submessage_arena) {
+      mash = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mash, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.mash_ = mash;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.InfoResponse.mash)
+}
+
+// uint32 majorVersion = 3;
+inline void InfoResponse::clear_majorversion() {
+  _impl_.majorversion_ = 0u;
+}
+inline uint32_t InfoResponse::_internal_majorversion() const {
+  return _impl_.majorversion_;
+}
+inline uint32_t InfoResponse::majorversion() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InfoResponse.majorVersion)
+  return _internal_majorversion();
+}
+inline void InfoResponse::_internal_set_majorversion(uint32_t value) {
+  
+  _impl_.majorversion_ = value;
+}
+inline void InfoResponse::set_majorversion(uint32_t value) {
+  _internal_set_majorversion(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.InfoResponse.majorVersion)
+}
+
+// uint32 minorVersion = 4;
+inline void InfoResponse::clear_minorversion() {
+  _impl_.minorversion_ = 0u;
+}
+inline uint32_t InfoResponse::_internal_minorversion() const {
+  return _impl_.minorversion_;
+}
+inline uint32_t InfoResponse::minorversion() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InfoResponse.minorVersion)
+  return _internal_minorversion();
+}
+inline void InfoResponse::_internal_set_minorversion(uint32_t value) {
+  
+  _impl_.minorversion_ = value;
+}
+inline void InfoResponse::set_minorversion(uint32_t value) {
+  _internal_set_minorversion(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.InfoResponse.minorVersion)
+}
+
+// string build = 5;
+inline void InfoResponse::clear_build() {
+  _impl_.build_.ClearToEmpty();
+}
+inline const std::string& InfoResponse::build() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.InfoResponse.build)
+  return _internal_build();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InfoResponse::set_build(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.build_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.InfoResponse.build)
+}
+inline std::string* InfoResponse::mutable_build() {
+  std::string* _s = _internal_mutable_build();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.InfoResponse.build)
+  return _s;
+}
+inline const std::string& InfoResponse::_internal_build() const {
+  return _impl_.build_.Get();
+}
+inline void InfoResponse::_internal_set_build(const std::string& value) {
+  
+  _impl_.build_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InfoResponse::_internal_mutable_build() {
+  
+  return _impl_.build_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InfoResponse::release_build() {
+  // @@protoc_insertion_point(field_release:grpcinterface.InfoResponse.build)
+  return _impl_.build_.Release();
+}
+inline void InfoResponse::set_allocated_build(std::string* build) {
+  if (build != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.build_.SetAllocated(build, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.build_.IsDefault()) {
+    _impl_.build_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.InfoResponse.build)
+}
+
+// -------------------------------------------------------------------
+
+// FaultInjectParams
+
+// uint64 type = 1;
+inline void FaultInjectParams::clear_type() {
+  _impl_.type_ = uint64_t{0u};
+}
+inline uint64_t FaultInjectParams::_internal_type() const {
+  return _impl_.type_;
+}
+inline uint64_t FaultInjectParams::type() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.FaultInjectParams.type)
+  return _internal_type();
+}
+inline void FaultInjectParams::_internal_set_type(uint64_t value) {
+  
+  _impl_.type_ = value;
+}
+inline void FaultInjectParams::set_type(uint64_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.FaultInjectParams.type)
+}
+
+// bytes params = 2;
+inline void FaultInjectParams::clear_params() {
+  _impl_.params_.ClearToEmpty();
+}
+inline const std::string& FaultInjectParams::params() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.FaultInjectParams.params)
+  return _internal_params();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FaultInjectParams::set_params(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.params_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.FaultInjectParams.params)
+}
+inline std::string* FaultInjectParams::mutable_params() {
+  std::string* _s = _internal_mutable_params();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.FaultInjectParams.params)
+  return _s;
+}
+inline const std::string& FaultInjectParams::_internal_params() const {
+  return _impl_.params_.Get();
+}
+inline void FaultInjectParams::_internal_set_params(const std::string& value) {
+  
+  _impl_.params_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FaultInjectParams::_internal_mutable_params() {
+  
+  return _impl_.params_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FaultInjectParams::release_params() {
+  // @@protoc_insertion_point(field_release:grpcinterface.FaultInjectParams.params)
+  return _impl_.params_.Release();
+}
+inline void FaultInjectParams::set_allocated_params(std::string* params) {
+  if (params != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.params_.SetAllocated(params, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.params_.IsDefault()) {
+    _impl_.params_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.FaultInjectParams.params)
+}
+
+// -------------------------------------------------------------------
+
+// FaultInjectResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool FaultInjectResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool FaultInjectResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void FaultInjectResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& FaultInjectResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& FaultInjectResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.FaultInjectResponse.stat)
+  return _internal_stat();
+}
+inline void FaultInjectResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.FaultInjectResponse.stat)
+}
+inline ::grpcinterface::Status* FaultInjectResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* FaultInjectResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.FaultInjectResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* FaultInjectResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* FaultInjectResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.FaultInjectResponse.stat)
+  return _msg;
+}
+inline void FaultInjectResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.FaultInjectResponse.stat)
+}
+
+// bytes rv = 2;
+inline void FaultInjectResponse::clear_rv() {
+  _impl_.rv_.ClearToEmpty();
+}
+inline const std::string& FaultInjectResponse::rv() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.FaultInjectResponse.rv)
+  return _internal_rv();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FaultInjectResponse::set_rv(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rv_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.FaultInjectResponse.rv)
+}
+inline std::string* FaultInjectResponse::mutable_rv() {
+  std::string* _s = _internal_mutable_rv();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.FaultInjectResponse.rv)
+  return _s;
+}
+inline const std::string& FaultInjectResponse::_internal_rv() const {
+  return _impl_.rv_.Get();
+}
+inline void FaultInjectResponse::_internal_set_rv(const std::string& value) {
+  
+  _impl_.rv_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FaultInjectResponse::_internal_mutable_rv() {
+  
+  return _impl_.rv_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FaultInjectResponse::release_rv() {
+  // @@protoc_insertion_point(field_release:grpcinterface.FaultInjectResponse.rv)
+  return _impl_.rv_.Release();
+}
+inline void FaultInjectResponse::set_allocated_rv(std::string* rv) {
+  if (rv != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rv_.SetAllocated(rv, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rv_.IsDefault()) {
+    _impl_.rv_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.FaultInjectResponse.rv)
+}
+
+// -------------------------------------------------------------------
+
+// FlushParams
+
+// bytes uuid = 1;
+inline void FlushParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& FlushParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.FlushParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FlushParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.FlushParams.uuid)
+}
+inline std::string* FlushParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.FlushParams.uuid)
+  return _s;
+}
+inline const std::string& FlushParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void FlushParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FlushParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FlushParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.FlushParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void FlushParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.FlushParams.uuid)
+}
+
+// -------------------------------------------------------------------
+
+// FlushResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool FlushResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool FlushResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void FlushResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& FlushResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& FlushResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.FlushResponse.stat)
+  return _internal_stat();
+}
+inline void FlushResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.FlushResponse.stat)
+}
+inline ::grpcinterface::Status* FlushResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* FlushResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.FlushResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* FlushResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* FlushResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.FlushResponse.stat)
+  return _msg;
+}
+inline void FlushResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.FlushResponse.stat)
+}
+
+// -------------------------------------------------------------------
+
+// ObliterateParams
+
+// bytes uuid = 1;
+inline void ObliterateParams::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& ObliterateParams::uuid() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ObliterateParams.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ObliterateParams::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.ObliterateParams.uuid)
+}
+inline std::string* ObliterateParams::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.ObliterateParams.uuid)
+  return _s;
+}
+inline const std::string& ObliterateParams::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void ObliterateParams::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ObliterateParams::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ObliterateParams::release_uuid() {
+  // @@protoc_insertion_point(field_release:grpcinterface.ObliterateParams.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void ObliterateParams::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.ObliterateParams.uuid)
+}
+
+// -------------------------------------------------------------------
+
+// ObliterateResponse
+
+// .grpcinterface.Status stat = 1;
+inline bool ObliterateResponse::_internal_has_stat() const {
+  return this != internal_default_instance() && _impl_.stat_ != nullptr;
+}
+inline bool ObliterateResponse::has_stat() const {
+  return _internal_has_stat();
+}
+inline void ObliterateResponse::clear_stat() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stat_ != nullptr) {
+    delete _impl_.stat_;
+  }
+  _impl_.stat_ = nullptr;
+}
+inline const ::grpcinterface::Status& ObliterateResponse::_internal_stat() const {
+  const ::grpcinterface::Status* p = _impl_.stat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Status&>(
+      ::grpcinterface::_Status_default_instance_);
+}
+inline const ::grpcinterface::Status& ObliterateResponse::stat() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ObliterateResponse.stat)
+  return _internal_stat();
+}
+inline void ObliterateResponse::unsafe_arena_set_allocated_stat(
+    ::grpcinterface::Status* stat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stat_);
+  }
+  _impl_.stat_ = stat;
+  if (stat) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.ObliterateResponse.stat)
+}
+inline ::grpcinterface::Status* ObliterateResponse::release_stat() {
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Status* ObliterateResponse::unsafe_arena_release_stat() {
+  // @@protoc_insertion_point(field_release:grpcinterface.ObliterateResponse.stat)
+  
+  ::grpcinterface::Status* temp = _impl_.stat_;
+  _impl_.stat_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Status* ObliterateResponse::_internal_mutable_stat() {
+  
+  if (_impl_.stat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Status>(GetArenaForAllocation());
+    _impl_.stat_ = p;
+  }
+  return _impl_.stat_;
+}
+inline ::grpcinterface::Status* ObliterateResponse::mutable_stat() {
+  ::grpcinterface::Status* _msg = _internal_mutable_stat();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.ObliterateResponse.stat)
+  return _msg;
+}
+inline void ObliterateResponse::set_allocated_stat(::grpcinterface::Status* stat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stat_;
+  }
+  if (stat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stat);
+    if (message_arena != submessage_arena) {
+      stat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stat, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stat_ = stat;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.ObliterateResponse.stat)
+}
+
+// -------------------------------------------------------------------
+
+// RawPoint
+
+// sfixed64 time = 1;
+inline void RawPoint::clear_time() {
+  _impl_.time_ = int64_t{0};
+}
+inline int64_t RawPoint::_internal_time() const {
+  return _impl_.time_;
+}
+inline int64_t RawPoint::time() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.RawPoint.time)
+  return _internal_time();
+}
+inline void RawPoint::_internal_set_time(int64_t value) {
+  
+  _impl_.time_ = value;
+}
+inline void RawPoint::set_time(int64_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.RawPoint.time)
+}
+
+// double value = 2;
+inline void RawPoint::clear_value() {
+  _impl_.value_ = 0;
+}
+inline double RawPoint::_internal_value() const {
+  return _impl_.value_;
+}
+inline double RawPoint::value() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.RawPoint.value)
+  return _internal_value();
+}
+inline void RawPoint::_internal_set_value(double value) {
+  
+  _impl_.value_ = value;
+}
+inline void RawPoint::set_value(double value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.RawPoint.value)
+}
+
+// -------------------------------------------------------------------
+
+// StatPoint
+
+// sfixed64 time = 1;
+inline void StatPoint::clear_time() {
+  _impl_.time_ = int64_t{0};
+}
+inline int64_t StatPoint::_internal_time() const {
+  return _impl_.time_;
+}
+inline int64_t StatPoint::time() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StatPoint.time)
+  return _internal_time();
+}
+inline void StatPoint::_internal_set_time(int64_t value) {
+  
+  _impl_.time_ = value;
+}
+inline void StatPoint::set_time(int64_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.StatPoint.time)
+}
+
+// double min = 2;
+inline void StatPoint::clear_min() {
+  _impl_.min_ = 0;
+}
+inline double StatPoint::_internal_min() const {
+  return _impl_.min_;
+}
+inline double StatPoint::min() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StatPoint.min)
+  return _internal_min();
+}
+inline void StatPoint::_internal_set_min(double value) {
+  
+  _impl_.min_ = value;
+}
+inline void StatPoint::set_min(double value) {
+  _internal_set_min(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.StatPoint.min)
+}
+
+// double mean = 3;
+inline void StatPoint::clear_mean() {
+  _impl_.mean_ = 0;
+}
+inline double StatPoint::_internal_mean() const {
+  return _impl_.mean_;
+}
+inline double StatPoint::mean() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StatPoint.mean)
+  return _internal_mean();
+}
+inline void StatPoint::_internal_set_mean(double value) {
+  
+  _impl_.mean_ = value;
+}
+inline void StatPoint::set_mean(double value) {
+  _internal_set_mean(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.StatPoint.mean)
+}
+
+// double max = 4;
+inline void StatPoint::clear_max() {
+  _impl_.max_ = 0;
+}
+inline double StatPoint::_internal_max() const {
+  return _impl_.max_;
+}
+inline double StatPoint::max() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StatPoint.max)
+  return _internal_max();
+}
+inline void StatPoint::_internal_set_max(double value) {
+  
+  _impl_.max_ = value;
+}
+inline void StatPoint::set_max(double value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.StatPoint.max)
+}
+
+// fixed64 count = 5;
+inline void StatPoint::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t StatPoint::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t StatPoint::count() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.StatPoint.count)
+  return _internal_count();
+}
+inline void StatPoint::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void StatPoint::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.StatPoint.count)
+}
+
+// -------------------------------------------------------------------
+
+// ChangedRange
+
+// sfixed64 start = 1;
+inline void ChangedRange::clear_start() {
+  _impl_.start_ = int64_t{0};
+}
+inline int64_t ChangedRange::_internal_start() const {
+  return _impl_.start_;
+}
+inline int64_t ChangedRange::start() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ChangedRange.start)
+  return _internal_start();
+}
+inline void ChangedRange::_internal_set_start(int64_t value) {
+  
+  _impl_.start_ = value;
+}
+inline void ChangedRange::set_start(int64_t value) {
+  _internal_set_start(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.ChangedRange.start)
+}
+
+// sfixed64 end = 2;
+inline void ChangedRange::clear_end() {
+  _impl_.end_ = int64_t{0};
+}
+inline int64_t ChangedRange::_internal_end() const {
+  return _impl_.end_;
+}
+inline int64_t ChangedRange::end() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.ChangedRange.end)
+  return _internal_end();
+}
+inline void ChangedRange::_internal_set_end(int64_t value) {
+  
+  _impl_.end_ = value;
+}
+inline void ChangedRange::set_end(int64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.ChangedRange.end)
+}
+
+// -------------------------------------------------------------------
+
+// Status
+
+// uint32 code = 1;
+inline void Status::clear_code() {
+  _impl_.code_ = 0u;
+}
+inline uint32_t Status::_internal_code() const {
+  return _impl_.code_;
+}
+inline uint32_t Status::code() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Status.code)
+  return _internal_code();
+}
+inline void Status::_internal_set_code(uint32_t value) {
+  
+  _impl_.code_ = value;
+}
+inline void Status::set_code(uint32_t value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Status.code)
+}
+
+// string msg = 2;
+inline void Status::clear_msg() {
+  _impl_.msg_.ClearToEmpty();
+}
+inline const std::string& Status::msg() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Status.msg)
+  return _internal_msg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Status::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.Status.msg)
+}
+inline std::string* Status::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.Status.msg)
+  return _s;
+}
+inline const std::string& Status::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void Status::_internal_set_msg(const std::string& value) {
+  
+  _impl_.msg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Status::_internal_mutable_msg() {
+  
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Status::release_msg() {
+  // @@protoc_insertion_point(field_release:grpcinterface.Status.msg)
+  return _impl_.msg_.Release();
+}
+inline void Status::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.Status.msg)
+}
+
+// .grpcinterface.Mash mash = 3;
+inline bool Status::_internal_has_mash() const {
+  return this != internal_default_instance() && _impl_.mash_ != nullptr;
+}
+inline bool Status::has_mash() const {
+  return _internal_has_mash();
+}
+inline void Status::clear_mash() {
+  if (GetArenaForAllocation() == nullptr && _impl_.mash_ != nullptr) {
+    delete _impl_.mash_;
+  }
+  _impl_.mash_ = nullptr;
+}
+inline const ::grpcinterface::Mash& Status::_internal_mash() const {
+  const ::grpcinterface::Mash* p = _impl_.mash_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::Mash&>(
+      ::grpcinterface::_Mash_default_instance_);
+}
+inline const ::grpcinterface::Mash& Status::mash() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Status.mash)
+  return _internal_mash();
+}
+inline void Status::unsafe_arena_set_allocated_mash(
+    ::grpcinterface::Mash* mash) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mash_);
+  }
+  _impl_.mash_ = mash;
+  if (mash) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.Status.mash)
+}
+inline ::grpcinterface::Mash* Status::release_mash() {
+  
+  ::grpcinterface::Mash* temp = _impl_.mash_;
+  _impl_.mash_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::Mash* Status::unsafe_arena_release_mash() {
+  // @@protoc_insertion_point(field_release:grpcinterface.Status.mash)
+  
+  ::grpcinterface::Mash* temp = _impl_.mash_;
+  _impl_.mash_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::Mash* Status::_internal_mutable_mash() {
+  
+  if (_impl_.mash_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::Mash>(GetArenaForAllocation());
+    _impl_.mash_ = p;
+  }
+  return _impl_.mash_;
+}
+inline ::grpcinterface::Mash* Status::mutable_mash() {
+  ::grpcinterface::Mash* _msg = _internal_mutable_mash();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.Status.mash)
+  return _msg;
+}
+inline void Status::set_allocated_mash(::grpcinterface::Mash* mash) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mash_;
+  }
+  if (mash) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mash);
+    if (message_arena != submessage_arena) {
+      mash = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mash, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.mash_ = mash;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.Status.mash)
+}
+
+// -------------------------------------------------------------------
+
+// Mash
+
+// int64 revision = 1;
+inline void Mash::clear_revision() {
+  _impl_.revision_ = int64_t{0};
+}
+inline int64_t Mash::_internal_revision() const {
+  return _impl_.revision_;
+}
+inline int64_t Mash::revision() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Mash.revision)
+  return _internal_revision();
+}
+inline void Mash::_internal_set_revision(int64_t value) {
+  
+  _impl_.revision_ = value;
+}
+inline void Mash::set_revision(int64_t value) {
+  _internal_set_revision(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Mash.revision)
+}
+
+// string leader = 2;
+inline void Mash::clear_leader() {
+  _impl_.leader_.ClearToEmpty();
+}
+inline const std::string& Mash::leader() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Mash.leader)
+  return _internal_leader();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Mash::set_leader(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.Mash.leader)
+}
+inline std::string* Mash::mutable_leader() {
+  std::string* _s = _internal_mutable_leader();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.Mash.leader)
+  return _s;
+}
+inline const std::string& Mash::_internal_leader() const {
+  return _impl_.leader_.Get();
+}
+inline void Mash::_internal_set_leader(const std::string& value) {
+  
+  _impl_.leader_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Mash::_internal_mutable_leader() {
+  
+  return _impl_.leader_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Mash::release_leader() {
+  // @@protoc_insertion_point(field_release:grpcinterface.Mash.leader)
+  return _impl_.leader_.Release();
+}
+inline void Mash::set_allocated_leader(std::string* leader) {
+  if (leader != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_.SetAllocated(leader, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_.IsDefault()) {
+    _impl_.leader_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.Mash.leader)
+}
+
+// int64 leaderRevision = 3;
+inline void Mash::clear_leaderrevision() {
+  _impl_.leaderrevision_ = int64_t{0};
+}
+inline int64_t Mash::_internal_leaderrevision() const {
+  return _impl_.leaderrevision_;
+}
+inline int64_t Mash::leaderrevision() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Mash.leaderRevision)
+  return _internal_leaderrevision();
+}
+inline void Mash::_internal_set_leaderrevision(int64_t value) {
+  
+  _impl_.leaderrevision_ = value;
+}
+inline void Mash::set_leaderrevision(int64_t value) {
+  _internal_set_leaderrevision(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Mash.leaderRevision)
+}
+
+// int64 totalWeight = 4;
+inline void Mash::clear_totalweight() {
+  _impl_.totalweight_ = int64_t{0};
+}
+inline int64_t Mash::_internal_totalweight() const {
+  return _impl_.totalweight_;
+}
+inline int64_t Mash::totalweight() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Mash.totalWeight)
+  return _internal_totalweight();
+}
+inline void Mash::_internal_set_totalweight(int64_t value) {
+  
+  _impl_.totalweight_ = value;
+}
+inline void Mash::set_totalweight(int64_t value) {
+  _internal_set_totalweight(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Mash.totalWeight)
+}
+
+// bool healthy = 5;
+inline void Mash::clear_healthy() {
+  _impl_.healthy_ = false;
+}
+inline bool Mash::_internal_healthy() const {
+  return _impl_.healthy_;
+}
+inline bool Mash::healthy() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Mash.healthy)
+  return _internal_healthy();
+}
+inline void Mash::_internal_set_healthy(bool value) {
+  
+  _impl_.healthy_ = value;
+}
+inline void Mash::set_healthy(bool value) {
+  _internal_set_healthy(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Mash.healthy)
+}
+
+// double unmapped = 6;
+inline void Mash::clear_unmapped() {
+  _impl_.unmapped_ = 0;
+}
+inline double Mash::_internal_unmapped() const {
+  return _impl_.unmapped_;
+}
+inline double Mash::unmapped() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Mash.unmapped)
+  return _internal_unmapped();
+}
+inline void Mash::_internal_set_unmapped(double value) {
+  
+  _impl_.unmapped_ = value;
+}
+inline void Mash::set_unmapped(double value) {
+  _internal_set_unmapped(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Mash.unmapped)
+}
+
+// repeated .grpcinterface.Member members = 7;
+inline int Mash::_internal_members_size() const {
+  return _impl_.members_.size();
+}
+inline int Mash::members_size() const {
+  return _internal_members_size();
+}
+inline void Mash::clear_members() {
+  _impl_.members_.Clear();
+}
+inline ::grpcinterface::Member* Mash::mutable_members(int index) {
+  // @@protoc_insertion_point(field_mutable:grpcinterface.Mash.members)
+  return _impl_.members_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::Member >*
+Mash::mutable_members() {
+  // @@protoc_insertion_point(field_mutable_list:grpcinterface.Mash.members)
+  return &_impl_.members_;
+}
+inline const ::grpcinterface::Member& Mash::_internal_members(int index) const {
+  return _impl_.members_.Get(index);
+}
+inline const ::grpcinterface::Member& Mash::members(int index) const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Mash.members)
+  return _internal_members(index);
+}
+inline ::grpcinterface::Member* Mash::_internal_add_members() {
+  return _impl_.members_.Add();
+}
+inline ::grpcinterface::Member* Mash::add_members() {
+  ::grpcinterface::Member* _add = _internal_add_members();
+  // @@protoc_insertion_point(field_add:grpcinterface.Mash.members)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::grpcinterface::Member >&
+Mash::members() const {
+  // @@protoc_insertion_point(field_list:grpcinterface.Mash.members)
+  return _impl_.members_;
+}
+
+// -------------------------------------------------------------------
+
+// Member
+
+// uint32 hash = 1;
+inline void Member::clear_hash() {
+  _impl_.hash_ = 0u;
+}
+inline uint32_t Member::_internal_hash() const {
+  return _impl_.hash_;
+}
+inline uint32_t Member::hash() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.hash)
+  return _internal_hash();
+}
+inline void Member::_internal_set_hash(uint32_t value) {
+  
+  _impl_.hash_ = value;
+}
+inline void Member::set_hash(uint32_t value) {
+  _internal_set_hash(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.hash)
+}
+
+// string nodename = 2;
+inline void Member::clear_nodename() {
+  _impl_.nodename_.ClearToEmpty();
+}
+inline const std::string& Member::nodename() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.nodename)
+  return _internal_nodename();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Member::set_nodename(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.nodename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.nodename)
+}
+inline std::string* Member::mutable_nodename() {
+  std::string* _s = _internal_mutable_nodename();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.Member.nodename)
+  return _s;
+}
+inline const std::string& Member::_internal_nodename() const {
+  return _impl_.nodename_.Get();
+}
+inline void Member::_internal_set_nodename(const std::string& value) {
+  
+  _impl_.nodename_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Member::_internal_mutable_nodename() {
+  
+  return _impl_.nodename_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Member::release_nodename() {
+  // @@protoc_insertion_point(field_release:grpcinterface.Member.nodename)
+  return _impl_.nodename_.Release();
+}
+inline void Member::set_allocated_nodename(std::string* nodename) {
+  if (nodename != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.nodename_.SetAllocated(nodename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nodename_.IsDefault()) {
+    _impl_.nodename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.Member.nodename)
+}
+
+// bool up = 3;
+inline void Member::clear_up() {
+  _impl_.up_ = false;
+}
+inline bool Member::_internal_up() const {
+  return _impl_.up_;
+}
+inline bool Member::up() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.up)
+  return _internal_up();
+}
+inline void Member::_internal_set_up(bool value) {
+  
+  _impl_.up_ = value;
+}
+inline void Member::set_up(bool value) {
+  _internal_set_up(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.up)
+}
+
+// bool in = 4;
+inline void Member::clear_in() {
+  _impl_.in_ = false;
+}
+inline bool Member::_internal_in() const {
+  return _impl_.in_;
+}
+inline bool Member::in() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.in)
+  return _internal_in();
+}
+inline void Member::_internal_set_in(bool value) {
+  
+  _impl_.in_ = value;
+}
+inline void Member::set_in(bool value) {
+  _internal_set_in(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.in)
+}
+
+// bool enabled = 5;
+inline void Member::clear_enabled() {
+  _impl_.enabled_ = false;
+}
+inline bool Member::_internal_enabled() const {
+  return _impl_.enabled_;
+}
+inline bool Member::enabled() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.enabled)
+  return _internal_enabled();
+}
+inline void Member::_internal_set_enabled(bool value) {
+  
+  _impl_.enabled_ = value;
+}
+inline void Member::set_enabled(bool value) {
+  _internal_set_enabled(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.enabled)
+}
+
+// int64 start = 6;
+inline void Member::clear_start() {
+  _impl_.start_ = int64_t{0};
+}
+inline int64_t Member::_internal_start() const {
+  return _impl_.start_;
+}
+inline int64_t Member::start() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.start)
+  return _internal_start();
+}
+inline void Member::_internal_set_start(int64_t value) {
+  
+  _impl_.start_ = value;
+}
+inline void Member::set_start(int64_t value) {
+  _internal_set_start(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.start)
+}
+
+// int64 end = 7;
+inline void Member::clear_end() {
+  _impl_.end_ = int64_t{0};
+}
+inline int64_t Member::_internal_end() const {
+  return _impl_.end_;
+}
+inline int64_t Member::end() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.end)
+  return _internal_end();
+}
+inline void Member::_internal_set_end(int64_t value) {
+  
+  _impl_.end_ = value;
+}
+inline void Member::set_end(int64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.end)
+}
+
+// int64 weight = 8;
+inline void Member::clear_weight() {
+  _impl_.weight_ = int64_t{0};
+}
+inline int64_t Member::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline int64_t Member::weight() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.weight)
+  return _internal_weight();
+}
+inline void Member::_internal_set_weight(int64_t value) {
+  
+  _impl_.weight_ = value;
+}
+inline void Member::set_weight(int64_t value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.weight)
+}
+
+// double readPreference = 9;
+inline void Member::clear_readpreference() {
+  _impl_.readpreference_ = 0;
+}
+inline double Member::_internal_readpreference() const {
+  return _impl_.readpreference_;
+}
+inline double Member::readpreference() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.readPreference)
+  return _internal_readpreference();
+}
+inline void Member::_internal_set_readpreference(double value) {
+  
+  _impl_.readpreference_ = value;
+}
+inline void Member::set_readpreference(double value) {
+  _internal_set_readpreference(value);
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.readPreference)
+}
+
+// string httpEndpoints = 10;
+inline void Member::clear_httpendpoints() {
+  _impl_.httpendpoints_.ClearToEmpty();
+}
+inline const std::string& Member::httpendpoints() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.httpEndpoints)
+  return _internal_httpendpoints();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Member::set_httpendpoints(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.httpendpoints_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.httpEndpoints)
+}
+inline std::string* Member::mutable_httpendpoints() {
+  std::string* _s = _internal_mutable_httpendpoints();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.Member.httpEndpoints)
+  return _s;
+}
+inline const std::string& Member::_internal_httpendpoints() const {
+  return _impl_.httpendpoints_.Get();
+}
+inline void Member::_internal_set_httpendpoints(const std::string& value) {
+  
+  _impl_.httpendpoints_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Member::_internal_mutable_httpendpoints() {
+  
+  return _impl_.httpendpoints_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Member::release_httpendpoints() {
+  // @@protoc_insertion_point(field_release:grpcinterface.Member.httpEndpoints)
+  return _impl_.httpendpoints_.Release();
+}
+inline void Member::set_allocated_httpendpoints(std::string* httpendpoints) {
+  if (httpendpoints != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.httpendpoints_.SetAllocated(httpendpoints, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.httpendpoints_.IsDefault()) {
+    _impl_.httpendpoints_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.Member.httpEndpoints)
+}
+
+// string grpcEndpoints = 11;
+inline void Member::clear_grpcendpoints() {
+  _impl_.grpcendpoints_.ClearToEmpty();
+}
+inline const std::string& Member::grpcendpoints() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.Member.grpcEndpoints)
+  return _internal_grpcendpoints();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Member::set_grpcendpoints(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.grpcendpoints_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.Member.grpcEndpoints)
+}
+inline std::string* Member::mutable_grpcendpoints() {
+  std::string* _s = _internal_mutable_grpcendpoints();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.Member.grpcEndpoints)
+  return _s;
+}
+inline const std::string& Member::_internal_grpcendpoints() const {
+  return _impl_.grpcendpoints_.Get();
+}
+inline void Member::_internal_set_grpcendpoints(const std::string& value) {
+  
+  _impl_.grpcendpoints_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Member::_internal_mutable_grpcendpoints() {
+  
+  return _impl_.grpcendpoints_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Member::release_grpcendpoints() {
+  // @@protoc_insertion_point(field_release:grpcinterface.Member.grpcEndpoints)
+  return _impl_.grpcendpoints_.Release();
+}
+inline void Member::set_allocated_grpcendpoints(std::string* grpcendpoints) {
+  if (grpcendpoints != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.grpcendpoints_.SetAllocated(grpcendpoints, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.grpcendpoints_.IsDefault()) {
+    _impl_.grpcendpoints_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.Member.grpcEndpoints)
+}
+
+// -------------------------------------------------------------------
+
+// KeyOptValue
+
+// string key = 1;
+inline void KeyOptValue::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& KeyOptValue::key() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.KeyOptValue.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyOptValue::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.KeyOptValue.key)
+}
+inline std::string* KeyOptValue::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.KeyOptValue.key)
+  return _s;
+}
+inline const std::string& KeyOptValue::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void KeyOptValue::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyOptValue::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyOptValue::release_key() {
+  // @@protoc_insertion_point(field_release:grpcinterface.KeyOptValue.key)
+  return _impl_.key_.Release();
+}
+inline void KeyOptValue::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.KeyOptValue.key)
+}
+
+// .grpcinterface.OptValue val = 2;
+inline bool KeyOptValue::_internal_has_val() const {
+  return this != internal_default_instance() && _impl_.val_ != nullptr;
+}
+inline bool KeyOptValue::has_val() const {
+  return _internal_has_val();
+}
+inline void KeyOptValue::clear_val() {
+  if (GetArenaForAllocation() == nullptr && _impl_.val_ != nullptr) {
+    delete _impl_.val_;
+  }
+  _impl_.val_ = nullptr;
+}
+inline const ::grpcinterface::OptValue& KeyOptValue::_internal_val() const {
+  const ::grpcinterface::OptValue* p = _impl_.val_;
+  return p != nullptr ? *p : reinterpret_cast<const ::grpcinterface::OptValue&>(
+      ::grpcinterface::_OptValue_default_instance_);
+}
+inline const ::grpcinterface::OptValue& KeyOptValue::val() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.KeyOptValue.val)
+  return _internal_val();
+}
+inline void KeyOptValue::unsafe_arena_set_allocated_val(
+    ::grpcinterface::OptValue* val) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.val_);
+  }
+  _impl_.val_ = val;
+  if (val) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:grpcinterface.KeyOptValue.val)
+}
+inline ::grpcinterface::OptValue* KeyOptValue::release_val() {
+  
+  ::grpcinterface::OptValue* temp = _impl_.val_;
+  _impl_.val_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::grpcinterface::OptValue* KeyOptValue::unsafe_arena_release_val() {
+  // @@protoc_insertion_point(field_release:grpcinterface.KeyOptValue.val)
+  
+  ::grpcinterface::OptValue* temp = _impl_.val_;
+  _impl_.val_ = nullptr;
+  return temp;
+}
+inline ::grpcinterface::OptValue* KeyOptValue::_internal_mutable_val() {
+  
+  if (_impl_.val_ == nullptr) {
+    auto* p = CreateMaybeMessage<::grpcinterface::OptValue>(GetArenaForAllocation());
+    _impl_.val_ = p;
+  }
+  return _impl_.val_;
+}
+inline ::grpcinterface::OptValue* KeyOptValue::mutable_val() {
+  ::grpcinterface::OptValue* _msg = _internal_mutable_val();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.KeyOptValue.val)
+  return _msg;
+}
+inline void KeyOptValue::set_allocated_val(::grpcinterface::OptValue* val) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.val_;
+  }
+  if (val) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(val);
+    if (message_arena != submessage_arena) {
+      val = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, val, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.val_ = val;
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.KeyOptValue.val)
+}
+
+// -------------------------------------------------------------------
+
+// OptValue
+
+// bytes value = 1;
+inline void OptValue::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& OptValue::value() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.OptValue.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OptValue::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.OptValue.value)
+}
+inline std::string* OptValue::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.OptValue.value)
+  return _s;
+}
+inline const std::string& OptValue::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void OptValue::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OptValue::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OptValue::release_value() {
+  // @@protoc_insertion_point(field_release:grpcinterface.OptValue.value)
+  return _impl_.value_.Release();
+}
+inline void OptValue::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.OptValue.value)
+}
+
+// -------------------------------------------------------------------
+
+// KeyValue
+
+// string key = 1;
+inline void KeyValue::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& KeyValue::key() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.KeyValue.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.KeyValue.key)
+}
+inline std::string* KeyValue::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.KeyValue.key)
+  return _s;
+}
+inline const std::string& KeyValue::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void KeyValue::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyValue::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyValue::release_key() {
+  // @@protoc_insertion_point(field_release:grpcinterface.KeyValue.key)
+  return _impl_.key_.Release();
+}
+inline void KeyValue::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.KeyValue.key)
+}
+
+// bytes value = 2;
+inline void KeyValue::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& KeyValue::value() const {
+  // @@protoc_insertion_point(field_get:grpcinterface.KeyValue.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:grpcinterface.KeyValue.value)
+}
+inline std::string* KeyValue::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:grpcinterface.KeyValue.value)
+  return _s;
+}
+inline const std::string& KeyValue::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void KeyValue::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyValue::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyValue::release_value() {
+  // @@protoc_insertion_point(field_release:grpcinterface.KeyValue.value)
+  return _impl_.value_.Release();
+}
+inline void KeyValue::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:grpcinterface.KeyValue.value)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace grpcinterface
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_btrdb_2eproto
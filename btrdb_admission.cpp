@@ -0,0 +1,180 @@
+#include "btrdb_admission.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace btrdb {
+    AdmissionQueue::AdmissionQueue(const AdmissionOptions& options)
+        : options_(options), closed_(false), starting_(0), in_flight_(0) {
+        if (this->options_.batch_max_in_flight == 0 || this->options_.batch_max_in_flight > this->options_.max_in_flight) {
+            this->options_.batch_max_in_flight = this->options_.max_in_flight;
+        }
+    }
+
+    AdmissionQueue::lane& AdmissionQueue::laneFor(Priority priority) {
+        return priority == Priority::Batch ? this->batch_ : this->interactive_;
+    }
+
+    bool AdmissionQueue::hasRoom(Priority priority) const {
+        if (this->in_flight_ >= this->options_.max_in_flight) {
+            return false;
+        }
+        return priority != Priority::Batch || this->batch_.stats.in_flight < this->options_.batch_max_in_flight;
+    }
+
+    void AdmissionQueue::admitted(lane& l, std::chrono::steady_clock::time_point submitted) {
+        auto waited = std::chrono::steady_clock::now() - submitted;
+        std::uint64_t wait_us = std::chrono::duration_cast<std::chrono::microseconds>(waited).count();
+        this->in_flight_++;
+        l.stats.in_flight++;
+        l.stats.admitted++;
+        l.stats.total_wait_us += wait_us;
+        l.stats.max_wait_us = std::max(l.stats.max_wait_us, wait_us);
+    }
+
+    bool AdmissionQueue::popNext(lane& l, waiter* w) {
+        if (l.turns.empty()) {
+            return false;
+        }
+
+        std::uint64_t caller = l.turns.front();
+        l.turns.pop_front();
+        std::deque<waiter>& fifo = l.callers[caller];
+        *w = std::move(fifo.front());
+        fifo.pop_front();
+        if (fifo.empty()) {
+            l.callers.erase(caller);
+        } else {
+            /* Back of the line for this caller's next RPC. */
+            l.turns.push_back(caller);
+        }
+        l.stats.queued--;
+        return true;
+    }
+
+    void AdmissionQueue::submit(const RequestClass& request_class, std::function<void(bool)> start) {
+        auto now = std::chrono::steady_clock::now();
+        bool open;
+        {
+            std::lock_guard<std::mutex> lock(this->lock_);
+            open = !this->closed_;
+            lane& l = this->laneFor(request_class.priority);
+            bool others_waiting = !l.turns.empty() || (request_class.priority == Priority::Batch && !this->interactive_.turns.empty());
+            if (open && (others_waiting || !this->hasRoom(request_class.priority))) {
+                std::deque<waiter>& fifo = l.callers[request_class.caller];
+                if (fifo.empty()) {
+                    l.turns.push_back(request_class.caller);
+                }
+                fifo.push_back({ std::move(start), now });
+                l.stats.queued++;
+                return;
+            }
+            if (open) {
+                this->admitted(l, now);
+            }
+        }
+
+        start(open);
+    }
+
+    Status AdmissionQueue::acquire(const RequestClass& request_class, std::chrono::system_clock::time_point deadline) {
+        /* Shared with the start callback, which may run after we have given up. */
+        struct wait {
+            std::mutex lock;
+            std::condition_variable cv;
+            bool done = false;
+            bool admitted = false;
+            bool abandoned = false;
+        };
+        std::shared_ptr<wait> w = std::make_shared<wait>();
+        Priority priority = request_class.priority;
+        this->submit(request_class, [this, w, priority](bool admitted) {
+            {
+                std::lock_guard<std::mutex> lock(w->lock);
+                if (!w->abandoned) {
+                    w->admitted = admitted;
+                    w->done = true;
+                    w->cv.notify_one();
+                    return;
+                }
+            }
+            /* The caller timed out, so hand the slot straight back. */
+            if (admitted) {
+                this->release(priority);
+            }
+        });
+
+        std::unique_lock<std::mutex> lock(w->lock);
+        if (deadline == std::chrono::system_clock::time_point::max()) {
+            w->cv.wait(lock, [&w]() { return w->done; });
+        } else if (!w->cv.wait_until(lock, deadline, [&w]() { return w->done; })) {
+            w->abandoned = true;
+            return Status(grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, "Deadline exceeded while waiting for admission"));
+        }
+        return w->admitted ? Status() : Status::Disconnected;
+    }
+
+    void AdmissionQueue::release(Priority priority) {
+        /* Start as many queued RPCs as there is now room for, after letting go of the lock. */
+        std::vector<waiter> ready;
+        {
+            std::lock_guard<std::mutex> lock(this->lock_);
+            this->in_flight_--;
+            this->laneFor(priority).stats.in_flight--;
+            if (this->closed_) {
+                return;
+            }
+
+            waiter w;
+            while (this->hasRoom(Priority::Interactive) && this->popNext(this->interactive_, &w)) {
+                this->admitted(this->interactive_, w.submitted);
+                ready.push_back(std::move(w));
+            }
+            while (this->interactive_.turns.empty() && this->hasRoom(Priority::Batch) && this->popNext(this->batch_, &w)) {
+                this->admitted(this->batch_, w.submitted);
+                ready.push_back(std::move(w));
+            }
+            if (ready.empty()) {
+                return;
+            }
+            this->starting_++;
+        }
+
+        for (waiter& w : ready) {
+            w.start(true);
+        }
+
+        std::lock_guard<std::mutex> lock(this->lock_);
+        if (--this->starting_ == 0) {
+            this->started_.notify_all();
+        }
+    }
+
+    void AdmissionQueue::close() {
+        std::vector<waiter> failed;
+        {
+            std::unique_lock<std::mutex> lock(this->lock_);
+            this->closed_ = true;
+            this->started_.wait(lock, [this]() { return this->starting_ == 0; });
+            waiter w;
+            while (this->popNext(this->interactive_, &w)) {
+                failed.push_back(std::move(w));
+            }
+            while (this->popNext(this->batch_, &w)) {
+                failed.push_back(std::move(w));
+            }
+        }
+        for (waiter& f : failed) {
+            f.start(false);
+        }
+    }
+
+    AdmissionStats AdmissionQueue::stats() {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        AdmissionStats stats;
+        stats.interactive = this->interactive_.stats;
+        stats.batch = this->batch_.stats;
+        return stats;
+    }
+}
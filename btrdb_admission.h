@@ -0,0 +1,105 @@
+#ifndef BTRDB_ADMISSION_H_
+#define BTRDB_ADMISSION_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+
+#include "btrdb_util.h"
+
+namespace btrdb {
+    /*
+     * Limits on RPCs in flight to each member. RPCs beyond the limit wait
+     * in the client: Interactive ones are started before Batch ones, and
+     * callers within a priority take turns, so one caller's backlog does
+     * not delay everyone else.
+     */
+    struct AdmissionOptions {
+        /* RPCs in flight per member (0 for no limit and no queueing). */
+        std::uint32_t max_in_flight = 0;
+        /*
+         * Batch RPCs in flight per member, at most (0 for max_in_flight).
+         * Keeping this below max_in_flight leaves room for interactive RPCs
+         * that arrive while a batch backlog is being worked through.
+         */
+        std::uint32_t batch_max_in_flight = 0;
+    };
+
+    /* Counters for one priority. Wait times are from submission until the RPC is started. */
+    struct AdmissionClassStats {
+        std::uint32_t in_flight = 0;
+        std::size_t queued = 0;
+        std::uint64_t admitted = 0;
+        std::uint64_t total_wait_us = 0;
+        std::uint64_t max_wait_us = 0;
+    };
+
+    struct AdmissionStats {
+        AdmissionClassStats interactive;
+        AdmissionClassStats batch;
+    };
+
+    /* The scheduler for one Endpoint. */
+    class AdmissionQueue {
+    public:
+        explicit AdmissionQueue(const AdmissionOptions& options);
+
+        /*
+         * Calls start(true) once the RPC may begin, possibly right away on
+         * this thread; the caller must then call release() when it ends.
+         * If the queue is closed first, start(false) is called instead.
+         */
+        void submit(const RequestClass& request_class, std::function<void(bool)> start);
+        /*
+         * Blocks until the RPC may begin, or until deadline; fails with
+         * DEADLINE_EXCEEDED in the latter case, and with Disconnected if the
+         * queue was closed.
+         */
+        Status acquire(const RequestClass& request_class, std::chrono::system_clock::time_point deadline);
+        void release(Priority priority);
+
+        /*
+         * Fails everything still queued; no further RPCs are started. Waits
+         * for the RPCs that release() is starting, so that none of them
+         * uses the Endpoint once this returns.
+         */
+        void close();
+
+        AdmissionStats stats();
+
+    private:
+        struct waiter {
+            std::function<void(bool)> start;
+            std::chrono::steady_clock::time_point submitted;
+        };
+
+        /* The queued RPCs of one priority, one FIFO per caller, served round-robin. */
+        struct lane {
+            std::map<std::uint64_t, std::deque<waiter>> callers;
+            std::deque<std::uint64_t> turns;
+            AdmissionClassStats stats;
+        };
+
+        lane& laneFor(Priority priority);
+        bool hasRoom(Priority priority) const;
+        void admitted(lane& l, std::chrono::steady_clock::time_point submitted);
+        bool popNext(lane& l, waiter* w);
+
+        AdmissionOptions options_;
+        std::mutex lock_;
+        /* Signalled when starting_ drops to zero. */
+        std::condition_variable started_;
+        bool closed_;
+        /* Queued RPCs that release() has admitted and is starting without the lock. */
+        std::uint32_t starting_;
+        std::uint32_t in_flight_;
+        lane interactive_;
+        lane batch_;
+    };
+}
+
+#endif // BTRDB_ADMISSION_H_
@@ -0,0 +1,99 @@
+#include "btrdb_breaker.h"
+
+namespace btrdb {
+    CircuitBreaker::CircuitBreaker(const BreakerOptions& options)
+        : options_(options), open_(false), probing_(false) {
+        if (this->options_.window == 0) {
+            this->options_.window = 1;
+        }
+        this->reset();
+    }
+
+    bool CircuitBreaker::allow(bool* probe) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        *probe = false;
+        if (!this->open_) {
+            return true;
+        }
+        if (!this->probing_ && std::chrono::steady_clock::now() - this->opened_ >= std::chrono::milliseconds(this->options_.open_ms)) {
+            this->probing_ = true;
+            *probe = true;
+        }
+        return false;
+    }
+
+    void CircuitBreaker::probed(bool healthy) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        this->probing_ = false;
+        if (healthy) {
+            this->open_ = false;
+            this->reset();
+        } else {
+            this->opened_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    void CircuitBreaker::record(bool failed) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        if (this->open_) {
+            return;
+        }
+
+        if (this->outcomes_.size() < this->options_.window) {
+            this->outcomes_.push_back(failed);
+        } else {
+            if (this->outcomes_[this->next_outcome_]) {
+                this->failures_--;
+            }
+            this->outcomes_[this->next_outcome_] = failed;
+            this->next_outcome_ = (this->next_outcome_ + 1) % this->outcomes_.size();
+        }
+        if (failed) {
+            this->failures_++;
+            this->consecutive_++;
+        } else {
+            this->consecutive_ = 0;
+        }
+
+        bool too_many_in_a_row = this->options_.consecutive_errors != 0 && this->consecutive_ >= this->options_.consecutive_errors;
+        bool too_many_in_window = this->outcomes_.size() >= this->options_.min_requests &&
+                                  this->failures_ >= this->options_.error_ratio * this->outcomes_.size();
+        if (failed && (too_many_in_a_row || too_many_in_window)) {
+            this->trip();
+        }
+    }
+
+    void CircuitBreaker::recordLatency(std::uint64_t latency_us) {
+        if (this->options_.eject_latency_us == 0) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(this->lock_);
+        if (this->open_) {
+            return;
+        }
+        if (this->latency_samples_ == 0) {
+            this->latency_us_ = latency_us;
+        } else {
+            this->latency_us_ = this->latency_us_ - (this->latency_us_ >> 3) + (latency_us >> 3);
+        }
+        this->latency_samples_++;
+        if (this->latency_samples_ >= this->options_.min_requests && this->latency_us_ > this->options_.eject_latency_us) {
+            this->trip();
+        }
+    }
+
+    void CircuitBreaker::trip() {
+        this->open_ = true;
+        this->opened_ = std::chrono::steady_clock::now();
+    }
+
+    void CircuitBreaker::reset() {
+        this->outcomes_.clear();
+        this->next_outcome_ = 0;
+        this->failures_ = 0;
+        this->consecutive_ = 0;
+        this->latency_us_ = 0;
+        this->latency_samples_ = 0;
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef BTRDB_BREAKER_H_
+#define BTRDB_BREAKER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace btrdb {
+    /*
+     * When to stop sending requests to a member that looks unhealthy.
+     * While the breaker is open, requests go to another of the member's
+     * addresses if it is healthy, and otherwise fail at once with
+     * Status::Unhealthy. After open_ms, an Info request probes the member
+     * in the background, and the breaker closes again once it succeeds.
+     * Off unless enabled.
+     */
+    struct BreakerOptions {
+        bool enabled = false;
+        /* Trip after this many requests in a row fail to reach the member (timeouts are not counted). */
+        std::uint32_t consecutive_errors = 5;
+        /* Or when at least this fraction of the last window requests failed... */
+        double error_ratio = 0.5;
+        std::size_t window = 20;
+        /* ...provided that there are at least this many of them. */
+        std::size_t min_requests = 10;
+        /* Trip when the average latency exceeds this (0 to ignore latency). */
+        std::uint64_t eject_latency_us = 0;
+        /* How long to fail fast before probing. */
+        std::uint32_t open_ms = 1000;
+    };
+
+    class CircuitBreaker {
+    public:
+        explicit CircuitBreaker(const BreakerOptions& options);
+
+        /*
+         * Whether requests may be sent. When it returns false and sets
+         * *probe, the caller should probe the member and report the result
+         * with probed().
+         */
+        bool allow(bool* probe);
+        void probed(bool healthy);
+
+        void record(bool failed);
+        void recordLatency(std::uint64_t latency_us);
+
+    private:
+        void trip();
+        void reset();
+
+        BreakerOptions options_;
+        std::mutex lock_;
+        bool open_;
+        bool probing_;
+        std::chrono::steady_clock::time_point opened_;
+        std::vector<bool> outcomes_;
+        std::size_t next_outcome_;
+        std::size_t failures_;
+        std::uint32_t consecutive_;
+        std::uint64_t latency_us_;
+        std::size_t latency_samples_;
+    };
+}
+
+#endif // BTRDB_BREAKER_H_
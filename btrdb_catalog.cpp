@@ -0,0 +1,256 @@
+#include "btrdb_catalog.h"
+#include "btrdb.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace btrdb {
+    /*
+     * Postings are keyed by what a predicate asks for: 'T' or 'A' and the
+     * key for "has the tag (annotation)", 't' or 'a', the key, a NUL and
+     * the value for "has it with this value".
+     */
+    static std::string has_key(char kind, const std::string& key) {
+        std::string k(1, kind);
+        k += key;
+        return k;
+    }
+
+    static std::string has_value(char kind, const std::string& key, const std::string& value) {
+        std::string k(1, kind);
+        k += key;
+        k += '\0';
+        k += value;
+        return k;
+    }
+
+    /* Ids to take out of and put into each posting; removals apply first. */
+    struct posting_delta {
+        std::vector<std::uint32_t> removed;
+        std::vector<std::uint32_t> added;
+    };
+
+    static void delta_for(const StreamMetadata& metadata, std::uint32_t id, bool add, std::unordered_map<std::string, posting_delta>* deltas, std::map<std::string, posting_delta>* collections) {
+        std::vector<std::uint32_t> posting_delta::* which = add ? &posting_delta::added : &posting_delta::removed;
+        for (auto& kv : metadata.tags) {
+            ((*deltas)[has_key('T', kv.first)].*which).push_back(id);
+            ((*deltas)[has_value('t', kv.first, kv.second)].*which).push_back(id);
+        }
+        for (auto& kv : metadata.annotations) {
+            ((*deltas)[has_key('A', kv.first)].*which).push_back(id);
+            ((*deltas)[has_value('a', kv.first, kv.second)].*which).push_back(id);
+        }
+        ((*collections)[metadata.collection].*which).push_back(id);
+    }
+
+    static void apply_delta(std::vector<std::uint32_t>* posting, posting_delta& delta) {
+        std::sort(delta.removed.begin(), delta.removed.end());
+        std::sort(delta.added.begin(), delta.added.end());
+        std::vector<std::uint32_t> kept;
+        kept.reserve(posting->size());
+        std::set_difference(posting->begin(), posting->end(), delta.removed.begin(), delta.removed.end(), std::back_inserter(kept));
+        posting->clear();
+        posting->reserve(kept.size() + delta.added.size());
+        std::set_union(kept.begin(), kept.end(), delta.added.begin(), delta.added.end(), std::back_inserter(*posting));
+    }
+
+    /* Keeps the ids of *ids that are also in other; other is usually far longer, so it is searched rather than scanned. */
+    static void intersect(std::vector<std::uint32_t>* ids, const std::vector<std::uint32_t>& other) {
+        std::vector<std::uint32_t>::const_iterator from = other.begin();
+        std::size_t kept = 0;
+        for (std::uint32_t id : *ids) {
+            from = std::lower_bound(from, other.end(), id);
+            if (from == other.end()) {
+                break;
+            }
+            if (*from == id) {
+                (*ids)[kept++] = id;
+            }
+        }
+        ids->resize(kept);
+    }
+
+    StreamCatalog::StreamCatalog(const std::shared_ptr<BTrDB>& b, const std::string& prefix)
+        : b_(b), prefix_(prefix), index_(std::make_shared<index>()) {
+    }
+
+    const std::string& StreamCatalog::prefix() const {
+        return this->prefix_;
+    }
+
+    std::size_t StreamCatalog::size() {
+        std::shared_ptr<const index> current = std::atomic_load(&this->index_);
+        return current->ids.size();
+    }
+
+    Status StreamCatalog::refresh(std::function<void(grpc::ClientContext*)> ctx, CatalogRefreshStats* stats) {
+        std::lock_guard<std::mutex> lock(this->refresh_lock_);
+        std::shared_ptr<const index> current = std::atomic_load(&this->index_);
+
+        /* Unchanged streams keep the metadata they have, so only changes are parsed and reindexed. */
+        std::unordered_map<std::string, std::shared_ptr<const StreamMetadata>> seen;
+        seen.reserve(current->ids.size());
+        Status status = this->b_->lookupStreamDescriptors(ctx, [&](const grpcinterface::StreamDescriptor& descriptor) {
+            std::shared_ptr<const StreamMetadata>& metadata = seen[descriptor.uuid()];
+            auto it = current->ids.find(descriptor.uuid());
+            if (it != current->ids.end()) {
+                const std::shared_ptr<const StreamMetadata>& old = current->entries[it->second].metadata;
+                if (old->annotation_version == descriptor.annotationversion() && old->collection == descriptor.collection()) {
+                    metadata = old;
+                    return;
+                }
+            }
+            metadata = metadata_from_descriptor(descriptor);
+        }, this->prefix_, true, std::map<std::string, std::pair<std::string, bool>>(), std::map<std::string, std::pair<std::string, bool>>());
+        if (status.isError()) {
+            return status;
+        }
+
+        CatalogRefreshStats result;
+        std::unordered_map<std::string, posting_delta> deltas;
+        std::map<std::string, posting_delta> collection_deltas;
+        std::vector<std::uint32_t> removed_ids;
+        for (auto& it : current->ids) {
+            if (seen.find(it.first) == seen.end()) {
+                delta_for(*current->entries[it.second].metadata, it.second, false, &deltas, &collection_deltas);
+                removed_ids.push_back(it.second);
+                result.removed++;
+            }
+        }
+
+        std::vector<std::pair<const std::string*, const std::shared_ptr<const StreamMetadata>*>> fresh;
+        std::vector<std::pair<std::uint32_t, const std::shared_ptr<const StreamMetadata>*>> changed;
+        for (auto& it : seen) {
+            auto existing = current->ids.find(it.first);
+            if (existing == current->ids.end()) {
+                fresh.emplace_back(&it.first, &it.second);
+            } else if (current->entries[existing->second].metadata != it.second) {
+                delta_for(*current->entries[existing->second].metadata, existing->second, false, &deltas, &collection_deltas);
+                delta_for(*it.second, existing->second, true, &deltas, &collection_deltas);
+                changed.emplace_back(existing->second, &it.second);
+            }
+        }
+        result.added = fresh.size();
+        result.changed = changed.size();
+        result.streams = seen.size();
+        if (stats != nullptr) {
+            *stats = result;
+        }
+        if (result.removed == 0 && result.added == 0 && result.changed == 0) {
+            return Status();
+        }
+
+        std::shared_ptr<index> next = std::make_shared<index>(*current);
+        for (std::uint32_t id : removed_ids) {
+            next->ids.erase(std::string(next->entries[id].uuid, UUID_NUM_BYTES));
+            next->entries[id].metadata.reset();
+        }
+        for (auto& it : changed) {
+            next->entries[it.first].metadata = *it.second;
+        }
+        for (auto& it : fresh) {
+            /* Ids freed by this refresh are only reused by the next one, so each posting sees an id leave or arrive, not both. */
+            std::uint32_t id;
+            if (next->free_ids.empty()) {
+                id = (std::uint32_t) next->entries.size();
+                next->entries.emplace_back();
+            } else {
+                id = next->free_ids.back();
+                next->free_ids.pop_back();
+            }
+            std::memcpy(next->entries[id].uuid, it.first->data(), UUID_NUM_BYTES);
+            next->entries[id].metadata = *it.second;
+            next->ids[*it.first] = id;
+            delta_for(**it.second, id, true, &deltas, &collection_deltas);
+        }
+        next->free_ids.insert(next->free_ids.end(), removed_ids.begin(), removed_ids.end());
+
+        for (auto& it : deltas) {
+            posting& p = next->postings[it.first];
+            apply_delta(&p, it.second);
+            if (p.empty()) {
+                next->postings.erase(it.first);
+            }
+        }
+        for (auto& it : collection_deltas) {
+            posting& p = next->collections[it.first];
+            apply_delta(&p, it.second);
+            if (p.empty()) {
+                next->collections.erase(it.first);
+            }
+        }
+
+        std::atomic_store(&this->index_, std::shared_ptr<const index>(std::move(next)));
+        return Status();
+    }
+
+    Status StreamCatalog::lookupStreams(std::vector<std::unique_ptr<Stream>>* result, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
+        if (collection.compare(0, this->prefix_.size(), this->prefix_) != 0) {
+            return Status::WrongArgs;
+        }
+        std::shared_ptr<const index> current = std::atomic_load(&this->index_);
+
+        /* Every predicate is a posting to intersect; a predicate nothing satisfies means no results. */
+        std::vector<const posting*> lists;
+        for (auto& it : tags) {
+            auto p = current->postings.find(it.second.second ? has_value('t', it.first, it.second.first) : has_key('T', it.first));
+            if (p == current->postings.end()) {
+                return Status();
+            }
+            lists.push_back(&p->second);
+        }
+        for (auto& it : annotations) {
+            auto p = current->postings.find(it.second.second ? has_value('a', it.first, it.second.first) : has_key('A', it.first));
+            if (p == current->postings.end()) {
+                return Status();
+            }
+            lists.push_back(&p->second);
+        }
+
+        /* A collection prefix is checked per stream unless it is the only predicate. */
+        bool check_prefix = false;
+        posting in_collections;
+        if (!is_prefix) {
+            auto p = current->collections.find(collection);
+            if (p == current->collections.end()) {
+                return Status();
+            }
+            lists.push_back(&p->second);
+        } else if (collection.size() > this->prefix_.size()) {
+            if (lists.empty()) {
+                for (auto it = current->collections.lower_bound(collection); it != current->collections.end() && it->first.compare(0, collection.size(), collection) == 0; it++) {
+                    in_collections.insert(in_collections.end(), it->second.begin(), it->second.end());
+                }
+                std::sort(in_collections.begin(), in_collections.end());
+                lists.push_back(&in_collections);
+            } else {
+                check_prefix = true;
+            }
+        }
+
+        posting matches;
+        if (lists.empty()) {
+            for (auto& it : current->ids) {
+                matches.push_back(it.second);
+            }
+        } else {
+            std::sort(lists.begin(), lists.end(), [](const posting* a, const posting* b) {
+                return a->size() < b->size();
+            });
+            matches = *lists[0];
+            for (std::size_t i = 1; i != lists.size() && !matches.empty(); i++) {
+                intersect(&matches, *lists[i]);
+            }
+        }
+
+        result->reserve(result->size() + matches.size());
+        for (std::uint32_t id : matches) {
+            const entry& e = current->entries[id];
+            if (check_prefix && e.metadata->collection.compare(0, collection.size(), collection) != 0) {
+                continue;
+            }
+            result->emplace_back(new Stream(this->b_, e.uuid, e.metadata));
+        }
+        return Status();
+    }
+}
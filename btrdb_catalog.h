@@ -0,0 +1,84 @@
+#ifndef BTRDB_CATALOG_H_
+#define BTRDB_CATALOG_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <grpc++/grpc++.h>
+
+#include "btrdb_metacache.h"
+#include "btrdb_util.h"
+
+namespace btrdb {
+    class BTrDB;
+    class Stream;
+
+    struct CatalogRefreshStats {
+        /* Streams in the catalog after the refresh. */
+        std::size_t streams = 0;
+        std::size_t added = 0;
+        /* Streams whose annotation version or collection changed. */
+        std::size_t changed = 0;
+        std::size_t removed = 0;
+    };
+
+    /*
+     * A local copy of the metadata of every stream in the collections
+     * starting with a prefix, with an inverted index over tags and
+     * annotations, so that lookupStreams queries within the prefix are
+     * answered without a round trip. refresh reloads the descriptors and
+     * reindexes only the streams that were added, removed, or whose
+     * annotation version changed. Lookups never wait for a refresh; they
+     * see the catalog as of the last one that finished.
+     */
+    class StreamCatalog {
+    public:
+        StreamCatalog(const std::shared_ptr<BTrDB>& b, const std::string& prefix);
+        StreamCatalog(const StreamCatalog&) = delete;
+        StreamCatalog& operator=(const StreamCatalog&) = delete;
+
+        Status refresh(std::function<void(grpc::ClientContext*)> ctx, CatalogRefreshStats* stats = nullptr);
+
+        /*
+         * Same arguments and matching rules as BTrDB::lookupStreams. Returns
+         * WrongArgs if the query could match collections outside the prefix.
+         */
+        Status lookupStreams(std::vector<std::unique_ptr<Stream>>* result, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations);
+
+        const std::string& prefix() const;
+        std::size_t size();
+
+    private:
+        /* Sorted ids of the streams with a given tag, annotation or collection. */
+        typedef std::vector<std::uint32_t> posting;
+
+        struct entry {
+            char uuid[UUID_NUM_BYTES];
+            /* Null once the stream is gone; its id is then reused. */
+            std::shared_ptr<const StreamMetadata> metadata;
+        };
+
+        /* Never modified once published, so lookups read it without locking. */
+        struct index {
+            std::vector<entry> entries;
+            std::vector<std::uint32_t> free_ids;
+            std::unordered_map<std::string, std::uint32_t> ids;
+            std::unordered_map<std::string, posting> postings;
+            std::map<std::string, posting> collections;
+        };
+
+        std::shared_ptr<BTrDB> b_;
+        std::string prefix_;
+        std::shared_ptr<const index> index_;
+        /* Serializes refreshes, so that none is lost to a concurrent one. */
+        std::mutex refresh_lock_;
+    };
+}
+
+#endif // BTRDB_CATALOG_H_
@@ -0,0 +1,89 @@
+#ifndef BTRDB_COALESCE_H_
+#define BTRDB_COALESCE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "btrdb_util.h"
+
+namespace btrdb {
+    /*
+     * Lets concurrent identical queries share one RPC. The first query
+     * for a key leads and is sent as usual; queries with the same key that
+     * arrive before its first result subscribe to it instead. Results go
+     * straight to the lead, and each subscriber gets its own copy as they
+     * pass, so nothing is buffered. Once the first result is out, later
+     * queries send an RPC of their own.
+     */
+    template <typename V>
+    class QueryCoalescer {
+    public:
+        typedef std::function<void(bool, Status, std::vector<V>&, std::uint64_t)> Callback;
+
+        QueryCoalescer() : saved_(0) {}
+
+        /*
+         * If a query with this key can still be joined, subscribes on_data
+         * to it and returns true. Otherwise returns false and sets *lead to
+         * the callback that the new query must deliver its results to.
+         */
+        bool join(const std::string& key, Callback on_data, Callback* lead) {
+            std::shared_ptr<flight> f;
+            {
+                std::lock_guard<std::mutex> lock(this->lock_);
+                auto it = this->flights_.find(key);
+                if (it != this->flights_.end()) {
+                    it->second->subscribers.push_back(std::move(on_data));
+                    this->saved_++;
+                    return true;
+                }
+                f = std::make_shared<flight>();
+                this->flights_[key] = f;
+            }
+
+            *lead = [this, f, key, on_data](bool finished, Status status, std::vector<V>& data, std::uint64_t version) {
+                /* The RPC's results arrive one at a time, so only the first sees the flight open. */
+                if (!f->closed) {
+                    std::lock_guard<std::mutex> lock(this->lock_);
+                    auto it = this->flights_.find(key);
+                    if (it != this->flights_.end() && it->second == f) {
+                        this->flights_.erase(it);
+                    }
+                    f->closed = true;
+                }
+                for (const Callback& subscriber : f->subscribers) {
+                    std::vector<V> copy(data);
+                    subscriber(finished, status, copy, version);
+                }
+                on_data(finished, status, data, version);
+            };
+            return false;
+        }
+
+        /* Queries that were answered by subscribing rather than with an RPC of their own. */
+        std::uint64_t saved() const {
+            return this->saved_.load();
+        }
+
+    private:
+        struct flight {
+            flight() : closed(false) {}
+
+            /* Added to under the coalescer's lock, and only until the flight is closed. */
+            std::vector<Callback> subscribers;
+            bool closed;
+        };
+
+        std::mutex lock_;
+        std::map<std::string, std::shared_ptr<flight>> flights_;
+        std::atomic<std::uint64_t> saved_;
+    };
+}
+
+#endif // BTRDB_COALESCE_H_
@@ -0,0 +1,89 @@
+#include "btrdb_connections.h"
+
+namespace btrdb {
+    ConnectionRegistry::ConnectionRegistry(const ChannelOptions& channel, const AdmissionOptions& admission, const BreakerOptions& breaker, std::uint32_t idle_ms)
+        : channel_(channel), admission_(admission), breaker_(breaker), idle_(idle_ms), last_reap_(std::chrono::steady_clock::now()) {
+    }
+
+    std::shared_ptr<Endpoint> ConnectionRegistry::acquire(const std::string& hostport) {
+        std::shared_ptr<entry> e;
+        {
+            std::lock_guard<std::mutex> lock(this->lock_);
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            if (this->idle_.count() != 0 && now - this->last_reap_ >= this->idle_) {
+                this->reapLocked(now);
+            }
+
+            auto it = this->entries_.find(hostport);
+            if (it != this->entries_.end()) {
+                e = it->second;
+            } else {
+                e = std::make_shared<entry>();
+                e->endpoint = std::make_shared<Endpoint>(this->channel_, this->admission_, this->breaker_);
+                e->endpoint->connect(hostport);
+                e->refs = 0;
+                this->entries_[hostport] = e;
+            }
+            e->refs++;
+        }
+
+        /* The handle shares ownership of the Endpoint, and gives back its reference when the last copy goes. */
+        std::shared_ptr<ConnectionRegistry> self = this->shared_from_this();
+        std::shared_ptr<Endpoint> owner = e->endpoint;
+        return std::shared_ptr<Endpoint>(owner.get(), [self, e, owner](Endpoint*) {
+            self->release(e);
+        });
+    }
+
+    void ConnectionRegistry::release(const std::shared_ptr<entry>& e) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        if (--e->refs == 0) {
+            e->idle_since = std::chrono::steady_clock::now();
+        }
+    }
+
+    std::size_t ConnectionRegistry::reapIdle() {
+        if (this->idle_.count() == 0) {
+            return 0;
+        }
+        std::lock_guard<std::mutex> lock(this->lock_);
+        return this->reapLocked(std::chrono::steady_clock::now());
+    }
+
+    std::size_t ConnectionRegistry::reapLocked(std::chrono::steady_clock::time_point now) {
+        std::size_t reaped = 0;
+        for (auto it = this->entries_.begin(); it != this->entries_.end();) {
+            if (it->second->refs == 0 && now - it->second->idle_since >= this->idle_) {
+                it = this->entries_.erase(it);
+                reaped++;
+            } else {
+                it++;
+            }
+        }
+        this->last_reap_ = now;
+        return reaped;
+    }
+
+    void ConnectionRegistry::close(const std::string& hostport) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        this->entries_.erase(hostport);
+    }
+
+    void ConnectionRegistry::closeAll() {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        this->entries_.clear();
+    }
+
+    ConnectionStats ConnectionRegistry::stats() {
+        ConnectionStats stats;
+        std::lock_guard<std::mutex> lock(this->lock_);
+        for (auto& it : this->entries_) {
+            stats.endpoints++;
+            stats.channels += it.second->endpoint->numChannels();
+            if (it.second->refs == 0) {
+                stats.idle++;
+            }
+        }
+        return stats;
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef BTRDB_CONNECTIONS_H_
+#define BTRDB_CONNECTIONS_H_
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "btrdb_endpoint.h"
+
+namespace btrdb {
+    struct ConnectionStats {
+        /* Addresses with an open Endpoint, and the gRPC channels they hold. */
+        std::size_t endpoints = 0;
+        std::size_t channels = 0;
+        /* Endpoints that nobody is using, which will be closed once idle long enough. */
+        std::size_t idle = 0;
+    };
+
+    /*
+     * Opens at most one Endpoint per host:port and shares it among everyone
+     * who asks for that address. Each handle returned by acquire counts as
+     * a reference; once the last one is released, the Endpoint is closed
+     * after idle_ms without a new acquire (0 keeps it until close).
+     */
+    class ConnectionRegistry : public std::enable_shared_from_this<ConnectionRegistry> {
+    public:
+        ConnectionRegistry(const ChannelOptions& channel, const AdmissionOptions& admission, const BreakerOptions& breaker, std::uint32_t idle_ms);
+
+        /* The shared Endpoint for hostport, which starts connecting in the background if it is new. */
+        std::shared_ptr<Endpoint> acquire(const std::string& hostport);
+
+        /* Closes the Endpoints that have been idle for idle_ms, and returns how many. */
+        std::size_t reapIdle();
+        /*
+         * Forgets the Endpoint for hostport (or all of them), so that the
+         * next acquire opens a new one. Handles that are still held keep
+         * working until they are released.
+         */
+        void close(const std::string& hostport);
+        void closeAll();
+
+        ConnectionStats stats();
+
+    private:
+        struct entry {
+            std::shared_ptr<Endpoint> endpoint;
+            std::size_t refs;
+            std::chrono::steady_clock::time_point idle_since;
+        };
+
+        void release(const std::shared_ptr<entry>& e);
+        std::size_t reapLocked(std::chrono::steady_clock::time_point now);
+
+        ChannelOptions channel_;
+        AdmissionOptions admission_;
+        BreakerOptions breaker_;
+        std::chrono::milliseconds idle_;
+
+        std::mutex lock_;
+        std::map<std::string, std::shared_ptr<entry>> entries_;
+        std::chrono::steady_clock::time_point last_reap_;
+    };
+}
+
+#endif // BTRDB_CONNECTIONS_H_
@@ -5,56 +5,301 @@
 #include "btrdb_util.h"
 
 namespace btrdb {
+    InFlight::InFlight(std::shared_ptr<EndpointChannel> channel, std::shared_ptr<AdmissionQueue> admission, Priority priority)
+        : channel_(std::move(channel)), start_(std::chrono::steady_clock::now()),
+          admission_(std::move(admission)), priority_(priority) {
+        this->channel_->in_flight++;
+    }
+
+    InFlight::InFlight(InFlight&& other)
+        : channel_(std::move(other.channel_)), start_(other.start_),
+          admission_(std::move(other.admission_)), priority_(other.priority_) {}
+
+    InFlight& InFlight::operator=(InFlight&& other) {
+        if (this != &other) {
+            this->release();
+            this->channel_ = std::move(other.channel_);
+            this->start_ = other.start_;
+            this->admission_ = std::move(other.admission_);
+            this->priority_ = other.priority_;
+        }
+        return *this;
+    }
+
+    Status InFlight::observe(const Status& status) {
+        if (this->channel_ != nullptr && this->channel_->breaker != nullptr) {
+            this->channel_->breaker->record(status.isTransportError());
+        }
+        return status;
+    }
+
+    InFlight::~InFlight() {
+        this->release();
+    }
+
+    void InFlight::release() {
+        if (this->channel_ != nullptr) {
+            auto elapsed = std::chrono::steady_clock::now() - this->start_;
+            std::uint64_t sample = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+            /*
+             * Exponentially weighted, with weight 1/8 for the new sample.
+             * Concurrent updates may lose a sample, which is fine for an
+             * estimate.
+             */
+            std::uint64_t average = this->channel_->latency_us.load();
+            if (average == 0) {
+                average = sample;
+            } else {
+                average = average - (average >> 3) + (sample >> 3);
+            }
+            this->channel_->latency_us.store(average);
+            if (this->channel_->breaker != nullptr) {
+                this->channel_->breaker->recordLatency(sample);
+            }
+
+            this->channel_->in_flight--;
+            this->channel_.reset();
+        }
+        if (this->admission_ != nullptr) {
+            this->admission_->release(this->priority_);
+            this->admission_.reset();
+        }
+    }
+
+    Endpoint::Endpoint(const ChannelOptions& options, const AdmissionOptions& admission, const BreakerOptions& breaker) : options_(options), next_channel_(0) {
+        if (this->options_.num_channels == 0) {
+            this->options_.num_channels = 1;
+        }
+        if (admission.max_in_flight != 0) {
+            this->admission_ = std::make_shared<AdmissionQueue>(admission);
+        }
+        if (breaker.enabled) {
+            this->breaker_ = std::make_shared<CircuitBreaker>(breaker);
+        }
+    }
+
+    Endpoint::~Endpoint() {
+        if (this->admission_ != nullptr) {
+            this->admission_->close();
+        }
+    }
+
     /* TODO: need to clean up state on failure... */
     bool Endpoint::connectBlocking(gpr_timespec deadline, const std::vector<std::string>& endpoints) {
         for (const std::string& endpoint : endpoints) {
             this->connect(endpoint);
-
-            grpc_connectivity_state state = channel_->GetState(true);
-            switch (state) {
-            case grpc_connectivity_state::GRPC_CHANNEL_IDLE:
-            case grpc_connectivity_state::GRPC_CHANNEL_CONNECTING:
-            case grpc_connectivity_state::GRPC_CHANNEL_READY:
+            if (this->waitForConnected(deadline)) {
                 return true;
-            case grpc_connectivity_state::GRPC_CHANNEL_INIT:
-            case grpc_connectivity_state::GRPC_CHANNEL_TRANSIENT_FAILURE:
-            case grpc_connectivity_state::GRPC_CHANNEL_SHUTDOWN:
-                if (channel_->WaitForConnected(deadline)) {
-                    return true;
-                }
             }
         }
         return false;
     }
 
+    bool Endpoint::waitForConnected(gpr_timespec deadline) {
+        /* Start connecting every channel in the pool, but only wait for the first. */
+        for (std::size_t i = 1; i < this->channels_.size(); i++) {
+            this->channels_[i]->channel->GetState(true);
+        }
+
+        const std::shared_ptr<grpc::Channel>& channel = this->channels_[0]->channel;
+        grpc_connectivity_state state = channel->GetState(true);
+        switch (state) {
+        case grpc_connectivity_state::GRPC_CHANNEL_IDLE:
+        case grpc_connectivity_state::GRPC_CHANNEL_CONNECTING:
+        case grpc_connectivity_state::GRPC_CHANNEL_READY:
+            return true;
+        case grpc_connectivity_state::GRPC_CHANNEL_INIT:
+        case grpc_connectivity_state::GRPC_CHANNEL_TRANSIENT_FAILURE:
+        case grpc_connectivity_state::GRPC_CHANNEL_SHUTDOWN:
+            return channel->WaitForConnected(deadline);
+        }
+        return false;
+    }
+
     void Endpoint::connect(const std::string& hostport) {
-        channel_ = grpc::CreateChannel(hostport, grpc::InsecureChannelCredentials());
-        stub_ = std::move(grpcinterface::BTrDB::NewStub(channel_, grpc::StubOptions()));
+        this->hostport_ = hostport;
+        this->channels_.clear();
+        const ChannelOptions& options = this->options_;
+        for (std::size_t i = 0; i != options.num_channels; i++) {
+            grpc::ChannelArguments args;
+            if (options.max_send_message_size != 0) {
+                args.SetMaxSendMessageSize(options.max_send_message_size);
+            }
+            if (options.max_receive_message_size != 0) {
+                args.SetMaxReceiveMessageSize(options.max_receive_message_size);
+            }
+            if (options.keepalive_time_ms != 0) {
+                args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, options.keepalive_time_ms);
+            }
+            if (options.keepalive_timeout_ms != 0) {
+                args.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, options.keepalive_timeout_ms);
+            }
+            if (options.keepalive_permit_without_calls) {
+                args.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+                args.SetInt(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+            }
+            if (options.idle_timeout_ms != 0) {
+                args.SetInt("grpc.client_idle_timeout_ms", options.idle_timeout_ms);
+            }
+            if (options.http2_stream_window_size != 0) {
+                args.SetInt(GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES, options.http2_stream_window_size);
+            }
+            if (options.http2_max_frame_size != 0) {
+                args.SetInt(GRPC_ARG_HTTP2_MAX_FRAME_SIZE, options.http2_max_frame_size);
+            }
+            args.SetInt(GRPC_ARG_HTTP2_BDP_PROBE, options.http2_bdp_probe ? 1 : 0);
+            if (options.compression != GRPC_COMPRESS_NONE) {
+                args.SetCompressionAlgorithm(options.compression);
+            }
+
+            /*
+             * gRPC shares the underlying connection between channels created
+             * with identical arguments, so give each channel in the pool a
+             * distinct argument to force a separate TCP connection.
+             */
+            args.SetInt("btrdb.channel_index", (int) i);
+
+            std::shared_ptr<EndpointChannel> channel(new EndpointChannel);
+            channel->channel = grpc::CreateCustomChannel(hostport, grpc::InsecureChannelCredentials(), args);
+            channel->stub = grpcinterface::BTrDB::NewStub(channel->channel, grpc::StubOptions());
+            channel->in_flight = 0;
+            channel->latency_us = 0;
+            channel->breaker = this->breaker_;
+            this->channels_.push_back(std::move(channel));
+        }
     }
 
-    Status Endpoint::insert(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::vector<struct RawPoint>::const_iterator data_start, std::vector<struct RawPoint>::const_iterator data_end, bool sync, std::uint64_t* version) {
-        grpcinterface::InsertParams params;
-        params.set_uuid(uuid, 16);
-        params.set_sync(sync);
+    std::shared_ptr<EndpointChannel> Endpoint::pick() {
+        /*
+         * Choose the channel with the fewest RPCs in flight. Start the scan
+         * at a rotating offset so that ties are broken round-robin.
+         */
+        std::size_t num_channels = this->channels_.size();
+        std::size_t start = this->next_channel_++ % num_channels;
+        std::size_t best = start;
+        std::uint32_t best_in_flight = this->channels_[start]->in_flight.load();
+        for (std::size_t i = 1; i < num_channels && best_in_flight != 0; i++) {
+            std::size_t candidate = (start + i) % num_channels;
+            std::uint32_t in_flight = this->channels_[candidate]->in_flight.load();
+            if (in_flight < best_in_flight) {
+                best = candidate;
+                best_in_flight = in_flight;
+            }
+        }
+        return this->channels_[best];
+    }
+
+    Status Endpoint::acquire(const grpc::ClientContext& context, std::shared_ptr<EndpointChannel>* channel, InFlight* in_flight) {
+        RequestClass request_class = current_request_class();
+        if (this->admission_ != nullptr) {
+            /* The time spent queued counts against the RPC's deadline. */
+            Status status = this->admission_->acquire(request_class, context.deadline());
+            if (status.isError()) {
+                return status;
+            }
+        }
+        *channel = this->pick();
+        *in_flight = InFlight(*channel, this->admission_, request_class.priority);
+        return Status();
+    }
+
+    void Endpoint::admit(AsyncRequest* reqdata, InFlight* in_flight, std::function<void(EndpointChannel*)> issue) {
+        if (this->admission_ == nullptr) {
+            std::shared_ptr<EndpointChannel> channel = this->pick();
+            *in_flight = InFlight(channel);
+            issue(channel.get());
+            return;
+        }
+
+        RequestClass request_class = reqdata->request_class;
+        std::shared_ptr<AdmissionQueue> admission = this->admission_;
+        admission->submit(request_class, [=](bool admitted) {
+            if (!admitted) {
+                /* The Endpoint was destroyed while this was queued. */
+                reqdata->fail(Status::Disconnected);
+                delete reqdata;
+                return;
+            }
+            std::shared_ptr<EndpointChannel> channel = this->pick();
+            *in_flight = InFlight(channel, admission, request_class.priority);
+            issue(channel.get());
+        });
+    }
+
+    AdmissionStats Endpoint::admissionStats() {
+        if (this->admission_ == nullptr) {
+            return AdmissionStats();
+        }
+        return this->admission_->stats();
+    }
+
+    bool Endpoint::healthy(bool* probe) {
+        *probe = false;
+        return this->breaker_ == nullptr || this->breaker_->allow(probe);
+    }
+
+    void Endpoint::probed(bool healthy) {
+        if (this->breaker_ != nullptr) {
+            this->breaker_->probed(healthy);
+        }
+    }
+
+    const std::string& Endpoint::hostport() const {
+        return this->hostport_;
+    }
+
+    std::size_t Endpoint::numChannels() const {
+        return this->channels_.size();
+    }
+
+    std::uint32_t Endpoint::inFlight() const {
+        std::uint32_t total = 0;
+        for (const std::shared_ptr<EndpointChannel>& channel : this->channels_) {
+            total += channel->in_flight.load();
+        }
+        return total;
+    }
 
-        auto values = params.mutable_values();
-        values->Reserve(data_end - data_start);
+    std::uint64_t Endpoint::latency() const {
+        std::uint64_t total = 0;
+        std::uint64_t measured = 0;
+        for (const std::shared_ptr<EndpointChannel>& channel : this->channels_) {
+            std::uint64_t latency = channel->latency_us.load();
+            if (latency != 0) {
+                total += latency;
+                measured++;
+            }
+        }
+        return measured == 0 ? 0 : total / measured;
+    }
 
-        for (auto i = data_start; i != data_end; i++) {
-            grpcinterface::RawPoint* value = values->Add();
-            value->set_time(i->time);
-            value->set_value(i->value);
+    Status Endpoint::insert(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::vector<struct RawPoint>::const_iterator data_start, std::vector<struct RawPoint>::const_iterator data_end, bool sync, std::uint64_t* version) {
+        if ((std::size_t) (data_end - data_start) > MAX_INSERT_POINTS) {
+            return Status::WrongArgs;
         }
+        grpcinterface::InsertParams params;
+        insert_params(&params, uuid, data_start, data_end, sync);
+        return this->insert(ctx, params, version);
+    }
 
+    Status Endpoint::insert(std::function<void(grpc::ClientContext*)> ctx, const grpcinterface::InsertParams& params, std::uint64_t* version) {
         grpc::ClientContext context;
         ctx(&context);
 
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
         grpcinterface::InsertResponse response;
-        grpc::Status status = this->stub_->Insert(&context, params, &response);
+        grpc::Status status = channel->stub->Insert(&context, params, &response);
         if (version != nullptr) {
             *version = response.versionmajor();
         }
-        return Status::fromResponse(status, response);
+        return in_flight.observe(Status::fromResponse(status, response));
     }
 
     Status Endpoint::deleteRange(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::int64_t start, std::int64_t end, std::uint64_t* version) {
@@ -66,12 +311,38 @@ namespace btrdb {
         grpc::ClientContext context;
         ctx(&context);
 
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
         grpcinterface::DeleteResponse response;
-        grpc::Status status = this->stub_->Delete(&context, params, &response);
+        grpc::Status status = channel->stub->Delete(&context, params, &response);
         if (version != nullptr) {
             *version = response.versionmajor();
         }
-        return Status::fromResponse(status, response);
+        return in_flight.observe(Status::fromResponse(status, response));
+    }
+
+    Status Endpoint::flush(std::function<void(grpc::ClientContext*)> ctx, const void* uuid) {
+        grpcinterface::FlushParams params;
+        params.set_uuid(uuid, 16);
+
+        grpc::ClientContext context;
+        ctx(&context);
+
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
+        grpcinterface::FlushResponse response;
+        grpc::Status status = channel->stub->Flush(&context, params, &response);
+        return in_flight.observe(Status::fromResponse(status, response));
     }
 
     Status Endpoint::obliterate(std::function<void(grpc::ClientContext*)> ctx, const void* uuid) {
@@ -81,9 +352,16 @@ namespace btrdb {
         grpc::ClientContext context;
         ctx(&context);
 
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
         grpcinterface::ObliterateResponse response;
-        grpc::Status status = this->stub_->Obliterate(&context, params, &response);
-        return Status::fromResponse(status, response);
+        grpc::Status status = channel->stub->Obliterate(&context, params, &response);
+        return in_flight.observe(Status::fromResponse(status, response));
     }
 
     Status Endpoint::listAllCollections(std::function<void(grpc::ClientContext*)> ctx, std::vector<std::string>* collections) {
@@ -95,8 +373,15 @@ namespace btrdb {
         grpc::ClientContext context;
         ctx(&context);
 
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
         grpcinterface::ListCollectionsResponse response;
-        grpc::Status status = this->stub_->ListCollections(&context, params, &response);
+        grpc::Status status = channel->stub->ListCollections(&context, params, &response);
 
         const auto& coll = response.collections();
         int num_colls = coll.size();
@@ -106,7 +391,7 @@ namespace btrdb {
             collections->push_back(coll[i]);
         }
 
-        return Status::fromResponse(status, response);
+        return in_flight.observe(Status::fromResponse(status, response));
     }
 
     Status Endpoint::listCollections(std::function<void(grpc::ClientContext*)> ctx, const std::string& prefix, const std::string& from, std::uint64_t limit, std::vector<std::string>* collections) {
@@ -118,8 +403,15 @@ namespace btrdb {
         grpc::ClientContext context;
         ctx(&context);
 
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
         grpcinterface::ListCollectionsResponse response;
-        grpc::Status status = this->stub_->ListCollections(&context, params, &response);
+        grpc::Status status = channel->stub->ListCollections(&context, params, &response);
 
         const auto& coll = response.collections();
         int num_colls = coll.size();
@@ -129,14 +421,14 @@ namespace btrdb {
             collections->push_back(coll[i]);
         }
 
-        return Status::fromResponse(status, response);
+        return in_flight.observe(Status::fromResponse(status, response));
     }
 
     class ListCollectionsAsyncRequestImpl : public AsyncRequest {
     public:
         bool process_batch() override {
             std::vector<std::string> collections;
-            Status status = Status::fromResponse(this->grpc_status, response_buffer);
+            Status status = this->in_flight.observe(Status::fromResponse(this->grpc_status, response_buffer));
 
             if (!status.isError()) {
                 for (int i = 0; i != this->response_buffer.collections_size(); i++) {
@@ -153,6 +445,11 @@ namespace btrdb {
             this->on_data(Status(), collections);
         }
 
+        void fail(const Status& status) override {
+            std::vector<std::string> collections;
+            this->on_data(status, collections);
+        }
+
         inline void request_next() {
             this->reader->Finish(&this->response_buffer, &this->grpc_status, static_cast<AsyncRequest*>(this));
         }
@@ -161,6 +458,7 @@ namespace btrdb {
         grpcinterface::ListCollectionsResponse response_buffer;
         grpc::Status grpc_status;
         grpc::ClientContext context;
+        InFlight in_flight;
         std::function<void(Status, std::vector<std::string>&)> on_data;
         std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<grpcinterface::ListCollectionsResponse>> reader;
     };
@@ -174,18 +472,23 @@ namespace btrdb {
         ListCollectionsAsyncRequestImpl* reqdata = new ListCollectionsAsyncRequestImpl;
         ctx(&reqdata->context);
         reqdata->on_data = on_data;
-        reqdata->reader = this->stub_->AsyncListCollections(&reqdata->context, params, cq);
-        reqdata->request_next();
+        this->admit(reqdata, &reqdata->in_flight, [=](EndpointChannel* channel) {
+            reqdata->reader = channel->stub->AsyncListCollections(&reqdata->context, params, cq);
+            reqdata->request_next();
+        });
     }
 
     Status Endpoint::info(std::function<void(grpc::ClientContext*)> ctx, grpcinterface::InfoResponse* response) {
         grpcinterface::InfoParams params;
 
+        std::shared_ptr<EndpointChannel> channel = this->pick();
+        InFlight in_flight(channel);
+
         grpc::ClientContext context;
         ctx(&context);
 
-        grpc::Status status = this->stub_->Info(&context, params, response);
-        return Status::fromResponse(status, *response);
+        grpc::Status status = channel->stub->Info(&context, params, response);
+        return in_flight.observe(Status::fromResponse(status, *response));
     }
 
     Status Endpoint::streamInfo(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, grpcinterface::StreamInfoResponse* response, bool omit_version, bool omit_descriptor) {
@@ -197,8 +500,15 @@ namespace btrdb {
         grpc::ClientContext context;
         ctx(&context);
 
-        grpc::Status status = this->stub_->StreamInfo(&context, params, response);
-        return Status::fromResponse(status, *response);
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
+        grpc::Status status = channel->stub->StreamInfo(&context, params, response);
+        return in_flight.observe(Status::fromResponse(status, *response));
     }
 
     Status Endpoint::create(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, const std::string& collection, const std::map<std::string, std::string>& tags, const std::map<std::string, std::string>& annotations) {
@@ -219,12 +529,52 @@ namespace btrdb {
         grpc::ClientContext context;
         ctx(&context);
 
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
         grpcinterface::CreateResponse response;
-        grpc::Status status = this->stub_->Create(&context, params, &response);
-        return Status::fromResponse(status, response);
+        grpc::Status status = channel->stub->Create(&context, params, &response);
+        return in_flight.observe(Status::fromResponse(status, response));
     }
 
-    void Endpoint::lookupStreamsAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> on_data, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
+    /* A change without a value removes the annotation. */
+    static grpcinterface::SetStreamAnnotationsParams set_stream_annotations_params(const void* uuid, std::uint64_t expected_version, const std::map<std::string, std::pair<std::string, bool>>& changes) {
+        grpcinterface::SetStreamAnnotationsParams params;
+        params.set_uuid(uuid, 16);
+        params.set_expectedannotationversion(expected_version);
+        for (auto it = changes.begin(); it != changes.end(); it++) {
+            grpcinterface::KeyOptValue* kov = params.add_annotations();
+            kov->set_key(it->first);
+            if (it->second.second) {
+                kov->mutable_val()->set_value(it->second.first);
+            }
+        }
+        return params;
+    }
+
+    Status Endpoint::setStreamAnnotations(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::uint64_t expected_version, const std::map<std::string, std::pair<std::string, bool>>& changes) {
+        grpcinterface::SetStreamAnnotationsParams params = set_stream_annotations_params(uuid, expected_version, changes);
+
+        grpc::ClientContext context;
+        ctx(&context);
+
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
+        grpcinterface::SetStreamAnnotationsResponse response;
+        grpc::Status status = channel->stub->SetStreamAnnotations(&context, params, &response);
+        return in_flight.observe(Status::fromResponse(status, response));
+    }
+
+    grpcinterface::LookupStreamsParams lookup_streams_params(const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
         grpcinterface::LookupStreamsParams params;
         params.set_collection(collection);
         params.set_iscollectionprefix(is_prefix);
@@ -242,12 +592,236 @@ namespace btrdb {
                 kov->mutable_val()->set_value(it->second.first);
             }
         }
+        return params;
+    }
+
+    static inline void to_value(struct RawPoint* value, const grpcinterface::RawPoint& intermediate) {
+        value->time = intermediate.time();
+        value->value = intermediate.value();
+    }
+
+    static inline void to_value(struct StatisticalPoint* value, const grpcinterface::StatPoint& intermediate) {
+        value->time = intermediate.time();
+        value->min = intermediate.min();
+        value->mean = intermediate.mean();
+        value->max = intermediate.max();
+        value->count = intermediate.count();
+    }
+
+    static inline void to_value(struct ChangedRange* value, const grpcinterface::ChangedRange& intermediate) {
+        value->start = intermediate.start();
+        value->end = intermediate.end();
+    }
+
+    /*
+     * Reads a server-streaming response to completion on the calling thread,
+     * passing each message to ON_RESPONSE. If the server reports an error
+     * in-band, the call is cancelled and that error is returned.
+     */
+    template <typename ResponseType, typename Callback>
+    Status read_all_blocking(grpc::ClientContext* context, grpc::ClientReader<ResponseType>* reader, Callback on_response) {
+        ResponseType response;
+        while (reader->Read(&response)) {
+            if (response.has_stat() && response.stat().code() != 0) {
+                Status status(response.stat());
+                context->TryCancel();
+                reader->Finish();
+                return status;
+            }
+            on_response(response);
+            response.Clear();
+        }
+
+        grpc::Status grpc_status = reader->Finish();
+        if (!grpc_status.ok()) {
+            return Status(grpc_status);
+        }
+        return Status();
+    }
+
+    template <typename ResponseType, typename ValueType>
+    Status read_values_blocking(grpc::ClientContext* context, grpc::ClientReader<ResponseType>* reader, const std::function<void(bool, Status, std::vector<ValueType>&, std::uint64_t)>& on_data) {
+        std::uint64_t version = 0;
+        Status status = read_all_blocking(context, reader, [&](const ResponseType& response) {
+            version = response.versionmajor();
+            int num_values = response.values_size();
+            if (num_values == 0) {
+                return;
+            }
+            std::vector<ValueType> values(num_values);
+            for (int i = 0; i != num_values; i++) {
+                to_value(&values[i], response.values(i));
+            }
+            on_data(false, Status(), values, version);
+        });
+
+        std::vector<ValueType> dummy;
+        on_data(true, status, dummy, version);
+        return status;
+    }
+
+    Status Endpoint::lookupStreams(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> on_data, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
+        Status status = this->lookupStreamDescriptors(ctx, [&](const grpcinterface::LookupStreamsResponse& response) {
+            int num_values = response.values_size();
+            if (num_values == 0) {
+                return;
+            }
+            std::vector<std::unique_ptr<Stream>> streams(num_values);
+            for (int i = 0; i != num_values; i++) {
+                streams[i].reset(new Stream(nullptr, response.values(i)));
+            }
+            on_data(false, Status(), streams);
+        }, collection, is_prefix, tags, annotations);
+
+        std::vector<std::unique_ptr<Stream>> dummy;
+        on_data(true, status, dummy);
+        return status;
+    }
+
+    Status Endpoint::lookupStreamDescriptors(std::function<void(grpc::ClientContext*)> ctx, std::function<void(const grpcinterface::LookupStreamsResponse&)> on_response, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
+        grpcinterface::LookupStreamsParams params = lookup_streams_params(collection, is_prefix, tags, annotations);
+
+        grpc::ClientContext context;
+        ctx(&context);
+
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
+        std::unique_ptr<grpc::ClientReader<grpcinterface::LookupStreamsResponse>> reader = channel->stub->LookupStreams(&context, params);
+        Status status = read_all_blocking(&context, reader.get(), on_response);
+        return in_flight.observe(status);
+    }
+
+    Status Endpoint::rawValues(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<RawPoint>&, std::uint64_t)> on_data, const void* uuid, std::int64_t start, std::int64_t end, std::uint64_t version) {
+        grpcinterface::RawValuesParams params;
+        params.set_uuid(uuid, 16);
+        params.set_start(start);
+        params.set_end(end);
+        params.set_versionmajor(version);
+
+        grpc::ClientContext context;
+        ctx(&context);
+
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
+        std::unique_ptr<grpc::ClientReader<grpcinterface::RawValuesResponse>> reader = channel->stub->RawValues(&context, params);
+        return in_flight.observe(read_values_blocking(&context, reader.get(), on_data));
+    }
+
+    Status Endpoint::alignedWindows(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, const void* uuid, std::int64_t start, std::int64_t end, std::uint8_t pointwidth, std::uint64_t version) {
+        grpcinterface::AlignedWindowsParams params;
+        params.set_uuid(uuid, 16);
+        params.set_start(start);
+        params.set_end(end);
+        params.set_versionmajor(version);
+        params.set_pointwidth(pointwidth);
+
+        grpc::ClientContext context;
+        ctx(&context);
+
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
+        std::unique_ptr<grpc::ClientReader<grpcinterface::AlignedWindowsResponse>> reader = channel->stub->AlignedWindows(&context, params);
+        return in_flight.observe(read_values_blocking(&context, reader.get(), on_data));
+    }
+
+    Status Endpoint::windows(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, const void* uuid, std::int64_t start, std::int64_t end, std::uint64_t width, std::uint8_t depth, std::uint64_t version) {
+        grpcinterface::WindowsParams params;
+        params.set_uuid(uuid, 16);
+        params.set_start(start);
+        params.set_end(end);
+        params.set_versionmajor(version);
+        params.set_width(width);
+        params.set_depth(depth);
+
+        grpc::ClientContext context;
+        ctx(&context);
+
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
+        std::unique_ptr<grpc::ClientReader<grpcinterface::WindowsResponse>> reader = channel->stub->Windows(&context, params);
+        return in_flight.observe(read_values_blocking(&context, reader.get(), on_data));
+    }
+
+    Status Endpoint::changes(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct ChangedRange>&, std::uint64_t)> on_data, const void* uuid, std::uint64_t from_version, std::uint64_t to_version, std::uint8_t resolution) {
+        grpcinterface::ChangesParams params;
+        params.set_uuid(uuid, 16);
+        params.set_frommajor(from_version);
+        params.set_tomajor(to_version);
+        params.set_resolution(resolution);
+
+        grpc::ClientContext context;
+        ctx(&context);
+
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
+        std::unique_ptr<grpc::ClientReader<grpcinterface::ChangesResponse>> reader = channel->stub->Changes(&context, params);
+        return in_flight.observe(read_values_blocking(&context, reader.get(), on_data));
+    }
+
+    Status Endpoint::nearest(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::int64_t timestamp, bool backward, std::uint64_t version, RawPoint* result, std::uint64_t* version_ptr) {
+        grpcinterface::NearestParams params;
+        params.set_uuid(uuid, 16);
+        params.set_time(timestamp);
+        params.set_versionmajor(version);
+        params.set_backward(backward);
+
+        grpc::ClientContext context;
+        ctx(&context);
+
+        std::shared_ptr<EndpointChannel> channel;
+        InFlight in_flight;
+        Status admitted = this->acquire(context, &channel, &in_flight);
+        if (admitted.isError()) {
+            return admitted;
+        }
+
+        grpcinterface::NearestResponse response;
+        grpc::Status status = channel->stub->Nearest(&context, params, &response);
+        Status stat = in_flight.observe(Status::fromResponse(status, response));
+        if (!stat.isError()) {
+            to_value(result, response.value());
+        }
+        if (version_ptr != nullptr) {
+            *version_ptr = response.versionmajor();
+        }
+        return stat;
+    }
+
+    void Endpoint::lookupStreamsAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> on_data, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations) {
+        grpcinterface::LookupStreamsParams params = lookup_streams_params(collection, is_prefix, tags, annotations);
 
         StreamAsyncRequest<grpcinterface::LookupStreamsResponse>* reqdata = new StreamAsyncRequest<grpcinterface::LookupStreamsResponse>;
         ctx(&reqdata->context);
         reqdata->on_data = std::move(on_data);
-        reqdata->reader = std::move(this->stub_->AsyncLookupStreams(&reqdata->context, params, cq, static_cast<AsyncRequest*>(reqdata)));
-        reqdata->request_next();
+        this->admit(reqdata, &reqdata->in_flight, [=](EndpointChannel* channel) {
+            reqdata->reader = std::move(channel->stub->AsyncLookupStreams(&reqdata->context, params, cq, static_cast<AsyncRequest*>(reqdata)));
+            reqdata->request_next();
+        });
     }
 
     void Endpoint::rawValuesAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(bool, Status, std::vector<RawPoint>&, std::uint64_t)> on_data, const void* uuid, std::int64_t start, std::int64_t end, std::uint64_t version) {
@@ -260,8 +834,10 @@ namespace btrdb {
         RawPointAsyncRequest<grpcinterface::RawValuesResponse>* reqdata = new RawPointAsyncRequest<grpcinterface::RawValuesResponse>;
         ctx(&reqdata->context);
         reqdata->on_data = wrap_on_data_vernum(reqdata, std::move(on_data));
-        reqdata->reader = this->stub_->AsyncRawValues(&reqdata->context, params, cq, static_cast<AsyncRequest*>(reqdata));
-        reqdata->request_next();
+        this->admit(reqdata, &reqdata->in_flight, [=](EndpointChannel* channel) {
+            reqdata->reader = channel->stub->AsyncRawValues(&reqdata->context, params, cq, static_cast<AsyncRequest*>(reqdata));
+            reqdata->request_next();
+        });
     }
 
     void Endpoint::alignedWindowsAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, const void* uuid, std::int64_t start, std::int64_t end, std::uint8_t pointwidth, std::uint64_t version) {
@@ -275,8 +851,10 @@ namespace btrdb {
         StatisticalPointAsyncRequest<grpcinterface::AlignedWindowsResponse>* reqdata = new StatisticalPointAsyncRequest<grpcinterface::AlignedWindowsResponse>;
         ctx(&reqdata->context);
         reqdata->on_data = wrap_on_data_vernum(reqdata, std::move(on_data));
-        reqdata->reader = this->stub_->AsyncAlignedWindows(&reqdata->context, params, cq, static_cast<AsyncRequest*>(reqdata));
-        reqdata->request_next();
+        this->admit(reqdata, &reqdata->in_flight, [=](EndpointChannel* channel) {
+            reqdata->reader = channel->stub->AsyncAlignedWindows(&reqdata->context, params, cq, static_cast<AsyncRequest*>(reqdata));
+            reqdata->request_next();
+        });
     }
 
     void Endpoint::windowsAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, const void* uuid, std::int64_t start, std::int64_t end, std::uint64_t width, std::uint8_t depth, std::uint64_t version) {
@@ -291,8 +869,10 @@ namespace btrdb {
         StatisticalPointAsyncRequest<grpcinterface::WindowsResponse>* reqdata = new StatisticalPointAsyncRequest<grpcinterface::WindowsResponse>;
         ctx(&reqdata->context);
         reqdata->on_data = wrap_on_data_vernum(reqdata, std::move(on_data));
-        reqdata->reader = this->stub_->AsyncWindows(&reqdata->context, params, cq, static_cast<AsyncRequest*>(reqdata));
-        reqdata->request_next();
+        this->admit(reqdata, &reqdata->in_flight, [=](EndpointChannel* channel) {
+            reqdata->reader = channel->stub->AsyncWindows(&reqdata->context, params, cq, static_cast<AsyncRequest*>(reqdata));
+            reqdata->request_next();
+        });
     }
 
     void Endpoint::changesAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(bool, Status, std::vector<struct ChangedRange>&, std::uint64_t)> on_data, const void* uuid, std::uint64_t from_version, std::uint64_t to_version, std::uint8_t resolution) {
@@ -305,15 +885,17 @@ namespace btrdb {
         ChangedRangeAsyncRequest<grpcinterface::ChangesResponse>* reqdata = new ChangedRangeAsyncRequest<grpcinterface::ChangesResponse>;
         ctx(&reqdata->context);
         reqdata->on_data = wrap_on_data_vernum(reqdata, std::move(on_data));
-        reqdata->reader = std::move(this->stub_->AsyncChanges(&reqdata->context, params, cq, static_cast<AsyncRequest*>(reqdata)));
-        reqdata->request_next();
+        this->admit(reqdata, &reqdata->in_flight, [=](EndpointChannel* channel) {
+            reqdata->reader = std::move(channel->stub->AsyncChanges(&reqdata->context, params, cq, static_cast<AsyncRequest*>(reqdata)));
+            reqdata->request_next();
+        });
     }
 
     class NearestAsyncRequestImpl : public AsyncRequest {
     public:
         bool process_batch() override {
             struct RawPoint placeholder;
-            Status status = Status::fromResponse(this->grpc_status, response_buffer);
+            Status status = this->in_flight.observe(Status::fromResponse(this->grpc_status, response_buffer));
 
             if (!status.isError()) {
                 this->response_to_value(&placeholder, response_buffer.value());
@@ -328,6 +910,11 @@ namespace btrdb {
             this->on_data(Status(), dummy, 0);
         }
 
+        void fail(const Status& status) override {
+            struct RawPoint dummy;
+            this->on_data(status, dummy, 0);
+        }
+
         inline void request_next() {
             this->reader->Finish(&this->response_buffer, &this->grpc_status, static_cast<AsyncRequest*>(this));
         }
@@ -340,6 +927,7 @@ namespace btrdb {
         grpcinterface::NearestResponse response_buffer;
         grpc::Status grpc_status;
         grpc::ClientContext context;
+        InFlight in_flight;
         std::function<void(Status, const struct RawPoint& rawpoint, std::uint64_t)> on_data;
         std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<grpcinterface::NearestResponse>> reader;
     };
@@ -354,14 +942,98 @@ namespace btrdb {
         NearestAsyncRequestImpl* reqdata = new NearestAsyncRequestImpl;
         ctx(&reqdata->context);
         reqdata->on_data = on_data;
-        reqdata->reader = this->stub_->AsyncNearest(&reqdata->context, params, cq);
-        reqdata->request_next();
+        this->admit(reqdata, &reqdata->in_flight, [=](EndpointChannel* channel) {
+            reqdata->reader = channel->stub->AsyncNearest(&reqdata->context, params, cq);
+            reqdata->request_next();
+        });
+    }
+
+    class StreamInfoAsyncRequestImpl : public AsyncRequest {
+    public:
+        bool process_batch() override {
+            Status status = this->in_flight.observe(Status::fromResponse(this->grpc_status, this->response_buffer));
+            this->on_data(status, this->response_buffer);
+            return true;
+        }
+
+        void end_request() override {
+            this->on_data(Status(), this->response_buffer);
+        }
+
+        void fail(const Status& status) override {
+            this->on_data(status, this->response_buffer);
+        }
+
+        inline void request_next() {
+            this->reader->Finish(&this->response_buffer, &this->grpc_status, static_cast<AsyncRequest*>(this));
+        }
+
+        grpcinterface::StreamInfoResponse response_buffer;
+        grpc::Status grpc_status;
+        grpc::ClientContext context;
+        InFlight in_flight;
+        std::function<void(Status, const grpcinterface::StreamInfoResponse&)> on_data;
+        std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<grpcinterface::StreamInfoResponse>> reader;
+    };
+
+    void Endpoint::streamInfoAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(Status, const grpcinterface::StreamInfoResponse&)> on_data, const void* uuid, bool omit_version, bool omit_descriptor) {
+        grpcinterface::StreamInfoParams params;
+        params.set_uuid(uuid, 16);
+        params.set_omitversion(omit_version);
+        params.set_omitdescriptor(omit_descriptor);
+
+        StreamInfoAsyncRequestImpl* reqdata = new StreamInfoAsyncRequestImpl;
+        ctx(&reqdata->context);
+        reqdata->on_data = on_data;
+        this->admit(reqdata, &reqdata->in_flight, [=](EndpointChannel* channel) {
+            reqdata->reader = channel->stub->AsyncStreamInfo(&reqdata->context, params, cq);
+            reqdata->request_next();
+        });
+    }
+
+    class SetStreamAnnotationsAsyncRequestImpl : public AsyncRequest {
+    public:
+        bool process_batch() override {
+            this->on_done(this->in_flight.observe(Status::fromResponse(this->grpc_status, this->response_buffer)));
+            return true;
+        }
+
+        void end_request() override {
+            this->on_done(Status());
+        }
+
+        void fail(const Status& status) override {
+            this->on_done(status);
+        }
+
+        inline void request_next() {
+            this->reader->Finish(&this->response_buffer, &this->grpc_status, static_cast<AsyncRequest*>(this));
+        }
+
+        grpcinterface::SetStreamAnnotationsResponse response_buffer;
+        grpc::Status grpc_status;
+        grpc::ClientContext context;
+        InFlight in_flight;
+        std::function<void(Status)> on_done;
+        std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<grpcinterface::SetStreamAnnotationsResponse>> reader;
+    };
+
+    void Endpoint::setStreamAnnotationsAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(Status)> on_done, const void* uuid, std::uint64_t expected_version, const std::map<std::string, std::pair<std::string, bool>>& changes) {
+        grpcinterface::SetStreamAnnotationsParams params = set_stream_annotations_params(uuid, expected_version, changes);
+
+        SetStreamAnnotationsAsyncRequestImpl* reqdata = new SetStreamAnnotationsAsyncRequestImpl;
+        ctx(&reqdata->context);
+        reqdata->on_done = on_done;
+        this->admit(reqdata, &reqdata->in_flight, [=](EndpointChannel* channel) {
+            reqdata->reader = channel->stub->AsyncSetStreamAnnotations(&reqdata->context, params, cq);
+            reqdata->request_next();
+        });
     }
 
     class InfoAsyncRequestImpl : public AsyncRequest {
     public:
         bool process_batch() override {
-            Status status = Status::fromResponse(this->grpc_status, this->response_buffer);
+            Status status = this->in_flight.observe(Status::fromResponse(this->grpc_status, this->response_buffer));
             this->on_data(status, this->response_buffer);
             return true;
         }
@@ -377,6 +1049,7 @@ namespace btrdb {
         grpcinterface::InfoResponse response_buffer;
         grpc::Status grpc_status;
         grpc::ClientContext context;
+        InFlight in_flight;
         std::function<void(Status, const grpcinterface::InfoResponse&)> on_data;
         std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<grpcinterface::InfoResponse>> reader;
     };
@@ -387,7 +1060,9 @@ namespace btrdb {
         InfoAsyncRequestImpl* reqdata = new InfoAsyncRequestImpl;
         ctx(&reqdata->context);
         reqdata->on_data = on_data;
-        reqdata->reader = this->stub_->AsyncInfo(&reqdata->context, params, cq);
+        std::shared_ptr<EndpointChannel> channel = this->pick();
+        reqdata->in_flight = InFlight(channel);
+        reqdata->reader = channel->stub->AsyncInfo(&reqdata->context, params, cq);
         reqdata->request_next();
     }
 
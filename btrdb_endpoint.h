@@ -1,18 +1,98 @@
 #ifndef BTRDB_ENDPOINT_H_
 #define BTRDB_ENDPOINT_H_
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 
 #include <grpc++/grpc++.h>
 #include <grpc/impl/codegen/gpr_types.h>
 
 #include "btrdb.grpc.pb.h"
+#include "btrdb_admission.h"
+#include "btrdb_breaker.h"
 #include "btrdb_stream.h"
 #include "btrdb_util.h"
 
 namespace btrdb {
     class Stream;
 
+    /*
+     * Tuning for the gRPC channels that an Endpoint opens. Sizes and
+     * intervals left at zero keep the gRPC default.
+     */
+    struct ChannelOptions {
+        /*
+         * Number of channels (and hence TCP connections) opened to each
+         * BTrDB member. RPCs are spread over them by fewest in flight.
+         */
+        std::size_t num_channels = 1;
+
+        /* Largest message that may be sent or received, in bytes (-1 for no limit). */
+        int max_send_message_size = 0;
+        int max_receive_message_size = 0;
+
+        /* Interval between keepalive pings, and how long to wait for the ack. */
+        int keepalive_time_ms = 0;
+        int keepalive_timeout_ms = 0;
+        /* Whether to send keepalive pings on a channel with no calls in flight. */
+        bool keepalive_permit_without_calls = false;
+        /* Time without calls after which a channel goes idle and disconnects. */
+        int idle_timeout_ms = 0;
+
+        /* Initial HTTP/2 stream flow-control window, in bytes. */
+        int http2_stream_window_size = 0;
+        /* Largest HTTP/2 frame the peer may send us, in bytes. */
+        int http2_max_frame_size = 0;
+        /* Whether to size flow-control windows by probing the bandwidth-delay product. */
+        bool http2_bdp_probe = true;
+
+        /*
+         * Default compression for calls on these channels. A ctx function
+         * can still override it for an individual call through
+         * ClientContext::set_compression_algorithm.
+         */
+        grpc_compression_algorithm compression = GRPC_COMPRESS_NONE;
+    };
+
+    /* One of the channels that an Endpoint spreads its RPCs over. */
+    struct EndpointChannel {
+        std::shared_ptr<grpc::Channel> channel;
+        std::unique_ptr<grpcinterface::BTrDB::Stub> stub;
+        std::atomic<std::uint32_t> in_flight;
+        /* Moving average of how long RPCs on this channel take, in microseconds. */
+        std::atomic<std::uint64_t> latency_us;
+        /* The Endpoint's breaker, or null if it has none. */
+        std::shared_ptr<CircuitBreaker> breaker;
+    };
+
+    /*
+     * Counts an RPC as in flight on a channel for as long as this object
+     * lives, and folds its lifetime into the channel's latency average.
+     */
+    class InFlight {
+    public:
+        InFlight() : channel_(), priority_(Priority::Interactive) {}
+        /* If admission is given, the slot taken from it is also released. */
+        explicit InFlight(std::shared_ptr<EndpointChannel> channel, std::shared_ptr<AdmissionQueue> admission = nullptr, Priority priority = Priority::Interactive);
+        InFlight(InFlight&& other);
+        InFlight& operator=(InFlight&& other);
+        InFlight(const InFlight&) = delete;
+        InFlight& operator=(const InFlight&) = delete;
+        ~InFlight();
+
+        /* Reports how the RPC ended to the Endpoint's circuit breaker, and returns status. */
+        Status observe(const Status& status);
+
+    private:
+        void release();
+
+        std::shared_ptr<EndpointChannel> channel_;
+        std::chrono::steady_clock::time_point start_;
+        std::shared_ptr<AdmissionQueue> admission_;
+        Priority priority_;
+    };
+
     template <typename ResponseType, typename IntermediateType, typename ValueType>
     class AsyncRequestImpl : public AsyncRequest {
     public:
@@ -24,7 +104,7 @@ namespace btrdb {
 
             if (status.isError()) {
                 std::vector<ValueType> dummy;
-                this->on_data(true, status, dummy);
+                this->on_data(true, this->in_flight.observe(status), dummy);
                 return true;
             }
 
@@ -32,7 +112,7 @@ namespace btrdb {
             if (num_values == 0) {
                 if (this->got_metadata) {
                     std::vector<ValueType> dummy;
-                    this->on_data(true, status, dummy);
+                    this->on_data(true, this->in_flight.observe(status), dummy);
                     return true;
                 } else {
                     this->got_metadata = true;
@@ -56,6 +136,11 @@ namespace btrdb {
             this->on_data(true, Status(), dummy);
         }
 
+        void fail(const Status& status) override {
+            std::vector<ValueType> dummy;
+            this->on_data(true, status, dummy);
+        }
+
         inline void request_next() {
             this->reader->Read(&this->response_buffer, static_cast<AsyncRequest*>(this));
         }
@@ -64,6 +149,7 @@ namespace btrdb {
         ResponseType response_buffer;
         grpc::Status status;
         grpc::ClientContext context;
+        InFlight in_flight;
         std::function<void(bool, Status, std::vector<ValueType>&)> on_data;
         std::unique_ptr<grpc::ClientAsyncReader<ResponseType>> reader;
     };
@@ -111,14 +197,22 @@ namespace btrdb {
         }
     };
 
+    grpcinterface::LookupStreamsParams lookup_streams_params(const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations);
+
     class Endpoint {
     public:
-        Endpoint(): channel_(), stub_() {}
+        explicit Endpoint(const ChannelOptions& options = ChannelOptions(), const AdmissionOptions& admission = AdmissionOptions(), const BreakerOptions& breaker = BreakerOptions());
+        ~Endpoint();
         bool connectBlocking(gpr_timespec deadline, const std::vector<std::string>& endpoints);
         void connect(const std::string& hostport);
+        /* Waits until the channels opened by connect are usable, or the deadline passes. */
+        bool waitForConnected(gpr_timespec deadline);
 
         Status insert(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::vector<struct RawPoint>::const_iterator data_start, std::vector<struct RawPoint>::const_iterator data_end, bool sync = false, std::uint64_t* version = nullptr);
+        /* Sends a request built with insert_params. */
+        Status insert(std::function<void(grpc::ClientContext*)> ctx, const grpcinterface::InsertParams& params, std::uint64_t* version = nullptr);
         Status deleteRange(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::int64_t start, std::int64_t end, std::uint64_t* version);
+        Status flush(std::function<void(grpc::ClientContext*)> ctx, const void* uuid);
         Status obliterate(std::function<void(grpc::ClientContext*)> ctx, const void* uuid);
         Status listAllCollections(std::function<void(grpc::ClientContext*)> ctx, std::vector<std::string>* collections);
         Status listCollections(std::function<void(grpc::ClientContext*)> ctx, const std::string& prefix, const std::string& from, std::uint64_t limit, std::vector<std::string>* collections);
@@ -126,6 +220,17 @@ namespace btrdb {
         Status info(std::function<void(grpc::ClientContext*)> ctx, grpcinterface::InfoResponse* response);
         Status streamInfo(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, grpcinterface::StreamInfoResponse* response, bool omit_version, bool omit_descriptor);
         Status create(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, const std::string& collection, const std::map<std::string, std::string>& tags, const std::map<std::string, std::string>& annotations);
+        Status setStreamAnnotations(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::uint64_t expected_version, const std::map<std::string, std::pair<std::string, bool>>& changes);
+
+        /* Blocking variants of the streaming queries, executed on the calling thread. */
+        Status lookupStreams(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> on_data, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations);
+        /* Like lookupStreams, but hands over each response as is, without building Streams. */
+        Status lookupStreamDescriptors(std::function<void(grpc::ClientContext*)> ctx, std::function<void(const grpcinterface::LookupStreamsResponse&)> on_response, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations);
+        Status rawValues(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<RawPoint>&, std::uint64_t)> on_data, const void* uuid, std::int64_t start, std::int64_t end, std::uint64_t version = 0);
+        Status alignedWindows(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, const void* uuid, std::int64_t start, std::int64_t end, std::uint8_t pointwidth, std::uint64_t version = 0);
+        Status windows(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, const void* uuid, std::int64_t start, std::int64_t end, std::uint64_t width, std::uint8_t depth, std::uint64_t version = 0);
+        Status changes(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct ChangedRange>&, std::uint64_t)> on_data, const void* uuid, std::uint64_t from_version, std::uint64_t to_version, std::uint8_t resolution = 0);
+        Status nearest(std::function<void(grpc::ClientContext*)> ctx, const void* uuid, std::int64_t timestamp, bool backward, std::uint64_t version, RawPoint* result, std::uint64_t* version_ptr);
 
         void lookupStreamsAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(bool, Status, std::vector<std::unique_ptr<Stream>>&)> on_data, const std::string& collection, bool is_prefix, const std::map<std::string, std::pair<std::string, bool>>& tags, const std::map<std::string, std::pair<std::string, bool>>& annotations);
         void rawValuesAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(bool, Status, std::vector<RawPoint>&, std::uint64_t)> on_data, const void* uuid, std::int64_t start, std::int64_t end, std::uint64_t version = 0);
@@ -134,10 +239,45 @@ namespace btrdb {
         void changesAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(bool, Status, std::vector<struct ChangedRange>&, std::uint64_t)> on_data, const void* uuid, std::uint64_t from_version, std::uint64_t to_version, std::uint8_t resolution = 0);
         void nearestAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(Status, const RawPoint& rawpoint, std::uint64_t)> on_data, const void* uuid, std::int64_t timestamp, bool backward, std::uint64_t version = 0);
         void infoAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(Status, const grpcinterface::InfoResponse& response)> on_data);
+        void streamInfoAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(Status, const grpcinterface::StreamInfoResponse&)> on_data, const void* uuid, bool omit_version, bool omit_descriptor);
+        void setStreamAnnotationsAsync(std::function<void(grpc::ClientContext*)> ctx, grpc::CompletionQueue* cq, std::function<void(Status)> on_done, const void* uuid, std::uint64_t expected_version, const std::map<std::string, std::pair<std::string, bool>>& changes);
+
+        /*
+         * Whether the circuit breaker lets requests through. If it returns
+         * false and sets *probe, the caller should check the member with
+         * infoAsync and report the result with probed().
+         */
+        bool healthy(bool* probe);
+        void probed(bool healthy);
+
+        /* The address given to connect. */
+        const std::string& hostport() const;
+
+        /* Queue depth and wait times of the admission scheduler (zero if it is disabled). */
+        AdmissionStats admissionStats();
+
+        std::size_t numChannels() const;
+        /* RPCs currently in flight to this member, over all channels. */
+        std::uint32_t inFlight() const;
+        /* Moving average RPC latency in microseconds, or 0 if nothing has completed yet. */
+        std::uint64_t latency() const;
 
     private:
-        std::shared_ptr<grpc::Channel> channel_;
-        std::unique_ptr<grpcinterface::BTrDB::Stub> stub_;
+        std::shared_ptr<EndpointChannel> pick();
+        /*
+         * Waits for admission (see AdmissionOptions) and picks a channel for
+         * a blocking RPC, giving up at context's deadline.
+         */
+        Status acquire(const grpc::ClientContext& context, std::shared_ptr<EndpointChannel>* channel, InFlight* in_flight);
+        /* Calls issue with a channel once admission lets the async request start. */
+        void admit(AsyncRequest* reqdata, InFlight* in_flight, std::function<void(EndpointChannel*)> issue);
+
+        ChannelOptions options_;
+        std::string hostport_;
+        std::vector<std::shared_ptr<EndpointChannel>> channels_;
+        std::atomic<std::size_t> next_channel_;
+        std::shared_ptr<AdmissionQueue> admission_;
+        std::shared_ptr<CircuitBreaker> breaker_;
     };
 }
 
@@ -0,0 +1,108 @@
+#include "btrdb_groupcommit.h"
+#include "btrdb.h"
+
+#include <chrono>
+#include <thread>
+
+namespace btrdb {
+    /* The deadline that ctx sets, or time_point::max() if it sets none. */
+    static std::chrono::system_clock::time_point ctx_deadline(const std::function<void(grpc::ClientContext*)>& ctx) {
+        grpc::ClientContext context;
+        ctx(&context);
+        return context.deadline();
+    }
+
+    GroupCommit::GroupCommit(const GroupCommitOptions& options) : options_(options) {
+    }
+
+    GroupCommit::stream_state& GroupCommit::stateFor(Stream* stream) {
+        std::string key(reinterpret_cast<const char*>(stream->UUID()), UUID_NUM_BYTES);
+        std::unique_ptr<stream_state>& state = this->streams_[key];
+        if (state == nullptr) {
+            state.reset(new stream_state);
+        }
+        return *state;
+    }
+
+    Status GroupCommit::insert(std::function<void(grpc::ClientContext*)> ctx, Stream* stream, std::uint64_t* version_ptr, const struct RawPoint* data, std::size_t count) {
+        Status status = stream->insert(ctx, version_ptr, data, count, false);
+        if (status.isError()) {
+            return status;
+        }
+
+        std::unique_lock<std::mutex> lock(this->lock_);
+        stream_state& state = this->stateFor(stream);
+        std::uint64_t seq = ++state.written;
+        this->stats_.inserts++;
+        return this->waitDurable(ctx, stream, state, seq, lock);
+    }
+
+    Status GroupCommit::insert(std::function<void(grpc::ClientContext*)> ctx, Stream* stream, std::uint64_t* version_ptr, std::vector<struct RawPoint>::const_iterator data_start, std::vector<struct RawPoint>::const_iterator data_end) {
+        std::size_t count = data_end - data_start;
+        return this->insert(ctx, stream, version_ptr, (count == 0) ? nullptr : &*data_start, count);
+    }
+
+    Status GroupCommit::commit(std::function<void(grpc::ClientContext*)> ctx, Stream* stream) {
+        std::unique_lock<std::mutex> lock(this->lock_);
+        stream_state& state = this->stateFor(stream);
+        return this->waitDurable(ctx, stream, state, state.written, lock);
+    }
+
+    Status GroupCommit::waitDurable(std::function<void(grpc::ClientContext*)> ctx, Stream* stream, stream_state& state, std::uint64_t seq, std::unique_lock<std::mutex>& lock) {
+        /* Only a flush that starts after we do can fail on our behalf; an older failure is retried. */
+        std::uint64_t entered = state.flushes_started;
+        bool has_deadline = false;
+        std::chrono::system_clock::time_point deadline;
+        for (;;) {
+            if (state.durable >= seq) {
+                return Status();
+            }
+            if (state.failed_flush > entered && state.failed_through >= seq) {
+                return state.failed_status;
+            }
+            if (state.flushing) {
+                /* The flush in flight may have been sent before this insert returned; wait for the next one. */
+                if (!has_deadline) {
+                    deadline = ctx_deadline(ctx);
+                    has_deadline = true;
+                }
+                if (deadline == std::chrono::system_clock::time_point::max()) {
+                    state.changed.wait(lock);
+                } else if (state.changed.wait_until(lock, deadline) == std::cv_status::timeout && state.durable < seq) {
+                    return Status(grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, "Deadline exceeded while waiting for a shared flush"));
+                }
+                continue;
+            }
+
+            state.flushing = true;
+            std::uint64_t flush = ++state.flushes_started;
+            if (this->options_.delay_us != 0) {
+                lock.unlock();
+                std::this_thread::sleep_for(std::chrono::microseconds(this->options_.delay_us));
+                lock.lock();
+            }
+            /* Only inserts that have returned by now are certain to be covered by the flush. */
+            std::uint64_t through = state.written;
+            lock.unlock();
+            Status status = stream->flush(ctx);
+            lock.lock();
+
+            state.flushing = false;
+            this->stats_.flushes++;
+            if (status.isError()) {
+                this->stats_.failed_flushes++;
+                state.failed_flush = flush;
+                state.failed_through = through;
+                state.failed_status = status;
+            } else {
+                state.durable = std::max(state.durable, through);
+            }
+            state.changed.notify_all();
+        }
+    }
+
+    GroupCommitStats GroupCommit::stats() {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        return this->stats_;
+    }
+}
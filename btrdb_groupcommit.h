@@ -0,0 +1,84 @@
+#ifndef BTRDB_GROUPCOMMIT_H_
+#define BTRDB_GROUPCOMMIT_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <grpc++/grpc++.h>
+
+#include "btrdb_util.h"
+
+namespace btrdb {
+    class Stream;
+
+    struct GroupCommitOptions {
+        /*
+         * How long the writer that starts a flush waits first, so that more
+         * inserts can share it (0 flushes at once; writers that arrive while
+         * a flush is in flight still share the next one).
+         */
+        std::uint32_t delay_us = 0;
+    };
+
+    struct GroupCommitStats {
+        std::uint64_t inserts = 0;
+        std::uint64_t flushes = 0;
+        std::uint64_t failed_flushes = 0;
+    };
+
+    /*
+     * Durable inserts without a commit per insert. Each insert is sent
+     * without sync and then waits for a Flush of its stream that was
+     * issued after it returned; one writer sends that Flush on behalf of
+     * every insert waiting on the stream, and all of them get its result.
+     * The Flush is sent with the ctx of the writer that sends it, so its
+     * deadline and metadata apply to everyone sharing that Flush; a
+     * writer that is only waiting gives up at its own deadline.
+     */
+    class GroupCommit {
+    public:
+        explicit GroupCommit(const GroupCommitOptions& options = GroupCommitOptions());
+        GroupCommit(const GroupCommit&) = delete;
+        GroupCommit& operator=(const GroupCommit&) = delete;
+
+        /* Like Stream::insert with sync, but sharing the commit with concurrent writers to the stream. */
+        Status insert(std::function<void(grpc::ClientContext*)> ctx, Stream* stream, std::uint64_t* version_ptr, const struct RawPoint* data, std::size_t count);
+        Status insert(std::function<void(grpc::ClientContext*)> ctx, Stream* stream, std::uint64_t* version_ptr, std::vector<struct RawPoint>::const_iterator data_start, std::vector<struct RawPoint>::const_iterator data_end);
+        /* Waits until every insert into stream through this GroupCommit that returned before the call is durable. */
+        Status commit(std::function<void(grpc::ClientContext*)> ctx, Stream* stream);
+
+        GroupCommitStats stats();
+
+    private:
+        struct stream_state {
+            std::condition_variable changed;
+            /* Inserts are numbered in the order they returned; flushes cover a prefix of them. */
+            std::uint64_t written = 0;
+            std::uint64_t durable = 0;
+            /* Flushes are numbered as they start; the last one to fail, the last insert it covered, and its error. */
+            std::uint64_t flushes_started = 0;
+            std::uint64_t failed_flush = 0;
+            std::uint64_t failed_through = 0;
+            Status failed_status;
+            bool flushing = false;
+        };
+
+        stream_state& stateFor(Stream* stream);
+        /* Waits until insert number seq is durable, flushing on behalf of everyone if nobody is. */
+        Status waitDurable(std::function<void(grpc::ClientContext*)> ctx, Stream* stream, stream_state& state, std::uint64_t seq, std::unique_lock<std::mutex>& lock);
+
+        GroupCommitOptions options_;
+        std::mutex lock_;
+        /* Keyed by UUID; entries are never removed, so references stay valid. */
+        std::unordered_map<std::string, std::unique_ptr<stream_state>> streams_;
+        GroupCommitStats stats_;
+    };
+}
+
+#endif // BTRDB_GROUPCOMMIT_H_
@@ -0,0 +1,139 @@
+#include "btrdb_hedge.h"
+
+#include <algorithm>
+
+namespace btrdb {
+    /* Don't trust a percentile taken over fewer latencies than this. */
+    static const constexpr std::size_t HEDGE_MIN_SAMPLES = 32;
+    /* Budget saved up while idle, in duplicates. */
+    static const constexpr double HEDGE_MAX_TOKENS = 10;
+
+    HedgePolicy::HedgePolicy(const HedgeOptions& options)
+        : options_(options), next_sample_(0), since_update_(0), delay_us_(0), tokens_(0) {
+        if (this->options_.window < HEDGE_MIN_SAMPLES) {
+            this->options_.window = HEDGE_MIN_SAMPLES;
+        }
+        this->samples_.reserve(this->options_.window);
+    }
+
+    bool HedgePolicy::delay(std::chrono::microseconds* delay) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        this->tokens_ = std::min(this->tokens_ + this->options_.budget, HEDGE_MAX_TOKENS);
+        if (this->samples_.size() < HEDGE_MIN_SAMPLES) {
+            return false;
+        }
+
+        /* Recomputing the percentile is linear, so only do it now and then. */
+        if (this->delay_us_ == 0 || this->since_update_ >= this->samples_.size() / 16) {
+            std::vector<std::uint64_t> sorted(this->samples_);
+            std::size_t rank = (std::size_t) (this->options_.percentile * (sorted.size() - 1));
+            rank = std::min(rank, sorted.size() - 1);
+            std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+            this->delay_us_ = std::max<std::uint64_t>(sorted[rank], this->options_.min_delay_us);
+            this->since_update_ = 0;
+        }
+
+        *delay = std::chrono::microseconds(this->delay_us_);
+        return true;
+    }
+
+    bool HedgePolicy::spend() {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        if (this->tokens_ < 1) {
+            return false;
+        }
+        this->tokens_ -= 1;
+        return true;
+    }
+
+    void HedgePolicy::record(std::chrono::microseconds latency) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        std::uint64_t sample = latency.count();
+        if (this->samples_.size() < this->options_.window) {
+            this->samples_.push_back(sample);
+        } else {
+            this->samples_[this->next_sample_] = sample;
+            this->next_sample_ = (this->next_sample_ + 1) % this->samples_.size();
+        }
+        this->since_update_++;
+    }
+
+    HedgedCall::HedgedCall(std::shared_ptr<HedgePolicy> policy)
+        : policy_(std::move(policy)), start_(std::chrono::steady_clock::now()),
+          winner_(-1), contexts_{nullptr, nullptr}, timer_(nullptr) {}
+
+    std::function<void(grpc::ClientContext*)> HedgedCall::attempt(std::function<void(grpc::ClientContext*)> ctx, int index) {
+        std::shared_ptr<HedgedCall> self = shared_from_this();
+        return [=](grpc::ClientContext* context) {
+            ctx(context);
+            std::lock_guard<std::mutex> lock(self->lock_);
+            self->contexts_[index] = context;
+        };
+    }
+
+    bool HedgedCall::claim(int index) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        if (this->winner_ != -1) {
+            return this->winner_ == index;
+        }
+
+        this->winner_ = index;
+        auto elapsed = std::chrono::steady_clock::now() - this->start_;
+        this->policy_->record(std::chrono::duration_cast<std::chrono::microseconds>(elapsed));
+
+        grpc::ClientContext* loser = this->contexts_[1 - index];
+        if (loser != nullptr) {
+            loser->TryCancel();
+        }
+        if (this->timer_ != nullptr) {
+            /* The timer is freed once its cancellation is delivered. */
+            this->timer_->alarm->Cancel();
+        }
+        return true;
+    }
+
+    void HedgedCall::release(int index) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        this->contexts_[index] = nullptr;
+    }
+
+    void HedgedCall::hedgeAfter(grpc::CompletionQueue* cq, std::function<void()> send) {
+        std::chrono::microseconds delay;
+        if (!this->policy_->delay(&delay)) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(this->lock_);
+        if (this->winner_ != -1) {
+            return;
+        }
+        HedgeTimer* timer = new HedgeTimer;
+        timer->call = shared_from_this();
+        timer->send = std::move(send);
+        auto deadline = std::chrono::system_clock::now() + delay;
+        timer->alarm.reset(new grpc::Alarm(cq, deadline, static_cast<AsyncRequest*>(timer)));
+        this->timer_ = timer;
+    }
+
+    void HedgedCall::fired(bool ok, const std::function<void()>& send) {
+        {
+            std::lock_guard<std::mutex> lock(this->lock_);
+            this->timer_ = nullptr;
+            if (!ok || this->winner_ != -1) {
+                return;
+            }
+        }
+        if (this->policy_->spend()) {
+            send();
+        }
+    }
+
+    bool HedgeTimer::process_batch() {
+        this->call->fired(true, this->send);
+        return true;
+    }
+
+    void HedgeTimer::end_request() {
+        this->call->fired(false, this->send);
+    }
+}
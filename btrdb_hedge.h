@@ -0,0 +1,106 @@
+#ifndef BTRDB_HEDGE_H_
+#define BTRDB_HEDGE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <grpc++/grpc++.h>
+#include <grpc++/alarm.h>
+
+#include "btrdb_util.h"
+
+namespace btrdb {
+    /*
+     * Hedging for latency-sensitive point queries: nearestAsync, and
+     * rawValuesAsync over short ranges. If a query has not been answered
+     * after the given percentile of recent latency, a duplicate is sent to
+     * another of the member's gRPC addresses; the first to answer is used
+     * and the other is cancelled. Members with a single address are not
+     * hedged.
+     */
+    struct HedgeOptions {
+        bool enabled = false;
+        /* Percentile of recent latencies after which to send the duplicate. */
+        double percentile = 0.95;
+        /* Never send the duplicate sooner than this. */
+        std::uint32_t min_delay_us = 500;
+        /* How many recent latencies the percentile is taken over. */
+        std::size_t window = 1024;
+        /* Duplicates sent, as a fraction of queries eligible for hedging, at most. */
+        double budget = 0.05;
+        /* rawValues queries spanning more nanoseconds than this are not hedged. */
+        std::int64_t max_raw_values_span = INT64_C(60000000000);
+    };
+
+    /* Recent latency and the remaining budget, shared by all hedged queries. */
+    class HedgePolicy {
+    public:
+        explicit HedgePolicy(const HedgeOptions& options);
+
+        /*
+         * Called once per eligible query, which earns budget. Returns
+         * false if there is not enough history to pick a delay yet.
+         */
+        bool delay(std::chrono::microseconds* delay);
+        /* Takes budget for one duplicate, or returns false if there is none left. */
+        bool spend();
+        void record(std::chrono::microseconds latency);
+
+    private:
+        HedgeOptions options_;
+        std::mutex lock_;
+        std::vector<std::uint64_t> samples_;
+        std::size_t next_sample_;
+        std::size_t since_update_;
+        std::uint64_t delay_us_;
+        double tokens_;
+    };
+
+    class HedgeTimer;
+
+    /*
+     * The attempts of one hedged query, numbered 0 (the original) and 1
+     * (the duplicate). The first attempt to answer wins, and the other is
+     * cancelled.
+     */
+    class HedgedCall : public std::enable_shared_from_this<HedgedCall> {
+    public:
+        explicit HedgedCall(std::shared_ptr<HedgePolicy> policy);
+
+        /* Wraps ctx so that the attempt can be cancelled if it loses. */
+        std::function<void(grpc::ClientContext*)> attempt(std::function<void(grpc::ClientContext*)> ctx, int index);
+        /* Returns whether attempt index won, making it the winner if nothing has answered yet. */
+        bool claim(int index);
+        /* Must be called once attempt index has finished, before its request is freed. */
+        void release(int index);
+        /* Calls send after the policy's delay, unless an attempt answers first. */
+        void hedgeAfter(grpc::CompletionQueue* cq, std::function<void()> send);
+
+    private:
+        friend class HedgeTimer;
+        void fired(bool ok, const std::function<void()>& send);
+
+        std::shared_ptr<HedgePolicy> policy_;
+        std::chrono::steady_clock::time_point start_;
+        std::mutex lock_;
+        int winner_;
+        grpc::ClientContext* contexts_[2];
+        HedgeTimer* timer_;
+    };
+
+    class HedgeTimer : public AsyncRequest {
+    public:
+        bool process_batch() override;
+        void end_request() override;
+
+        std::shared_ptr<HedgedCall> call;
+        std::function<void()> send;
+        std::unique_ptr<grpc::Alarm> alarm;
+    };
+}
+
+#endif // BTRDB_HEDGE_H_
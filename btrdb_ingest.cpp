@@ -0,0 +1,219 @@
+#include "btrdb_ingest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+namespace btrdb {
+    /* Batches this small are insertion sorted; the radix sort's histograms would cost more. */
+    static const constexpr std::size_t SMALL_BATCH = 64;
+
+    /* Batches up to this size (256 KiB) are sorted with LSD passes, which stay in cache. */
+    static const constexpr std::size_t CACHE_BATCH = 1 << 14;
+    /* Bits that each MSD pass splits a larger batch by. */
+    static const constexpr int MSD_BITS = 11;
+
+    static void insertion_sort(struct RawPoint* data, std::size_t n) {
+        for (std::size_t i = 1; i < n; i++) {
+            struct RawPoint point = data[i];
+            std::size_t j = i;
+            while (j != 0 && data[j - 1].time > point.time) {
+                data[j] = data[j - 1];
+                j--;
+            }
+            data[j] = point;
+        }
+    }
+
+    /* Offset of a time from the batch's earliest, which fits in bits bits. */
+    static inline std::uint64_t offset_of(const struct RawPoint& point, std::int64_t base) {
+        return (std::uint64_t) point.time - (std::uint64_t) base;
+    }
+
+    /* Stable LSD radix sort by the low bits bits of the offset, a byte per pass; scratch holds n points. */
+    static void lsd_sort(struct RawPoint* data, struct RawPoint* scratch, std::size_t n, std::int64_t base, int bits) {
+        const int passes = (bits + 7) / 8;
+        std::size_t counts[8][256];
+        std::memset(counts, 0, sizeof(counts));
+        for (std::size_t i = 0; i != n; i++) {
+            std::uint64_t key = offset_of(data[i], base);
+            for (int b = 0; b != passes; b++) {
+                counts[b][(key >> (8 * b)) & 0xFF]++;
+            }
+        }
+
+        std::uint64_t first_key = offset_of(data[0], base);
+        struct RawPoint* from = data;
+        struct RawPoint* to = scratch;
+        for (int b = 0; b != passes; b++) {
+            /* A byte that every point shares does not reorder anything. */
+            if (counts[b][(first_key >> (8 * b)) & 0xFF] == n) {
+                continue;
+            }
+            std::size_t offsets[256];
+            std::size_t offset = 0;
+            for (int d = 0; d != 256; d++) {
+                offsets[d] = offset;
+                offset += counts[b][d];
+            }
+            for (std::size_t i = 0; i != n; i++) {
+                to[offsets[(offset_of(from[i], base) >> (8 * b)) & 0xFF]++] = from[i];
+            }
+            std::swap(from, to);
+        }
+        if (from != data) {
+            std::memcpy(data, from, n * sizeof(struct RawPoint));
+        }
+    }
+
+    /*
+     * Stable radix sort by the low bits bits of the offset. Large batches
+     * are first split on the top MSD_BITS bits, so that the LSD passes
+     * over each part run in cache instead of scattering across the whole
+     * batch once per byte.
+     */
+    static void sort_bits(struct RawPoint* data, struct RawPoint* scratch, std::size_t n, std::int64_t base, int bits) {
+        if (n < SMALL_BATCH) {
+            insertion_sort(data, n);
+            return;
+        }
+        if (n <= CACHE_BATCH || bits <= 8) {
+            lsd_sort(data, scratch, n, base, bits);
+            return;
+        }
+
+        /* Within a recursive call the bits above bits are the same for every point, and masked off. */
+        const int shift = (bits > MSD_BITS) ? bits - MSD_BITS : 0;
+        const std::uint64_t mask = (bits == 64) ? ~UINT64_C(0) : (UINT64_C(1) << bits) - 1;
+        std::vector<std::size_t> offsets((std::size_t) 1 << MSD_BITS, 0);
+        for (std::size_t i = 0; i != n; i++) {
+            offsets[(offset_of(data[i], base) & mask) >> shift]++;
+        }
+        std::size_t offset = 0;
+        for (std::size_t& count : offsets) {
+            std::size_t bucket_size = count;
+            count = offset;
+            offset += bucket_size;
+        }
+        for (std::size_t i = 0; i != n; i++) {
+            scratch[offsets[(offset_of(data[i], base) & mask) >> shift]++] = data[i];
+        }
+
+        /* Each bucket now ends where the next begins. */
+        std::size_t start = 0;
+        for (std::size_t end : offsets) {
+            if (end != start) {
+                sort_bits(scratch + start, data + start, end - start, base, shift);
+                std::memcpy(data + start, scratch + start, (end - start) * sizeof(struct RawPoint));
+            }
+            start = end;
+        }
+    }
+
+    static void radix_sort(struct RawPoint* data, struct RawPoint* scratch, std::size_t n) {
+        if (n < SMALL_BATCH) {
+            insertion_sort(data, n);
+            return;
+        }
+        std::int64_t min = data[0].time;
+        std::int64_t max = data[0].time;
+        for (std::size_t i = 1; i != n; i++) {
+            min = std::min(min, data[i].time);
+            max = std::max(max, data[i].time);
+        }
+        int bits = 0;
+        while (bits != 64 && ((std::uint64_t) max - (std::uint64_t) min) >> bits != 0) {
+            bits++;
+        }
+        sort_bits(data, scratch, n, min, bits);
+    }
+
+    static bool by_time(const struct RawPoint& a, const struct RawPoint& b) {
+        return a.time < b.time;
+    }
+
+    /*
+     * Sorts equal slices of data on separate threads, then merges them
+     * pairwise, also in parallel. std::merge takes ties from its first
+     * range first, so the result is stable like the radix sort.
+     */
+    static void parallel_sort(struct RawPoint* data, std::size_t n, std::size_t num_threads) {
+        std::unique_ptr<struct RawPoint[]> scratch(new struct RawPoint[n]);
+        std::vector<std::size_t> bounds(num_threads + 1);
+        for (std::size_t t = 0; t <= num_threads; t++) {
+            bounds[t] = n * t / num_threads;
+        }
+
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t != num_threads; t++) {
+            threads.emplace_back([&, t]() {
+                radix_sort(data + bounds[t], scratch.get() + bounds[t], bounds[t + 1] - bounds[t]);
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        struct RawPoint* from = data;
+        struct RawPoint* to = scratch.get();
+        while (bounds.size() > 2) {
+            std::vector<std::size_t> merged;
+            threads.clear();
+            std::size_t r = 0;
+            for (; r + 2 < bounds.size(); r += 2) {
+                std::size_t lo = bounds[r];
+                std::size_t mid = bounds[r + 1];
+                std::size_t hi = bounds[r + 2];
+                threads.emplace_back([=]() {
+                    std::merge(from + lo, from + mid, from + mid, from + hi, to + lo, by_time);
+                });
+                merged.push_back(lo);
+            }
+            if (r + 1 < bounds.size()) {
+                /* An odd run out; carry it over as it is. */
+                std::memcpy(to + bounds[r], from + bounds[r], (bounds[r + 1] - bounds[r]) * sizeof(struct RawPoint));
+                merged.push_back(bounds[r]);
+            }
+            merged.push_back(n);
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+            bounds = std::move(merged);
+            std::swap(from, to);
+        }
+        if (from != data) {
+            std::memcpy(data, from, n * sizeof(struct RawPoint));
+        }
+    }
+
+    void prepare_points(std::vector<struct RawPoint>* points, const PrepareOptions& options) {
+        struct RawPoint* data = points->data();
+        std::size_t n = points->size();
+
+        /* Batches usually arrive mostly in order; one that is already sorted only needs the dedupe. */
+        bool sorted = true;
+        for (std::size_t i = 1; i < n && sorted; i++) {
+            sorted = data[i - 1].time <= data[i].time;
+        }
+        if (!sorted) {
+            std::size_t num_threads = std::max<std::uint32_t>(options.threads, 1);
+            if (num_threads > 1 && n >= options.parallel_threshold && n >= num_threads * SMALL_BATCH) {
+                parallel_sort(data, n, num_threads);
+            } else {
+                std::unique_ptr<struct RawPoint[]> scratch(new struct RawPoint[n]);
+                radix_sort(data, scratch.get(), n);
+            }
+        }
+
+        /* Equal times are adjacent and in input order, so the last of each run wins. */
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i != n; i++) {
+            if (i + 1 != n && data[i + 1].time == data[i].time) {
+                continue;
+            }
+            data[kept++] = data[i];
+        }
+        points->resize(kept);
+    }
+}
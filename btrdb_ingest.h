@@ -0,0 +1,27 @@
+#ifndef BTRDB_INGEST_H_
+#define BTRDB_INGEST_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "btrdb_util.h"
+
+namespace btrdb {
+    struct PrepareOptions {
+        /* Threads that sort a large batch (1 sorts on the calling thread only). */
+        std::uint32_t threads = 1;
+        /* Batches smaller than this are sorted on the calling thread whatever threads says. */
+        std::size_t parallel_threshold = 1 << 20;
+    };
+
+    /*
+     * Readies a batch of points for Stream::insert: sorts it by time and,
+     * where several points share a time, keeps only the last of them in
+     * the original order. Uses a radix sort on the time, which skips the
+     * bytes that every point has in common, so batches spanning a short
+     * time range sort in few passes.
+     */
+    void prepare_points(std::vector<struct RawPoint>* points, const PrepareOptions& options = PrepareOptions());
+}
+
+#endif // BTRDB_INGEST_H_
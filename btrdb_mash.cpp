@@ -1,4 +1,5 @@
 #include "btrdb_mash.h"
+#include <algorithm>
 #include <sstream>
 #include "btrdb_util.h"
 
@@ -54,6 +55,60 @@ std::uint32_t murmur3(const void* data, std::size_t len, std::uint32_t seed=1) {
     return h;
 }
 
+/* murmur3 above, unrolled for UUID_NUM_BYTES; the hashes are identical. */
+static inline std::uint32_t murmur3_block(std::uint32_t h, const std::uint8_t* key) {
+    std::uint32_t k = ((std::uint32_t) key[0]) |
+                      (((std::uint32_t) key[1]) << 8) |
+                      (((std::uint32_t) key[2]) << 16) |
+                      (((std::uint32_t) key[3]) << 24);
+    k *= 0xcc9e2d51;
+    k = (k << 15) | (k >> 17);
+    k *= 0x1b873593;
+    h ^= k;
+    h = (h << 13) | (h >> 19);
+    return (h * 5) + 0xe6546b64;
+}
+
+static inline std::uint32_t murmur3_finish(std::uint32_t h) {
+    h ^= btrdb::UUID_NUM_BYTES;
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+}
+
+static inline std::uint32_t murmur3_uuid(const std::uint8_t* uuid) {
+    std::uint32_t h = 1;
+    for (std::size_t i = 0; i != btrdb::UUID_NUM_BYTES - 3; i++) {
+        h = murmur3_block(h, &uuid[i]);
+    }
+    return murmur3_finish(h);
+}
+
+/*
+ * Four UUIDs at a time. Each hash is a serial chain of multiplies, so
+ * interleaving independent ones keeps the multiplier busy.
+ */
+static inline void murmur3_uuids4(const std::uint8_t* uuids, std::uint32_t* out) {
+    const std::uint8_t* a = uuids;
+    const std::uint8_t* b = a + btrdb::UUID_NUM_BYTES;
+    const std::uint8_t* c = b + btrdb::UUID_NUM_BYTES;
+    const std::uint8_t* d = c + btrdb::UUID_NUM_BYTES;
+    std::uint32_t ha = 1, hb = 1, hc = 1, hd = 1;
+    for (std::size_t i = 0; i != btrdb::UUID_NUM_BYTES - 3; i++) {
+        ha = murmur3_block(ha, &a[i]);
+        hb = murmur3_block(hb, &b[i]);
+        hc = murmur3_block(hc, &c[i]);
+        hd = murmur3_block(hd, &d[i]);
+    }
+    out[0] = murmur3_finish(ha);
+    out[1] = murmur3_finish(hb);
+    out[2] = murmur3_finish(hc);
+    out[3] = murmur3_finish(hd);
+}
+
 namespace btrdb {
     MASH::MASH(const grpcinterface::Mash& mash) : m_(mash) {
         this->precalculate();
@@ -62,21 +117,144 @@ namespace btrdb {
     void MASH::setProtoMash(const grpcinterface::Mash& mash) {
         this->m_ = mash;
         this->eps_.clear();
+        this->ranges_.clear();
         this->precalculate();
     }
 
     bool MASH::endpointFor(const void* uuid, std::vector<std::string>* addrs, uint32_t* hash) {
-        std::uint32_t hsh = murmur3(uuid, UUID_NUM_BYTES);
+        std::uint32_t hsh = murmur3_uuid(reinterpret_cast<const std::uint8_t*>(uuid));
+        std::size_t i = this->lookup(hsh);
+        if (i == NO_MEMBER) {
+            return false;
+        }
+        const struct endpoint& e = this->eps_[i];
+        *addrs = e.grpc;
+        if (hash != nullptr) {
+            *hash = e.hash;
+        }
+        return true;
+    }
+
+    std::size_t MASH::route(const void* uuids, std::size_t count, std::vector<route_group>* groups, std::vector<std::size_t>* unrouted) {
+        const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(uuids);
+        const constexpr std::size_t LANES = 4;
+
+        /* Find each UUID's member, then bucket the indices by member (a counting sort). */
+        std::vector<std::uint32_t> member(count);
+        std::vector<std::size_t> counts(this->eps_.size(), 0);
+        std::size_t num_unrouted = 0;
+        std::uint32_t hashes[LANES];
+        for (std::size_t i = 0; i < count; i += LANES) {
+            std::size_t n = std::min(LANES, count - i);
+            if (n == LANES) {
+                murmur3_uuids4(&bytes[i * UUID_NUM_BYTES], hashes);
+            } else {
+                for (std::size_t l = 0; l != n; l++) {
+                    hashes[l] = murmur3_uuid(&bytes[(i + l) * UUID_NUM_BYTES]);
+                }
+            }
+            for (std::size_t l = 0; l != n; l++) {
+                std::size_t m = this->lookup(hashes[l]);
+                member[i + l] = (std::uint32_t) m;
+                if (m == NO_MEMBER) {
+                    num_unrouted++;
+                } else {
+                    counts[m]++;
+                }
+            }
+        }
+
+        groups->clear();
+        std::vector<std::size_t> group_of(this->eps_.size());
+        for (std::size_t m = 0; m != this->eps_.size(); m++) {
+            if (counts[m] != 0) {
+                group_of[m] = groups->size();
+                groups->emplace_back();
+                route_group& g = groups->back();
+                g.hash = this->eps_[m].hash;
+                g.grpc = this->eps_[m].grpc;
+                g.indices.reserve(counts[m]);
+            }
+        }
+        if (unrouted != nullptr) {
+            unrouted->clear();
+            unrouted->reserve(num_unrouted);
+        }
+        for (std::size_t i = 0; i != count; i++) {
+            std::uint32_t m = member[i];
+            if (m == NO_MEMBER) {
+                if (unrouted != nullptr) {
+                    unrouted->push_back(i);
+                }
+            } else {
+                (*groups)[group_of[m]].indices.push_back(i);
+            }
+        }
+        return num_unrouted;
+    }
+
+    std::size_t MASH::lookup(std::uint32_t hash) const {
+        if (this->ranges_.empty()) {
+            return NO_MEMBER;
+        }
+
+        /*
+         * Find the last range that starts at or before hash, which is the
+         * only one that can hold it. The search has no data-dependent
+         * branches, since hashes of random UUIDs defeat branch prediction.
+         */
+        const struct range* base = this->ranges_.data();
+        std::size_t n = this->ranges_.size();
+        while (n > 1) {
+            std::size_t half = n / 2;
+            base = (base[half].start <= hash) ? base + half : base;
+            n -= half;
+        }
+        if (base->start > hash || base->end <= hash) {
+            return NO_MEMBER;
+        }
+        return base->member;
+    }
+
+    bool MASH::memberFor(const std::string& addr, uint32_t* hash) {
+        for (const struct endpoint& e : this->eps_) {
+            for (const std::string& grpc : e.grpc) {
+                if (grpc == addr) {
+                    *hash = e.hash;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool MASH::hasMember(uint32_t hash) {
         for (const struct endpoint& e : this->eps_) {
-            if (e.start <= hsh && e.end > hsh) {
-                *addrs = e.grpc;
-                *hash = e.hash;
+            if (e.hash == hash && !e.grpc.empty()) {
                 return true;
             }
         }
         return false;
     }
 
+    std::int64_t MASH::revision() const {
+        return this->m_.revision();
+    }
+
+    const grpcinterface::Mash& MASH::proto() const {
+        return this->m_;
+    }
+
+    std::vector<MASH::member> MASH::members() const {
+        std::vector<member> result;
+        for (const struct endpoint& e : this->eps_) {
+            if (!e.grpc.empty()) {
+                result.push_back({ e.hash, e.read_preference, e.grpc });
+            }
+        }
+        return result;
+    }
+
     void MASH::precalculate() {
         const auto& members = this->m_.members();
         int num_members = members.size();
@@ -88,8 +266,13 @@ namespace btrdb {
                 ep.start = mbr.start();
                 ep.end = mbr.end();
                 ep.hash = mbr.hash();
+                ep.read_preference = mbr.readpreference();
                 ep.grpc = split_string(mbr.grpcendpoints(), ';');
+                this->ranges_.push_back({ ep.start, ep.end, (std::uint32_t) i });
             }
         }
+        std::sort(this->ranges_.begin(), this->ranges_.end(), [](const range& a, const range& b) {
+            return a.start < b.start;
+        });
     }
 }
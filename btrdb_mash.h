@@ -2,26 +2,67 @@
 #define BTRDB_MASH_H_
 
 #include <cstdint>
+#include <string>
+#include <vector>
 #include "btrdb.pb.h"
 
 namespace btrdb {
     class MASH {
     public:
+        struct member {
+            std::uint32_t hash;
+            double read_preference;
+            std::vector<std::string> grpc;
+        };
+
+        /* UUIDs that map to the same member, as indices into the array given to route. */
+        struct route_group {
+            std::uint32_t hash;
+            std::vector<std::string> grpc;
+            std::vector<std::size_t> indices;
+        };
+
         MASH(const grpcinterface::Mash& mash);
         void setProtoMash(const grpcinterface::Mash& mash);
         bool endpointFor(const void* uuid, std::vector<std::string>* addrs, uint32_t* hash = nullptr);
+        /*
+         * Routes count UUIDs, stored back to back, at once: each member
+         * that owns some of them gets a group in *groups, in member order.
+         * Returns the number of UUIDs that no member owns (the cluster is
+         * degraded), and lists them in *unrouted if it is given.
+         */
+        std::size_t route(const void* uuids, std::size_t count, std::vector<route_group>* groups, std::vector<std::size_t>* unrouted = nullptr);
+        bool memberFor(const std::string& addr, uint32_t* hash);
+        bool hasMember(uint32_t hash);
+        std::int64_t revision() const;
+        const grpcinterface::Mash& proto() const;
+        /* The members that are in the cluster and up, and can serve requests. */
+        std::vector<member> members() const;
     private:
         void precalculate();
+        /* Index in eps_ of the member that owns hash, or NO_MEMBER. */
+        std::size_t lookup(std::uint32_t hash) const;
+
+        static const constexpr std::uint32_t NO_MEMBER = 0xFFFFFFFF;
 
         struct endpoint {
             std::int64_t start;
             std::int64_t end;
             std::uint32_t hash;
+            double read_preference;
             std::vector<std::string> grpc;
         };
 
+        struct range {
+            std::int64_t start;
+            std::int64_t end;
+            std::uint32_t member;
+        };
+
         grpcinterface::Mash m_;
         std::vector<struct endpoint> eps_;
+        /* The hash ranges of eps_, sorted by start. */
+        std::vector<struct range> ranges_;
     };
 }
 
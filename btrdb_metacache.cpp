@@ -0,0 +1,137 @@
+#include "btrdb_metacache.h"
+#include "btrdb_util.h"
+
+namespace btrdb {
+    std::shared_ptr<const StreamMetadata> metadata_from_descriptor(const grpcinterface::StreamDescriptor& descriptor) {
+        std::shared_ptr<StreamMetadata> metadata = std::make_shared<StreamMetadata>();
+        metadata->collection = descriptor.collection();
+        for (int i = 0; i != descriptor.tags_size(); i++) {
+            const grpcinterface::KeyValue& kvpair = descriptor.tags(i);
+            metadata->tags[kvpair.key()] = kvpair.value();
+        }
+        for (int i = 0; i != descriptor.annotations_size(); i++) {
+            const grpcinterface::KeyValue& kvpair = descriptor.annotations(i);
+            metadata->annotations[kvpair.key()] = kvpair.value();
+        }
+        metadata->annotation_version = descriptor.annotationversion();
+        return metadata;
+    }
+
+    /* Rough heap footprint of an entry, for the memory bound. */
+    static std::size_t metadata_bytes(const StreamMetadata& metadata) {
+        /* Map nodes and the cache's own bookkeeping cost about this much apiece. */
+        const constexpr std::size_t overhead = 64;
+        std::size_t bytes = sizeof(StreamMetadata) + UUID_NUM_BYTES + 2 * overhead + metadata.collection.size();
+        for (auto& kv : metadata.tags) {
+            bytes += overhead + kv.first.size() + kv.second.size();
+        }
+        for (auto& kv : metadata.annotations) {
+            bytes += overhead + kv.first.size() + kv.second.size();
+        }
+        return bytes;
+    }
+
+    MetadataCache::MetadataCache(std::size_t max_bytes) : max_shard_bytes_(max_bytes / NUM_SHARDS) {
+    }
+
+    MetadataCache::shard& MetadataCache::shardFor(const std::string& key) {
+        /* UUIDs are spread well enough that two bytes of them pick a shard evenly. */
+        std::size_t h = (std::uint8_t) key[0] ^ (std::uint8_t) key[UUID_NUM_BYTES - 1];
+        return this->shards_[h % NUM_SHARDS];
+    }
+
+    std::shared_ptr<const StreamMetadata> MetadataCache::get(const void* uuid) {
+        if (this->max_shard_bytes_ == 0) {
+            return std::shared_ptr<const StreamMetadata>(nullptr);
+        }
+
+        std::string key(reinterpret_cast<const char*>(uuid), UUID_NUM_BYTES);
+        shard& s = this->shardFor(key);
+        std::lock_guard<std::mutex> lock(s.lock);
+        auto it = s.entries.find(key);
+        if (it == s.entries.end()) {
+            s.stats.misses++;
+            return std::shared_ptr<const StreamMetadata>(nullptr);
+        }
+        s.stats.hits++;
+        s.lru.splice(s.lru.begin(), s.lru, it->second.lru);
+        return it->second.metadata;
+    }
+
+    std::shared_ptr<const StreamMetadata> MetadataCache::put(const void* uuid, std::shared_ptr<const StreamMetadata> metadata) {
+        if (this->max_shard_bytes_ == 0 || metadata == nullptr) {
+            return metadata;
+        }
+
+        std::string key(reinterpret_cast<const char*>(uuid), UUID_NUM_BYTES);
+        shard& s = this->shardFor(key);
+        std::lock_guard<std::mutex> lock(s.lock);
+        auto it = s.entries.find(key);
+        if (it != s.entries.end()) {
+            entry& e = it->second;
+            s.lru.splice(s.lru.begin(), s.lru, e.lru);
+            if (e.metadata->annotation_version > metadata->annotation_version) {
+                s.stats.stale++;
+                return e.metadata;
+            }
+            if (e.metadata->annotation_version == metadata->annotation_version) {
+                /* Same version, same contents; hand out the copy that Streams already share. */
+                return e.metadata;
+            }
+            s.bytes -= e.bytes;
+            e.metadata = std::move(metadata);
+            e.bytes = metadata_bytes(*e.metadata);
+            s.bytes += e.bytes;
+            std::shared_ptr<const StreamMetadata> result = e.metadata;
+            this->evict(s);
+            return result;
+        }
+
+        s.lru.push_front(key);
+        entry& e = s.entries[key];
+        e.metadata = std::move(metadata);
+        e.bytes = metadata_bytes(*e.metadata);
+        e.lru = s.lru.begin();
+        s.bytes += e.bytes;
+        std::shared_ptr<const StreamMetadata> result = e.metadata;
+        this->evict(s);
+        return result;
+    }
+
+    void MetadataCache::evict(shard& s) {
+        /* Always keep the entry just used, even if it alone is over the bound. */
+        while (s.bytes > this->max_shard_bytes_ && s.entries.size() > 1) {
+            auto it = s.entries.find(s.lru.back());
+            s.bytes -= it->second.bytes;
+            s.entries.erase(it);
+            s.lru.pop_back();
+            s.stats.evictions++;
+        }
+    }
+
+    void MetadataCache::invalidate(const void* uuid) {
+        std::string key(reinterpret_cast<const char*>(uuid), UUID_NUM_BYTES);
+        shard& s = this->shardFor(key);
+        std::lock_guard<std::mutex> lock(s.lock);
+        auto it = s.entries.find(key);
+        if (it != s.entries.end()) {
+            s.bytes -= it->second.bytes;
+            s.lru.erase(it->second.lru);
+            s.entries.erase(it);
+        }
+    }
+
+    MetadataCacheStats MetadataCache::stats() {
+        MetadataCacheStats total;
+        for (shard& s : this->shards_) {
+            std::lock_guard<std::mutex> lock(s.lock);
+            total.hits += s.stats.hits;
+            total.misses += s.stats.misses;
+            total.evictions += s.stats.evictions;
+            total.stale += s.stats.stale;
+            total.entries += s.entries.size();
+            total.bytes += s.bytes;
+        }
+        return total;
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef BTRDB_METACACHE_H_
+#define BTRDB_METACACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "btrdb.pb.h"
+
+namespace btrdb {
+    /* A stream's descriptor, as of one annotation version. It is never modified once built. */
+    struct StreamMetadata {
+        std::string collection;
+        std::map<std::string, std::string> tags;
+        std::map<std::string, std::string> annotations;
+        std::uint64_t annotation_version;
+    };
+
+    std::shared_ptr<const StreamMetadata> metadata_from_descriptor(const grpcinterface::StreamDescriptor& descriptor);
+
+    struct MetadataCacheStats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t evictions = 0;
+        /* Descriptors that were ignored because the cache already had a newer annotation version. */
+        std::uint64_t stale = 0;
+        std::size_t entries = 0;
+        std::size_t bytes = 0;
+    };
+
+    /*
+     * Stream metadata shared by every Stream of a BTrDB, keyed by UUID.
+     * An entry is only ever replaced by one with an annotation version at
+     * least as new, so a late response cannot undo a newer one. The least
+     * recently used entries are evicted to stay within max_bytes (an
+     * estimate of the memory the entries use; 0 disables the cache).
+     */
+    class MetadataCache {
+    public:
+        explicit MetadataCache(std::size_t max_bytes);
+
+        /* The cached metadata for uuid, or null. */
+        std::shared_ptr<const StreamMetadata> get(const void* uuid);
+        /* Caches metadata unless a newer version is cached, and returns whichever is newest. */
+        std::shared_ptr<const StreamMetadata> put(const void* uuid, std::shared_ptr<const StreamMetadata> metadata);
+        void invalidate(const void* uuid);
+
+        MetadataCacheStats stats();
+
+    private:
+        static const constexpr std::size_t NUM_SHARDS = 16;
+
+        struct entry {
+            std::shared_ptr<const StreamMetadata> metadata;
+            std::size_t bytes;
+            std::list<std::string>::iterator lru;
+        };
+
+        /* Each shard has its own lock and LRU list, so that threads rarely contend. */
+        struct shard {
+            std::mutex lock;
+            std::unordered_map<std::string, entry> entries;
+            /* Most recently used first. */
+            std::list<std::string> lru;
+            std::size_t bytes = 0;
+            MetadataCacheStats stats;
+        };
+
+        shard& shardFor(const std::string& key);
+        void evict(shard& s);
+
+        std::size_t max_shard_bytes_;
+        shard shards_[NUM_SHARDS];
+    };
+}
+
+#endif // BTRDB_METACACHE_H_
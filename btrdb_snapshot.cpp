@@ -0,0 +1,194 @@
+#include "btrdb_snapshot.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+
+/*
+ * The file is a magic string followed by length-prefixed protobuf messages:
+ *
+ *   magic, Mash, number of queries,
+ *   for each query: LookupStreamsParams, number of streams,
+ *                   StreamDescriptor for each stream
+ *
+ * Integers are 32-bit little-endian.
+ */
+static const char SNAPSHOT_MAGIC[8] = { 'B', 'T', 'r', 'D', 'B', 'S', 'N', '1' };
+
+static void write_u32(std::ostream& out, std::uint32_t value) {
+    char bytes[4];
+    for (int i = 0; i != 4; i++) {
+        bytes[i] = (char) ((value >> (8 * i)) & 0xff);
+    }
+    out.write(bytes, sizeof(bytes));
+}
+
+static bool read_u32(std::istream& in, std::uint32_t* value) {
+    unsigned char bytes[4];
+    if (!in.read(reinterpret_cast<char*>(bytes), sizeof(bytes))) {
+        return false;
+    }
+    *value = 0;
+    for (int i = 0; i != 4; i++) {
+        *value |= ((std::uint32_t) bytes[i]) << (8 * i);
+    }
+    return true;
+}
+
+static void write_bytes(std::ostream& out, const std::string& bytes) {
+    write_u32(out, (std::uint32_t) bytes.size());
+    out.write(bytes.data(), bytes.size());
+}
+
+/* The bytes left in a file of the given size, so that lengths read from it can be checked before allocating. */
+static std::uint64_t remaining(std::istream& in, std::streamoff size) {
+    std::streamoff position = in.tellg();
+    return (position < 0 || position > size) ? 0 : (std::uint64_t) (size - position);
+}
+
+static bool read_bytes(std::istream& in, std::streamoff size, std::string* bytes) {
+    std::uint32_t length;
+    if (!read_u32(in, &length) || length > remaining(in, size)) {
+        return false;
+    }
+    bytes->resize(length);
+    return length == 0 || in.read(&(*bytes)[0], length);
+}
+
+namespace btrdb {
+    static bool read_snapshot(std::istream& in, std::streamoff size, Snapshot* snapshot) {
+        char magic[sizeof(SNAPSHOT_MAGIC)];
+        if (!in.read(magic, sizeof(magic)) || !std::equal(magic, &magic[sizeof(magic)], SNAPSHOT_MAGIC)) {
+            return false;
+        }
+
+        std::string bytes;
+        if (!read_bytes(in, size, &bytes) || !snapshot->mash.ParseFromString(bytes)) {
+            return false;
+        }
+
+        std::uint32_t num_queries;
+        if (!read_u32(in, &num_queries)) {
+            return false;
+        }
+        for (std::uint32_t i = 0; i != num_queries; i++) {
+            std::string key;
+            std::uint32_t num_streams;
+            /* Each descriptor takes at least its length, so a count the file cannot hold is corrupt. */
+            if (!read_bytes(in, size, &key) || !read_u32(in, &num_streams) || num_streams > remaining(in, size) / 4) {
+                return false;
+            }
+            std::shared_ptr<std::vector<grpcinterface::StreamDescriptor>> descriptors = std::make_shared<std::vector<grpcinterface::StreamDescriptor>>();
+            descriptors->reserve(num_streams);
+            for (std::uint32_t j = 0; j != num_streams; j++) {
+                descriptors->emplace_back();
+                if (!read_bytes(in, size, &bytes) || !descriptors->back().ParseFromString(bytes)) {
+                    return false;
+                }
+            }
+            snapshot->lookups[key] = std::move(descriptors);
+        }
+
+        return true;
+    }
+
+    bool load_snapshot(const std::string& path, Snapshot* snapshot) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            return false;
+        }
+        std::streamoff size = in.tellg();
+        in.seekg(0);
+
+        /* A snapshot that cannot be loaded only costs a cold start, so nothing in it may throw out of connect. */
+        try {
+            if (read_snapshot(in, size, snapshot)) {
+                return true;
+            }
+        } catch (const std::exception&) {
+        }
+        *snapshot = Snapshot();
+        return false;
+    }
+
+    bool save_snapshot(const std::string& path, const grpcinterface::Mash& mash, const std::map<std::string, LookupResult>& lookups) {
+        std::string tmp_path = path + ".tmp";
+        {
+            std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+            out.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+            write_bytes(out, mash.SerializeAsString());
+            write_u32(out, (std::uint32_t) lookups.size());
+            for (auto it = lookups.begin(); it != lookups.end(); it++) {
+                write_bytes(out, it->first);
+                write_u32(out, (std::uint32_t) it->second->size());
+                for (const grpcinterface::StreamDescriptor& descriptor : *it->second) {
+                    write_bytes(out, descriptor.SerializeAsString());
+                }
+            }
+            out.flush();
+            if (!out) {
+                std::remove(tmp_path.c_str());
+                return false;
+            }
+        }
+        return std::rename(tmp_path.c_str(), path.c_str()) == 0;
+    }
+
+    SnapshotLookups::SnapshotLookups(std::size_t max_bytes) : max_bytes_(max_bytes), bytes_(0) {
+    }
+
+    LookupResult SnapshotLookups::get(const std::string& key) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        auto it = this->entries_.find(key);
+        if (it == this->entries_.end()) {
+            return LookupResult();
+        }
+        this->lru_.splice(this->lru_.begin(), this->lru_, it->second.lru);
+        return it->second.result;
+    }
+
+    void SnapshotLookups::put(const std::string& key, LookupResult result) {
+        std::size_t bytes = key.size();
+        for (const grpcinterface::StreamDescriptor& descriptor : *result) {
+            bytes += descriptor.ByteSizeLong();
+        }
+
+        std::lock_guard<std::mutex> lock(this->lock_);
+        auto it = this->entries_.find(key);
+        if (it != this->entries_.end()) {
+            this->bytes_ -= it->second.bytes;
+            this->lru_.erase(it->second.lru);
+            this->entries_.erase(it);
+        }
+        if (bytes > this->max_bytes_) {
+            return;
+        }
+        this->lru_.push_front(key);
+        entry& e = this->entries_[key];
+        e.result = std::move(result);
+        e.bytes = bytes;
+        e.lru = this->lru_.begin();
+        this->bytes_ += bytes;
+        this->evict();
+    }
+
+    std::map<std::string, LookupResult> SnapshotLookups::entries() {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        std::map<std::string, LookupResult> entries;
+        for (auto& it : this->entries_) {
+            entries[it.first] = it.second.result;
+        }
+        return entries;
+    }
+
+    void SnapshotLookups::evict() {
+        while (this->bytes_ > this->max_bytes_) {
+            auto it = this->entries_.find(this->lru_.back());
+            this->bytes_ -= it->second.bytes;
+            this->entries_.erase(it);
+            this->lru_.pop_back();
+        }
+    }
+}
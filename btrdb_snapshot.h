@@ -0,0 +1,68 @@
+#ifndef BTRDB_SNAPSHOT_H_
+#define BTRDB_SNAPSHOT_H_
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "btrdb.pb.h"
+
+namespace btrdb {
+    /* The descriptors that one lookupStreams query returned; never modified once recorded. */
+    typedef std::shared_ptr<const std::vector<grpcinterface::StreamDescriptor>> LookupResult;
+
+    /*
+     * A local snapshot of the cluster state: the last MASH we saw and the
+     * results of lookupStreams queries, keyed by the serialized
+     * LookupStreamsParams of the query. It lets a restarted process route
+     * requests and list streams before it has heard from the cluster.
+     */
+    struct Snapshot {
+        grpcinterface::Mash mash;
+        std::map<std::string, LookupResult> lookups;
+    };
+
+    bool load_snapshot(const std::string& path, Snapshot* snapshot);
+
+    /* Writes to a temporary file and renames it, so readers never see a partial snapshot. */
+    bool save_snapshot(const std::string& path, const grpcinterface::Mash& mash, const std::map<std::string, LookupResult>& lookups);
+
+    /*
+     * The lookupStreams results to put in the snapshot. The least recently
+     * used are dropped to keep the serialized descriptors within
+     * max_bytes; a single result larger than that is not kept at all.
+     */
+    class SnapshotLookups {
+    public:
+        explicit SnapshotLookups(std::size_t max_bytes);
+
+        /* The result recorded for key, or null. */
+        LookupResult get(const std::string& key);
+        void put(const std::string& key, LookupResult result);
+        /* Every result, for writing out; the results themselves are shared, not copied. */
+        std::map<std::string, LookupResult> entries();
+
+    private:
+        struct entry {
+            LookupResult result;
+            std::size_t bytes;
+            std::list<std::string>::iterator lru;
+        };
+
+        void evict();
+
+        std::size_t max_bytes_;
+        std::mutex lock_;
+        std::unordered_map<std::string, entry> entries_;
+        /* Most recently used first. */
+        std::list<std::string> lru_;
+        std::size_t bytes_;
+    };
+}
+
+#endif // BTRDB_SNAPSHOT_H_
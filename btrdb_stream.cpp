@@ -1,5 +1,6 @@
 #include "btrdb_stream.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <condition_variable>
@@ -8,25 +9,26 @@
 
 namespace btrdb {
     Stream::Stream(const std::shared_ptr<BTrDB>& b, const void* uuid)
-        : b_(b), known_to_exist_(false), has_tags_(false),
-          has_annotations_(false), has_collection_(false) {
+        : b_(b), has_version_(false) {
         std::memcpy(uuid_, uuid, 16);
     }
 
     Stream::Stream(const std::shared_ptr<BTrDB>& b, const grpcinterface::StreamDescriptor& descriptor)
-        : b_(b) {
+        : b_(b), has_version_(false) {
         const std::string& uuid_string = descriptor.uuid();
         std::memcpy(uuid_, uuid_string.data(), 16);
         this->updateFromDescriptor(descriptor);
     }
 
-    Status Stream::exists(std::function<void(grpc::ClientContext*)> ctx, bool* exists) {
-        if (this->known_to_exist_) {
-            *exists = true;
-            return Status();
-        }
+    Stream::Stream(const std::shared_ptr<BTrDB>& b, const void* uuid, std::shared_ptr<const StreamMetadata> metadata)
+        : b_(b), has_version_(false) {
+        std::memcpy(uuid_, uuid, 16);
+        this->setMetadata(std::move(metadata));
+    }
 
-        Status status = this->refreshMetadata(ctx);
+    Status Stream::exists(std::function<void(grpc::ClientContext*)> ctx, bool* exists) {
+        std::shared_ptr<const StreamMetadata> metadata;
+        Status status = this->metadata(ctx, &metadata);
         if (status.isError()) {
             if (status.code() == 404) {
                 *exists = false;
@@ -41,32 +43,24 @@ namespace btrdb {
     }
 
     Status Stream::collection(std::function<void(grpc::ClientContext*)> ctx, const std::string** collection_ptr) {
-        if (this->has_collection_) {
-            *collection_ptr = &this->collection_;
-            return Status();
-        }
-
-        Status status = this->refreshMetadata(ctx);
+        std::shared_ptr<const StreamMetadata> metadata;
+        Status status = this->metadata(ctx, &metadata);
         if (status.isError()) {
             return status;
         }
 
-        *collection_ptr = &this->collection_;
+        *collection_ptr = &this->pin(std::move(metadata))->collection;
         return status;
     }
 
     Status Stream::tags(std::function<void(grpc::ClientContext*)> ctx, const std::map<std::string, std::string>** tags_ptr) {
-        if (this->has_tags_) {
-            *tags_ptr = &this->tags_;
-            return Status();
-        }
-
-        Status status = this->refreshMetadata(ctx);
+        std::shared_ptr<const StreamMetadata> metadata;
+        Status status = this->metadata(ctx, &metadata);
         if (status.isError()) {
             return status;
         }
 
-        *tags_ptr = &this->tags_;
+        *tags_ptr = &this->pin(std::move(metadata))->tags;
         return status;
     }
 
@@ -76,24 +70,66 @@ namespace btrdb {
             return status;
         }
 
-        *annotations_ptr = &this->annotations_;
-        *annotations_ver = this->annotations_version_;
+        std::shared_ptr<const StreamMetadata> metadata = std::atomic_load(&this->metadata_);
+        const StreamMetadata* pinned = this->pin(std::move(metadata));
+        *annotations_ptr = &pinned->annotations;
+        *annotations_ver = pinned->annotation_version;
         return status;
     }
 
     Status Stream::cachedAnnotations(std::function<void(grpc::ClientContext*)> ctx, const std::map<std::string, std::string>** annotations_ptr, std::uint64_t* annotations_ver) {
-        if (!this->has_annotations_) {
+        std::shared_ptr<const StreamMetadata> metadata;
+        Status status = this->metadata(ctx, &metadata);
+        if (status.isError()) {
+            return status;
+        }
+
+        const StreamMetadata* pinned = this->pin(std::move(metadata));
+        *annotations_ptr = &pinned->annotations;
+        *annotations_ver = pinned->annotation_version;
+        return Status();
+    }
+
+    Status Stream::metadata(std::function<void(grpc::ClientContext*)> ctx, std::shared_ptr<const StreamMetadata>* metadata_ptr) {
+        std::shared_ptr<const StreamMetadata> metadata = std::atomic_load(&this->metadata_);
+        if (metadata == nullptr && this->b_ != nullptr) {
+            /* Another Stream for this UUID may have fetched it already. */
+            metadata = this->b_->metadata_cache_.get(this->uuid_);
+            if (metadata != nullptr) {
+                std::atomic_store(&this->metadata_, metadata);
+            }
+        }
+        if (metadata == nullptr) {
             Status status = this->refreshMetadata(ctx);
             if (status.isError()) {
                 return status;
             }
+            metadata = std::atomic_load(&this->metadata_);
         }
 
-        *annotations_ptr = &this->annotations_;
-        *annotations_ver = this->annotations_version_;
+        *metadata_ptr = std::move(metadata);
         return Status();
     }
 
+    Status Stream::setAnnotations(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t expected_version, const std::map<std::string, std::pair<std::string, bool>>& changes) {
+        Status status;
+        std::int64_t revision;
+        do {
+            revision = this->b_->mashRevision();
+            std::shared_ptr<Endpoint> ep;
+            status = this->b_->endpointFor(ctx, this->uuid_, &ep);
+            if (status.isError()) {
+                continue;
+            }
+            status = ep->setStreamAnnotations(ctx, this->uuid_, expected_version, changes);
+        } while (this->b_->handleEndpointStatus(status, revision));
+
+        if (!status.isError()) {
+            this->annotationsSet(expected_version, changes);
+        }
+        return status;
+    }
+
     const void* Stream::UUID() {
         return this->uuid_;
     }
@@ -101,51 +137,99 @@ namespace btrdb {
     Status Stream::version(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr) {
         Status status;
         grpcinterface::StreamInfoResponse streamInfo;
+        std::int64_t revision;
         do {
+            revision = this->b_->mashRevision();
             std::shared_ptr<Endpoint> ep;
             status = this->b_->endpointFor(ctx, this->uuid_, &ep);
             if (status.isError()) {
                 continue;
             }
             status = ep->streamInfo(ctx, this->uuid_, &streamInfo, false, true);
-        } while (this->b_->handleEndpointStatus(status));
+        } while (this->b_->handleEndpointStatus(status, revision));
 
         if (status.isError()) {
             return status;
         }
 
-        *version_ptr = streamInfo.versionmajor();
+        this->has_version_ = true;
+        this->version_ = streamInfo.versionmajor();
+        *version_ptr = this->version_;
         return status;
     }
 
+    Status Stream::cachedVersion(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr) {
+        if (this->has_version_) {
+            *version_ptr = this->version_;
+            return Status();
+        }
+        return this->version(ctx, version_ptr);
+    }
+
     Status Stream::rawValuesAsync(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct RawPoint>&, std::uint64_t)> on_data, std::int64_t start, std::int64_t end, std::uint64_t version) {
+        std::int64_t revision = this->b_->mashRevision();
         this->b_->asyncEndpointFor(ctx, this->uuid_, [=](Status status, std::shared_ptr<Endpoint> ep) {
             if (status.isError()) {
+                if (status.code() == Status::Unhealthy.code()) {
+                    /* Fail fast rather than retrying against a broken member. */
+                    std::vector<struct RawPoint> dummy;
+                    on_data(true, status, dummy, 0);
+                    return;
+                }
                 this->rawValuesAsync(ctx, std::move(on_data), start, end, version);
                 return;
             }
 
-            ep->rawValuesAsync(ctx, this->b_->completion_queue, [=](bool finished, Status status, std::vector<struct RawPoint>& data, std::uint64_t version) {
-                if (this->b_->handleEndpointStatus(status)) {
-                    this->rawValuesAsync(ctx, std::move(on_data), start, end, version);
-                    return;
-                }
-                on_data(finished, status, data, version);
-            }, this->uuid_, start, end, version);
+            std::shared_ptr<HedgedCall> call;
+            if (end - start <= this->b_->options_.hedge.max_raw_values_span) {
+                call = this->b_->hedgedCall();
+            }
+            auto attempt = [=](std::shared_ptr<Endpoint> ep, int index) {
+                ep->rawValuesAsync(call ? call->attempt(ctx, index) : ctx, this->b_->completion_queue, [=](bool finished, Status status, std::vector<struct RawPoint>& data, std::uint64_t version) {
+                    if (call != nullptr) {
+                        if (finished) {
+                            call->release(index);
+                        }
+                        if (!call->claim(index)) {
+                            return;
+                        }
+                    }
+                    if (this->b_->handleEndpointStatusAsync(status, revision, [=]() { this->rawValuesAsync(ctx, on_data, start, end, version); })) {
+                        return;
+                    }
+                    on_data(finished, status, data, version);
+                }, this->uuid_, start, end, version);
+            };
+
+            attempt(ep, 0);
+            this->hedge(call, attempt);
         });
         return Status();
     }
 
     Status Stream::alignedWindowsAsync(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, std::int64_t start, std::int64_t end, std::uint8_t pointwidth, std::uint64_t version) {
+        std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> lead = on_data;
+        if (this->b_->options_.coalesce_queries && this->b_->aligned_windows_coalescer_.join(this->alignedWindowsKey(start, end, pointwidth, version), on_data, &lead)) {
+            return Status();
+        }
+        return this->alignedWindowsAsyncHelper(ctx, std::move(lead), start, end, pointwidth, version);
+    }
+
+    Status Stream::alignedWindowsAsyncHelper(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, std::int64_t start, std::int64_t end, std::uint8_t pointwidth, std::uint64_t version) {
+        std::int64_t revision = this->b_->mashRevision();
         this->b_->asyncEndpointFor(ctx, this->uuid_, [=](Status status, std::shared_ptr<Endpoint> ep) {
             if (status.isError()) {
-                this->alignedWindowsAsync(ctx, std::move(on_data), start, end, pointwidth, version);
+                if (status.code() == Status::Unhealthy.code()) {
+                    std::vector<struct StatisticalPoint> dummy;
+                    on_data(true, status, dummy, 0);
+                    return;
+                }
+                this->alignedWindowsAsyncHelper(ctx, std::move(on_data), start, end, pointwidth, version);
                 return;
             }
 
             ep->alignedWindowsAsync(ctx, this->b_->completion_queue, [=](bool finished, Status status, std::vector<struct StatisticalPoint>& data, std::uint64_t version) {
-                if (this->b_->handleEndpointStatus(status)) {
-                    this->alignedWindowsAsync(ctx, std::move(on_data), start, end, pointwidth, version);
+                if (this->b_->handleEndpointStatusAsync(status, revision, [=]() { this->alignedWindowsAsyncHelper(ctx, on_data, start, end, pointwidth, version); })) {
                     return;
                 }
                 on_data(finished, status, data, version);
@@ -155,15 +239,20 @@ namespace btrdb {
     }
 
     Status Stream::windowsAsync(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, std::int64_t start, std::int64_t end, std::uint64_t width, std::uint8_t depth, std::uint64_t version) {
+        std::int64_t revision = this->b_->mashRevision();
         this->b_->asyncEndpointFor(ctx, this->uuid_, [=](Status status, std::shared_ptr<Endpoint> ep) {
             if (status.isError()) {
+                if (status.code() == Status::Unhealthy.code()) {
+                    std::vector<struct StatisticalPoint> dummy;
+                    on_data(true, status, dummy, 0);
+                    return;
+                }
                 this->windowsAsync(ctx, std::move(on_data), start, end, width, depth, version);
                 return;
             }
 
             ep->windowsAsync(ctx, this->b_->completion_queue, [=](bool finished, Status status, std::vector<struct StatisticalPoint>& data, std::uint64_t version) {
-                if (this->b_->handleEndpointStatus(status)) {
-                    this->windowsAsync(ctx, std::move(on_data), start, end, width, depth, version);
+                if (this->b_->handleEndpointStatusAsync(status, revision, [=]() { this->windowsAsync(ctx, on_data, start, end, width, depth, version); })) {
                     return;
                 }
                 on_data(finished, status, data, version);
@@ -173,14 +262,19 @@ namespace btrdb {
     }
 
     Status Stream::changesAsync(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct ChangedRange>&, std::uint64_t)> on_data, std::uint64_t from_version, std::uint64_t to_version, std::uint8_t resolution) {
+        std::int64_t revision = this->b_->mashRevision();
         this->b_->asyncEndpointFor(ctx, this->uuid_, [=](Status status, std::shared_ptr<Endpoint> ep) {
             if (status.isError()) {
+                if (status.code() == Status::Unhealthy.code()) {
+                    std::vector<struct ChangedRange> dummy;
+                    on_data(true, status, dummy, 0);
+                    return;
+                }
                 this->changesAsync(ctx, std::move(on_data), from_version, to_version, resolution);
                 return;
             }
             ep->changesAsync(ctx, this->b_->completion_queue, [=](bool finished, Status status, std::vector<struct ChangedRange>& data, std::uint64_t version) {
-                if (this->b_->handleEndpointStatus(status)) {
-                    this->changesAsync(ctx, std::move(on_data), from_version, to_version, resolution);
+                if (this->b_->handleEndpointStatusAsync(status, revision, [=]() { this->changesAsync(ctx, on_data, from_version, to_version, resolution); })) {
                     return;
                 }
                 on_data(finished, status, data, version);
@@ -190,66 +284,197 @@ namespace btrdb {
     }
 
     Status Stream::nearestAsync(std::function<void(grpc::ClientContext*)> ctx, std::function<void(Status, const RawPoint&, std::uint64_t)> on_data, std::int64_t timestamp, bool backward, std::uint64_t version) {
+        std::int64_t revision = this->b_->mashRevision();
         this->b_->asyncEndpointFor(ctx, this->uuid_, [=](Status status, std::shared_ptr<Endpoint> ep) {
             if (status.isError()) {
+                if (status.code() == Status::Unhealthy.code()) {
+                    struct RawPoint dummy;
+                    on_data(status, dummy, 0);
+                    return;
+                }
                 this->nearestAsync(ctx, std::move(on_data), timestamp, backward, version);
                 return;
             }
-            ep->nearestAsync(ctx, this->b_->completion_queue, [=](Status status, const RawPoint& data, std::uint64_t version) {
-                if (this->b_->handleEndpointStatus(status)) {
-                    this->nearestAsync(ctx, std::move(on_data), timestamp, backward, version);
-                    return;
-                }
-                on_data(status, data, version);
-            }, this->uuid_, timestamp, backward, version);
+
+            std::shared_ptr<HedgedCall> call = this->b_->hedgedCall();
+            auto attempt = [=](std::shared_ptr<Endpoint> ep, int index) {
+                ep->nearestAsync(call ? call->attempt(ctx, index) : ctx, this->b_->completion_queue, [=](Status status, const RawPoint& data, std::uint64_t version) {
+                    if (call != nullptr) {
+                        call->release(index);
+                        if (!call->claim(index)) {
+                            return;
+                        }
+                    }
+                    if (this->b_->handleEndpointStatusAsync(status, revision, [=]() { this->nearestAsync(ctx, on_data, timestamp, backward, version); })) {
+                        return;
+                    }
+                    on_data(status, data, version);
+                }, this->uuid_, timestamp, backward, version);
+            };
+
+            attempt(ep, 0);
+            this->hedge(call, attempt);
         });
         return Status();
     }
 
+    std::string Stream::alignedWindowsKey(std::int64_t start, std::int64_t end, std::uint8_t pointwidth, std::uint64_t version) const {
+        std::string key(this->uuid_, sizeof(this->uuid_));
+        key.append(reinterpret_cast<const char*>(&start), sizeof(start));
+        key.append(reinterpret_cast<const char*>(&end), sizeof(end));
+        key.append(reinterpret_cast<const char*>(&pointwidth), sizeof(pointwidth));
+        key.append(reinterpret_cast<const char*>(&version), sizeof(version));
+        return key;
+    }
+
+    void Stream::hedge(const std::shared_ptr<HedgedCall>& call, std::function<void(std::shared_ptr<Endpoint>, int)> attempt) {
+        if (call == nullptr) {
+            return;
+        }
+        std::shared_ptr<Endpoint> alternate = this->b_->alternateEndpointFor(this->uuid_);
+        if (alternate != nullptr) {
+            call->hedgeAfter(this->b_->completion_queue, [=]() {
+                attempt(alternate, 1);
+            });
+        }
+    }
+
     // TODO: chunk this up into 5000 point batches
     Status Stream::insert(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, std::vector<struct RawPoint>::const_iterator data_start, std::vector<struct RawPoint>::const_iterator data_end, bool sync) {
+        if ((std::size_t) (data_end - data_start) > MAX_INSERT_POINTS) {
+            return Status::WrongArgs;
+        }
+        grpcinterface::InsertParams params;
+        insert_params(&params, this->uuid_, data_start, data_end, sync);
+        return this->insert(ctx, version_ptr, params);
+    }
+
+    Status Stream::insert(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, const struct RawPoint* data, std::size_t count, bool sync) {
+        if (count > MAX_INSERT_POINTS) {
+            return Status::WrongArgs;
+        }
+        grpcinterface::InsertParams params;
+        insert_params(&params, this->uuid_, data, data + count, sync);
+        return this->insert(ctx, version_ptr, params);
+    }
+
+    Status Stream::insert(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, const std::int64_t* times, const double* values, std::size_t count, bool sync) {
+        if (count > MAX_INSERT_POINTS) {
+            return Status::WrongArgs;
+        }
+        grpcinterface::InsertParams params;
+        insert_params(&params, this->uuid_, times, values, count, sync);
+        return this->insert(ctx, version_ptr, params);
+    }
+
+    Status Stream::insert(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, const grpcinterface::InsertParams& params) {
         Status status;
+        std::int64_t revision;
         do {
+            revision = this->b_->mashRevision();
             std::shared_ptr<Endpoint> ep;
             status = this->b_->endpointFor(ctx, this->uuid_, &ep);
             if (status.isError()) {
                 continue;
             }
-            status = ep->insert(ctx, this->uuid_, data_start, data_end, sync, version_ptr);
-        } while (this->b_->handleEndpointStatus(status));
+            status = ep->insert(ctx, params, version_ptr);
+        } while (this->b_->handleEndpointStatus(status, revision));
 
+        this->b_->forgetLatestValue(this->uuid_);
         return status;
     }
 
     Status Stream::deleteRange(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, std::int64_t start, std::int64_t end) {
         Status status;
+        std::int64_t revision;
         do {
+            revision = this->b_->mashRevision();
             std::shared_ptr<Endpoint> ep;
             status = this->b_->endpointFor(ctx, this->uuid_, &ep);
             if (status.isError()) {
                 continue;
             }
             status = ep->deleteRange(ctx, this->uuid_, start, end, version_ptr);
-        } while (this->b_->handleEndpointStatus(status));
+        } while (this->b_->handleEndpointStatus(status, revision));
+
+        this->b_->forgetLatestValue(this->uuid_);
+        return status;
+    }
+
+    Status Stream::flush(std::function<void(grpc::ClientContext*)> ctx) {
+        Status status;
+        std::int64_t revision;
+        do {
+            revision = this->b_->mashRevision();
+            std::shared_ptr<Endpoint> ep;
+            status = this->b_->endpointFor(ctx, this->uuid_, &ep);
+            if (status.isError()) {
+                continue;
+            }
+            status = ep->flush(ctx, this->uuid_);
+        } while (this->b_->handleEndpointStatus(status, revision));
 
         return status;
     }
 
     Status Stream::obliterate(std::function<void(grpc::ClientContext*)> ctx) {
         Status status;
+        std::int64_t revision;
         do {
+            revision = this->b_->mashRevision();
             std::shared_ptr<Endpoint> ep;
             status = this->b_->endpointFor(ctx, this->uuid_, &ep);
             if (status.isError()) {
                 continue;
             }
             status = ep->obliterate(ctx, this->uuid_);
-        } while (this->b_->handleEndpointStatus(status));
+        } while (this->b_->handleEndpointStatus(status, revision));
+
+        if (!status.isError()) {
+            this->b_->metadata_cache_.invalidate(this->uuid_);
+        }
+        this->b_->forgetLatestValue(this->uuid_);
+        return status;
+    }
+
+    template <typename V>
+    Status Stream::directQuery(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<V>&, std::uint64_t)> on_data, std::function<Status(Endpoint*, std::function<void(bool, Status, std::vector<V>&, std::uint64_t)>)> query) {
+        bool delivered = false;
+        std::function<void(bool, Status, std::vector<V>&, std::uint64_t)> deliver = [&](bool finished, Status status, std::vector<V>& data, std::uint64_t version) {
+            if (BTrDB::isStaleMash(status)) {
+                // We will retry, so don't report this to the caller
+                return;
+            }
+            delivered = finished;
+            on_data(finished, status, data, version);
+        };
+
+        Status status;
+        std::int64_t revision;
+        do {
+            revision = this->b_->mashRevision();
+            std::shared_ptr<Endpoint> ep;
+            status = this->b_->endpointFor(ctx, this->uuid_, &ep);
+            if (status.isError()) {
+                continue;
+            }
+            status = query(ep.get(), deliver);
+        } while (this->b_->handleEndpointStatus(status, revision));
 
+        if (!delivered) {
+            std::vector<V> dummy;
+            on_data(true, status, dummy, 0);
+        }
         return status;
     }
 
     Status Stream::rawValues(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct RawPoint>&, std::uint64_t)> on_data, std::int64_t start, std::int64_t end, std::uint64_t version) {
+        if (this->b_->options_.sync_mode == SyncMode::Direct) {
+            return this->directQuery<struct RawPoint>(ctx, std::move(on_data), [=](Endpoint* ep, std::function<void(bool, Status, std::vector<struct RawPoint>&, std::uint64_t)> deliver) {
+                return ep->rawValues(ctx, std::move(deliver), this->uuid_, start, end, version);
+            });
+        }
+
         std::function<Status(std::function<void(bool, Status, std::vector<struct RawPoint>&, std::uint64_t)>)> callback = [=](std::function<void(bool, Status, std::vector<struct RawPoint>&, std::uint64_t)> callback) {
             return this->rawValuesAsync(ctx, callback, start, end, version);
         };
@@ -257,6 +482,20 @@ namespace btrdb {
     }
 
     Status Stream::alignedWindows(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, std::int64_t start, std::int64_t end, std::uint8_t pointwidth, std::uint64_t version) {
+        if (this->b_->options_.sync_mode == SyncMode::Direct) {
+            std::function<Status(std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)>)> query = [=](std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> callback) {
+                std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> lead = callback;
+                if (this->b_->options_.coalesce_queries && this->b_->aligned_windows_coalescer_.join(this->alignedWindowsKey(start, end, pointwidth, version), callback, &lead)) {
+                    /* async_to_sync waits for the query we joined to finish. */
+                    return Status();
+                }
+                return this->directQuery<struct StatisticalPoint>(ctx, std::move(lead), [=](Endpoint* ep, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> deliver) {
+                    return ep->alignedWindows(ctx, std::move(deliver), this->uuid_, start, end, pointwidth, version);
+                });
+            };
+            return async_to_sync(std::move(query), on_data);
+        }
+
         std::function<Status(std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)>)> callback = [=](std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> callback) {
             return this->alignedWindowsAsync(ctx, callback, start, end, pointwidth, version);
         };
@@ -264,6 +503,12 @@ namespace btrdb {
     }
 
     Status Stream::windows(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, std::int64_t start, std::int64_t end, std::uint64_t width, std::uint8_t depth, std::uint64_t version) {
+        if (this->b_->options_.sync_mode == SyncMode::Direct) {
+            return this->directQuery<struct StatisticalPoint>(ctx, std::move(on_data), [=](Endpoint* ep, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> deliver) {
+                return ep->windows(ctx, std::move(deliver), this->uuid_, start, end, width, depth, version);
+            });
+        }
+
         std::function<Status(std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)>)> callback = [=](std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> callback) {
             return this->windowsAsync(ctx, callback, start, end, width, depth, version);
         };
@@ -271,13 +516,26 @@ namespace btrdb {
     }
 
     Status Stream::changes(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct ChangedRange>&, std::uint64_t)> on_data, std::uint64_t from_version, std::uint64_t to_version, std::uint8_t resolution) {
+        if (this->b_->options_.sync_mode == SyncMode::Direct) {
+            return this->directQuery<struct ChangedRange>(ctx, std::move(on_data), [=](Endpoint* ep, std::function<void(bool, Status, std::vector<struct ChangedRange>&, std::uint64_t)> deliver) {
+                return ep->changes(ctx, std::move(deliver), this->uuid_, from_version, to_version, resolution);
+            });
+        }
+
         std::function<Status(std::function<void(bool, Status, std::vector<struct ChangedRange>&, std::uint64_t)>)> callback = [=](std::function<void(bool, Status, std::vector<struct ChangedRange>&, std::uint64_t)> callback) {
             return this->changesAsync(ctx, callback, from_version, to_version, resolution);
         };
         return async_to_sync(std::move(callback), on_data);
     }
 
-    Status Stream::rawValues(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct RawPoint>* result, std::uint64_t* version_ptr, std::int64_t start, std::int64_t end, std::uint64_t version) {
+    Status Stream::rawValues(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct RawPoint>* result, std::uint64_t* version_ptr, std::int64_t start, std::int64_t end, std::uint64_t version, bool presize) {
+        if (presize) {
+            /* Only a hint: if the estimate fails, the result just grows as it arrives. */
+            std::uint64_t count;
+            if (!this->countPoints(ctx, &count, start, end, version).isError()) {
+                result->reserve(result->size() + count);
+            }
+        }
         return this->rawValues(ctx, collect_vernum_worker(result, version_ptr), start, end, version);
     }
 
@@ -293,7 +551,55 @@ namespace btrdb {
         return this->changes(ctx, collect_vernum_worker(result, version_ptr), from_version, to_version, resolution);
     }
 
+    Status Stream::countPoints(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* count, std::int64_t start, std::int64_t end, std::uint64_t version) {
+        *count = 0;
+        if (end <= start) {
+            return Status();
+        }
+
+        /* The smallest pointwidth that splits the range into at most this many windows. */
+        const constexpr std::uint64_t max_windows = 64;
+        std::uint64_t span = (std::uint64_t) end - (std::uint64_t) start;
+        std::uint8_t pointwidth = 0;
+        while ((span >> pointwidth) >= max_windows && pointwidth < BTrDB::MAX_PWE) {
+            pointwidth++;
+        }
+
+        /* Widen the range to whole windows, so that no window that holds points in it is left out. */
+        std::int64_t mask = (INT64_C(1) << pointwidth) - 1;
+        std::int64_t aligned_start = std::max(start & ~mask, BTrDB::MIN_TIME);
+        std::int64_t aligned_end = (end - 1) | mask;
+        aligned_end = (aligned_end >= BTrDB::MAX_TIME) ? BTrDB::MAX_TIME : aligned_end + 1;
+
+        std::vector<struct StatisticalPoint> windows;
+        std::uint64_t window_version;
+        Status status = this->alignedWindows(ctx, &windows, &window_version, aligned_start, aligned_end, pointwidth, version);
+        if (status.isError()) {
+            return status;
+        }
+        for (const struct StatisticalPoint& window : windows) {
+            *count += window.count;
+        }
+        return Status();
+    }
+
     Status Stream::nearest(std::function<void(grpc::ClientContext*)> ctx, RawPoint* result, std::uint64_t* version_ptr, std::int64_t timestamp, bool backward, std::uint64_t version) {
+        if (this->b_->options_.sync_mode == SyncMode::Direct) {
+            Status status;
+            std::int64_t revision;
+            do {
+                revision = this->b_->mashRevision();
+                std::shared_ptr<Endpoint> ep;
+                status = this->b_->endpointFor(ctx, this->uuid_, &ep);
+                if (status.isError()) {
+                    continue;
+                }
+                status = ep->nearest(ctx, this->uuid_, timestamp, backward, version, result, version_ptr);
+            } while (this->b_->handleEndpointStatus(status, revision));
+
+            return status;
+        }
+
         std::function<Status(std::function<void(bool, Status, const RawPoint&, std::uint64_t)>)> callback = [=](std::function<void(bool, Status, const RawPoint&, std::uint64_t)> callback) {
             return this->nearestAsync(ctx, [=](Status stat, const RawPoint& rawpoint, std::uint64_t version) {
                 callback(true, stat, rawpoint, version);
@@ -306,17 +612,193 @@ namespace btrdb {
         return async_to_sync(std::move(callback), std::move(worker));
     }
 
+    /* Fewer timestamps than this are always looked up with nearest; estimating the points would cost as much. */
+    static const constexpr std::size_t VALUES_AT_MIN_RANGE = 8;
+    /* Points per timestamp up to which reading the whole span is cheaper than a nearest query each. */
+    static const constexpr std::uint64_t VALUES_AT_RANGE_POINTS = 32;
+    /* nearest queries that valuesAt keeps in flight. */
+    static const constexpr std::size_t VALUES_AT_IN_FLIGHT = 64;
+
+    /* The first index at or after from whose point is at or after t: skips ahead exponentially, then bisects. */
+    static std::size_t seek(const std::vector<struct RawPoint>& points, std::size_t from, std::int64_t t) {
+        if (from == points.size() || points[from].time >= t) {
+            return from;
+        }
+        std::size_t below = from;
+        std::size_t step = 1;
+        while (below + step < points.size() && points[below + step].time < t) {
+            below += step;
+            step *= 2;
+        }
+        std::size_t limit = std::min(below + step, points.size());
+        return std::lower_bound(points.begin() + below + 1, points.begin() + limit, t, [](const struct RawPoint& point, std::int64_t time) {
+            return point.time < time;
+        }) - points.begin();
+    }
+
+    Status Stream::valuesAt(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct RawPoint>* result, std::uint64_t* version_ptr, const std::vector<std::int64_t>& times, bool backward, std::uint64_t version, std::vector<Status>* statuses) {
+        if (!std::is_sorted(times.begin(), times.end())) {
+            return Status::WrongArgs;
+        }
+        result->assign(times.size(), RawPoint());
+        std::vector<Status> results(times.size());
+        *version_ptr = version;
+
+        Status status;
+        bool from_range = false;
+        if (times.size() >= VALUES_AT_MIN_RANGE) {
+            /* countPoints may overcount by up to a window at either end, which only favours nearest. */
+            std::uint64_t estimate;
+            std::int64_t end = (times.back() < BTrDB::MAX_TIME) ? times.back() + 1 : BTrDB::MAX_TIME;
+            from_range = !this->countPoints(ctx, &estimate, times.front(), end, version).isError() && estimate <= VALUES_AT_RANGE_POINTS * times.size();
+        }
+        if (from_range) {
+            status = this->valuesAtFromRange(ctx, result, version_ptr, times, backward, version, &results);
+        } else {
+            this->valuesAtFromNearest(ctx, result, version_ptr, times, backward, version, &results);
+        }
+
+        if (!status.isError()) {
+            for (const Status& r : results) {
+                if (r.isError()) {
+                    status = r;
+                    break;
+                }
+            }
+        }
+        if (statuses != nullptr) {
+            *statuses = std::move(results);
+        }
+        return status;
+    }
+
+    Status Stream::valuesAtFromRange(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct RawPoint>* result, std::uint64_t* version_ptr, const std::vector<std::int64_t>& times, bool backward, std::uint64_t version, std::vector<Status>* statuses) {
+        std::int64_t start = times.front();
+        std::int64_t end = (times.back() < BTrDB::MAX_TIME) ? times.back() + 1 : BTrDB::MAX_TIME;
+        std::vector<struct RawPoint> points;
+        Status status = this->rawValues(ctx, &points, version_ptr, start, end, version);
+        if (status.isError()) {
+            statuses->assign(times.size(), status);
+            return status;
+        }
+
+        /*
+         * Merge the timestamps into the points. Backward, times[i] gets the
+         * last point before it; forward, the first at or after it. Those
+         * whose point lies outside [start, end) are a prefix (backward) or
+         * a suffix (forward) that all share one point, found with nearest.
+         */
+        std::size_t next = 0;
+        std::size_t outside_begin = times.size();
+        std::size_t outside_end = times.size();
+        for (std::size_t i = 0; i != times.size(); i++) {
+            next = seek(points, next, times[i]);
+            if (backward) {
+                if (next == 0) {
+                    outside_begin = 0;
+                    outside_end = i + 1;
+                } else {
+                    (*result)[i] = points[next - 1];
+                }
+            } else if (next == points.size()) {
+                outside_begin = std::min(outside_begin, i);
+            } else {
+                (*result)[i] = points[next];
+            }
+        }
+
+        if (outside_begin != outside_end) {
+            struct RawPoint point = RawPoint();
+            std::uint64_t point_version;
+            Status outside = this->nearest(ctx, &point, &point_version, backward ? start : end, backward, *version_ptr);
+            for (std::size_t i = outside_begin; i != outside_end; i++) {
+                if (!outside.isError()) {
+                    (*result)[i] = point;
+                }
+                (*statuses)[i] = outside;
+            }
+        }
+        return Status();
+    }
+
+    /* Shared by the callbacks of one valuesAtFromNearest. */
+    struct values_at_nearest {
+        std::mutex lock;
+        std::condition_variable done;
+        std::size_t next;
+        std::size_t outstanding;
+    };
+
+    void Stream::valuesAtFromNearest(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct RawPoint>* result, std::uint64_t* version_ptr, const std::vector<std::int64_t>& times, bool backward, std::uint64_t version, std::vector<Status>* statuses) {
+        if (times.empty()) {
+            return;
+        }
+
+        /* The first query, on its own, fixes the version that the rest are read at. */
+        std::uint64_t first_version = version;
+        (*statuses)[0] = this->nearest(ctx, &(*result)[0], &first_version, times[0], backward, version);
+        if (!(*statuses)[0].isError()) {
+            version = first_version;
+        } else if (version == 0) {
+            /* Often just no point before times[0]; the rest must still agree on a version. */
+            Status status = this->version(ctx, &version);
+            if (status.isError()) {
+                std::fill(statuses->begin() + 1, statuses->end(), status);
+                *version_ptr = 0;
+                return;
+            }
+        }
+        *version_ptr = version;
+
+        std::shared_ptr<values_at_nearest> state = std::make_shared<values_at_nearest>();
+        state->next = 1;
+        state->outstanding = times.size() - 1;
+        const std::vector<std::int64_t>* all_times = &times;
+        std::function<void()> send = [=, &send]() {
+            std::size_t i;
+            {
+                std::lock_guard<std::mutex> lock(state->lock);
+                if (state->next == all_times->size()) {
+                    return;
+                }
+                i = state->next++;
+            }
+            this->nearestAsync(ctx, [=, &send](Status status, const RawPoint& point, std::uint64_t point_version) {
+                if (!status.isError()) {
+                    (*result)[i] = point;
+                }
+                (*statuses)[i] = status;
+                send();
+
+                std::lock_guard<std::mutex> lock(state->lock);
+                if (--state->outstanding == 0) {
+                    state->done.notify_all();
+                }
+            }, (*all_times)[i], backward, version);
+        };
+        for (std::size_t i = 0; i != VALUES_AT_IN_FLIGHT; i++) {
+            send();
+        }
+
+        std::unique_lock<std::mutex> lock(state->lock);
+        state->done.wait(lock, [&]() {
+            return state->outstanding == 0;
+        });
+    }
+
     Status Stream::refreshMetadata(std::function<void(grpc::ClientContext*)> ctx) {
         Status status;
         grpcinterface::StreamInfoResponse streamInfo;
+        std::int64_t revision;
         do {
+            revision = this->b_->mashRevision();
             std::shared_ptr<Endpoint> ep;
             status = this->b_->endpointFor(ctx, this->uuid_, &ep);
             if (status.isError()) {
                 continue;
             }
             status = ep->streamInfo(ctx, this->uuid_, &streamInfo, true, false);
-        } while (this->b_->handleEndpointStatus(status));
+        } while (this->b_->handleEndpointStatus(status, revision));
 
         if (!status.isError()) {
             const grpcinterface::StreamDescriptor& descriptor = streamInfo.streamdescriptor();
@@ -327,24 +809,77 @@ namespace btrdb {
     }
 
     void Stream::updateFromDescriptor(const grpcinterface::StreamDescriptor& descriptor) {
-        this->known_to_exist_ = true;
+        this->setMetadata(metadata_from_descriptor(descriptor));
+    }
 
-        this->has_tags_ = true;
-        this->tags_.clear();
-        for (int i = 0; i != descriptor.tags_size(); i++) {
-            const grpcinterface::KeyValue& kvpair = descriptor.tags(i);
-            this->tags_[kvpair.key()] = kvpair.value();
+    void Stream::annotationsSet(std::uint64_t expected_version, const std::map<std::string, std::pair<std::string, bool>>& changes) {
+        std::shared_ptr<const StreamMetadata> current = std::atomic_load(&this->metadata_);
+        if (current == nullptr && this->b_ != nullptr) {
+            current = this->b_->metadata_cache_.get(this->uuid_);
+        }
+        if (current == nullptr || current->annotation_version != expected_version) {
+            /* The change was made to annotations we have not seen, so what they are now is unknown. */
+            std::atomic_store(&this->metadata_, std::shared_ptr<const StreamMetadata>());
+            if (this->b_ != nullptr) {
+                this->b_->metadata_cache_.invalidate(this->uuid_);
+            }
+            return;
         }
 
-        this->has_annotations_ = true;
-        this->annotations_.clear();
-        for (int i = 0; i != descriptor.annotations_size(); i++) {
-            const grpcinterface::KeyValue& kvpair = descriptor.annotations(i);
-            this->annotations_[kvpair.key()] = kvpair.value();
+        /* The server moves the version on by one for each accepted change. */
+        std::shared_ptr<StreamMetadata> updated = std::make_shared<StreamMetadata>(*current);
+        for (auto it = changes.begin(); it != changes.end(); it++) {
+            if (it->second.second) {
+                updated->annotations[it->first] = it->second.first;
+            } else {
+                updated->annotations.erase(it->first);
+            }
         }
-        this->annotations_version_ = descriptor.annotationversion();
+        updated->annotation_version = expected_version + 1;
+        this->setMetadata(std::move(updated));
+    }
 
-        this->has_collection_ = true;
-        this->collection_ = descriptor.collection();
+    void Stream::setMetadata(std::shared_ptr<const StreamMetadata> metadata) {
+        if (this->b_ != nullptr) {
+            metadata = this->b_->metadata_cache_.put(this->uuid_, std::move(metadata));
+        }
+        std::atomic_store(&this->metadata_, std::move(metadata));
+    }
+
+    const StreamMetadata* Stream::pin(std::shared_ptr<const StreamMetadata> metadata) {
+        std::lock_guard<std::mutex> lock(this->pinned_lock_);
+        /* Same version, same contents, so there is no need to keep another copy. */
+        if (this->pinned_.empty() || this->pinned_.back()->annotation_version != metadata->annotation_version) {
+            this->pinned_.push_back(std::move(metadata));
+        }
+        return this->pinned_.back().get();
+    }
+
+    void Stream::attach(const std::shared_ptr<BTrDB>& b) {
+        this->b_ = b;
+        std::shared_ptr<const StreamMetadata> metadata = std::atomic_load(&this->metadata_);
+        if (metadata != nullptr) {
+            this->setMetadata(std::move(metadata));
+        }
+    }
+
+    void Stream::toDescriptor(grpcinterface::StreamDescriptor* descriptor) const {
+        descriptor->set_uuid(this->uuid_, UUID_NUM_BYTES);
+        std::shared_ptr<const StreamMetadata> metadata = std::atomic_load(&this->metadata_);
+        if (metadata == nullptr) {
+            return;
+        }
+        descriptor->set_collection(metadata->collection);
+        for (auto it = metadata->tags.begin(); it != metadata->tags.end(); it++) {
+            grpcinterface::KeyValue* kv = descriptor->add_tags();
+            kv->set_key(it->first);
+            kv->set_value(it->second);
+        }
+        for (auto it = metadata->annotations.begin(); it != metadata->annotations.end(); it++) {
+            grpcinterface::KeyValue* kv = descriptor->add_annotations();
+            kv->set_key(it->first);
+            kv->set_value(it->second);
+        }
+        descriptor->set_annotationversion(metadata->annotation_version);
     }
 }
@@ -3,11 +3,13 @@
 
 #include <cstdint>
 
+#include "btrdb_metacache.h"
 #include "btrdb_util.h"
 
 namespace btrdb {
     class BTrDB;
     class Endpoint;
+    class HedgedCall;
 
     class Stream {
     public:
@@ -15,13 +17,34 @@ namespace btrdb {
 
         Stream(const std::shared_ptr<BTrDB>& b, const void* uuid);
         Stream(const std::shared_ptr<BTrDB>& b, const grpcinterface::StreamDescriptor& descriptor);
+        Stream(const std::shared_ptr<BTrDB>& b, const void* uuid, std::shared_ptr<const StreamMetadata> metadata);
         Status exists(std::function<void(grpc::ClientContext*)> ctx, bool* result);
         Status collection(std::function<void(grpc::ClientContext*)> ctx, const std::string** collection_ptr);
         Status tags(std::function<void(grpc::ClientContext*)> ctx, const std::map<std::string, std::string>** tags_ptr);
         Status annotations(std::function<void(grpc::ClientContext*)> ctx, const std::map<std::string, std::string>** annotations_ptr, std::uint64_t* annotations_ver);
         Status cachedAnnotations(std::function<void(grpc::ClientContext*)> ctx, const std::map<std::string, std::string>** annotations_ptr, std::uint64_t* annotations_ver);
+        /*
+         * The cached metadata, fetching it if there is none. The pointers
+         * returned by the four calls above point into such a snapshot, which
+         * the Stream then keeps until it is destroyed, so that they stay
+         * valid for as long as the Stream does. Each annotation version
+         * handed out that way is kept, so a long-lived Stream whose
+         * annotations change often should read them through this instead.
+         */
+        Status metadata(std::function<void(grpc::ClientContext*)> ctx, std::shared_ptr<const StreamMetadata>* metadata_ptr);
+        /*
+         * Changes the annotations, provided they are still at
+         * expected_version: a key mapped to (value, true) is set to value,
+         * one mapped to (anything, false) is removed, and the rest are kept.
+         * Fails without changing anything if the version has moved on. The
+         * cached metadata is updated to match, so reading it back needs no
+         * round trip.
+         */
+        Status setAnnotations(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t expected_version, const std::map<std::string, std::pair<std::string, bool>>& changes);
         const void* UUID();
         Status version(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr);
+        /* The version last fetched by version() or BTrDB::streamInfoBulk, fetching it if there is none. */
+        Status cachedVersion(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr);
 
         /* Asynchronous API */
         Status rawValuesAsync(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct RawPoint>&, std::uint64_t)> on_data, std::int64_t start, std::int64_t end, std::uint64_t version = 0);
@@ -32,13 +55,46 @@ namespace btrdb {
 
         /* Synchronous API */
         Status insert(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, std::vector<struct RawPoint>::const_iterator data_start, std::vector<struct RawPoint>::const_iterator data_end, bool sync = false);
+        Status insert(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, const struct RawPoint* data, std::size_t count, bool sync = false);
+        /* Inserts from any random-access range of RawPoints, such as a ring buffer or a mapped file. */
+        template <typename Iterator>
+        Status insert(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, Iterator data_start, Iterator data_end, bool sync = false) {
+            if ((std::size_t) (data_end - data_start) > MAX_INSERT_POINTS) {
+                return Status::WrongArgs;
+            }
+            grpcinterface::InsertParams params;
+            insert_params(&params, this->uuid_, data_start, data_end, sync);
+            return this->insert(ctx, version_ptr, params);
+        }
+        /* Inserts count points whose times and values are in separate arrays. */
+        Status insert(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, const std::int64_t* times, const double* values, std::size_t count, bool sync = false);
         Status deleteRange(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, std::int64_t start, std::int64_t end);
+        /* Makes every insert into this stream that has returned durable, as insert with sync does for one. */
+        Status flush(std::function<void(grpc::ClientContext*)> ctx);
         Status obliterate(std::function<void(grpc::ClientContext*)> ctx);
-        Status rawValues(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct RawPoint>* result, std::uint64_t* version_ptr, std::int64_t start, std::int64_t end, std::uint64_t version = 0);
+        /* With presize, result is first grown to fit countPoints' estimate, at the cost of one more (cheap) query. */
+        Status rawValues(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct RawPoint>* result, std::uint64_t* version_ptr, std::int64_t start, std::int64_t end, std::uint64_t version = 0, bool presize = false);
         Status alignedWindows(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct StatisticalPoint>* result, std::uint64_t* version_ptr, std::int64_t start, std::int64_t end, std::uint8_t pointwidth, std::uint64_t version = 0);
         Status windows(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct StatisticalPoint>* result, std::uint64_t* version_ptr, std::int64_t start, std::int64_t end, std::uint64_t width, std::uint8_t depth, std::uint64_t version = 0);
         Status changes(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct ChangedRange>* result, std::uint64_t* version_ptr, std::uint64_t from_version, std::uint64_t to_version, std::uint8_t resolution = 0);
         Status nearest(std::function<void(grpc::ClientContext*)> ctx, RawPoint* result, std::uint64_t* version_ptr, std::int64_t timestamp, bool backward, std::uint64_t version = 0);
+        /*
+         * The point nearest to each of times, which must be in ascending
+         * order: (*result)[i] is what nearest(times[i], backward) would
+         * return, and every point is read at the same version. Timestamps
+         * that are dense compared to the points around them are answered
+         * from one rawValues query over their span, sparse ones with
+         * concurrent nearest queries. statuses and the return value are as
+         * for BTrDB::streamInfoBulk; a timestamp with no point in that
+         * direction counts as an error.
+         */
+        Status valuesAt(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct RawPoint>* result, std::uint64_t* version_ptr, const std::vector<std::int64_t>& times, bool backward, std::uint64_t version = 0, std::vector<Status>* statuses = nullptr);
+        /*
+         * Estimates the number of points in [start, end) from the counts of
+         * a few dozen alignedWindows. Windows are whole, so points up to a
+         * window's width beyond either end may be counted too.
+         */
+        Status countPoints(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* count, std::int64_t start, std::int64_t end, std::uint64_t version = 0);
 
         /* Generalized synchronous API for someone who is OK with dealing with callbacks. */
         Status rawValues(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct RawPoint>&, std::uint64_t)> on_data, std::int64_t start, std::int64_t end, std::uint64_t version = 0);
@@ -47,22 +103,44 @@ namespace btrdb {
         Status changes(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct ChangedRange>&, std::uint64_t)> on_data, std::uint64_t from_version, std::uint64_t to_version, std::uint8_t resolution = 0);
 
     private:
+        /* The request is built once and resent as is if the MASH was stale. */
+        Status insert(std::function<void(grpc::ClientContext*)> ctx, std::uint64_t* version_ptr, const grpcinterface::InsertParams& params);
+        /* The two ways valuesAt answers; both fill result and statuses for every timestamp. */
+        Status valuesAtFromRange(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct RawPoint>* result, std::uint64_t* version_ptr, const std::vector<std::int64_t>& times, bool backward, std::uint64_t version, std::vector<Status>* statuses);
+        void valuesAtFromNearest(std::function<void(grpc::ClientContext*)> ctx, std::vector<struct RawPoint>* result, std::uint64_t* version_ptr, const std::vector<std::int64_t>& times, bool backward, std::uint64_t version, std::vector<Status>* statuses);
         Status refreshMetadata(std::function<void(grpc::ClientContext*)> ctx);
         void updateFromDescriptor(const grpcinterface::StreamDescriptor& descriptor);
+        /* Applies changes that the server accepted at expected_version to the cached metadata, or drops it if it was not at that version. */
+        void annotationsSet(std::uint64_t expected_version, const std::map<std::string, std::pair<std::string, bool>>& changes);
+        /* Shares metadata through the BTrDB's cache, if there is one, and keeps the newest version. */
+        void setMetadata(std::shared_ptr<const StreamMetadata> metadata);
+        /* Sets b_ for a Stream that was built before it was known. */
+        void attach(const std::shared_ptr<BTrDB>& b);
+        void toDescriptor(grpcinterface::StreamDescriptor* descriptor) const;
+        /* Keeps metadata alive for the Stream's lifetime and returns it, or an equal snapshot kept earlier. */
+        const StreamMetadata* pin(std::shared_ptr<const StreamMetadata> metadata);
+
+        template <typename V>
+        Status directQuery(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<V>&, std::uint64_t)> on_data, std::function<Status(Endpoint*, std::function<void(bool, Status, std::vector<V>&, std::uint64_t)>)> query);
+
+        /* The retrying part of alignedWindowsAsync, after coalescing. */
+        Status alignedWindowsAsyncHelper(std::function<void(grpc::ClientContext*)> ctx, std::function<void(bool, Status, std::vector<struct StatisticalPoint>&, std::uint64_t)> on_data, std::int64_t start, std::int64_t end, std::uint8_t pointwidth, std::uint64_t version);
+        std::string alignedWindowsKey(std::int64_t start, std::int64_t end, std::uint8_t pointwidth, std::uint64_t version) const;
+
+        /* Sends a hedge for call, as attempt 1, if hedging applies. */
+        void hedge(const std::shared_ptr<HedgedCall>& call, std::function<void(std::shared_ptr<Endpoint>, int)> attempt);
 
         std::shared_ptr<BTrDB> b_;
         char uuid_[16];
-        bool known_to_exist_;
-
-        bool has_tags_;
-        std::map<std::string, std::string> tags_;
 
-        bool has_annotations_;
-        std::map<std::string, std::string> annotations_;
-        std::uint64_t annotations_version_;
+        /* Null until known; read and written with std::atomic_load and std::atomic_store. */
+        std::shared_ptr<const StreamMetadata> metadata_;
+        /* The snapshots that pointers were handed out into, oldest first. */
+        std::vector<std::shared_ptr<const StreamMetadata>> pinned_;
+        std::mutex pinned_lock_;
 
-        bool has_collection_;
-        std::string collection_;
+        bool has_version_;
+        std::uint64_t version_;
     };
 }
 
@@ -0,0 +1,168 @@
+#include "btrdb_streamtable.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace btrdb {
+    /* Words per arena chunk; a stream with more pairs than fit gets a chunk of its own. */
+    static const constexpr std::size_t CHUNK_WORDS = 1 << 16;
+    /* Rough per-entry cost of an unordered_map node and bucket, for bytes(). */
+    static const constexpr std::size_t STRING_OVERHEAD = 64;
+
+    StreamTable::StreamTable() : string_bytes_(0), chunk_used_(CHUNK_WORDS), arena_words_(0) {
+    }
+
+    std::uint32_t StreamTable::intern(const std::string& s) {
+        auto it = this->ids_.find(s);
+        if (it != this->ids_.end()) {
+            return it->second;
+        }
+        std::uint32_t id = (std::uint32_t) this->strings_.size();
+        it = this->ids_.emplace(s, id).first;
+        this->strings_.push_back(&it->first);
+        this->string_bytes_ += STRING_OVERHEAD + s.capacity();
+        return id;
+    }
+
+    std::uint32_t* StreamTable::allocate(std::size_t num_words) {
+        if (num_words == 0) {
+            /* A stream with no tags or annotations; there may be no chunk yet to point into. */
+            return nullptr;
+        }
+        if (num_words > CHUNK_WORDS) {
+            /* Put it before the chunk being filled, which stays last. */
+            std::unique_ptr<std::uint32_t[]> chunk(new std::uint32_t[num_words]);
+            std::uint32_t* words = chunk.get();
+            this->chunks_.insert(this->chunks_.empty() ? this->chunks_.end() : this->chunks_.end() - 1, std::move(chunk));
+            this->arena_words_ += num_words;
+            return words;
+        }
+        if (this->chunk_used_ + num_words > CHUNK_WORDS) {
+            this->chunks_.emplace_back(new std::uint32_t[CHUNK_WORDS]);
+            this->arena_words_ += CHUNK_WORDS;
+            this->chunk_used_ = 0;
+        }
+        std::uint32_t* words = this->chunks_.back().get() + this->chunk_used_;
+        this->chunk_used_ += num_words;
+        return words;
+    }
+
+    std::uint32_t* StreamTable::addPairs(const google::protobuf::RepeatedPtrField<grpcinterface::KeyValue>& kvs, std::size_t count, std::uint32_t* out) {
+        /* Streams have a handful of tags, so an insertion sort in place beats anything that allocates. */
+        for (std::size_t i = 0; i != count; i++) {
+            const grpcinterface::KeyValue& kv = kvs.Get((int) i);
+            std::uint32_t key = this->intern(kv.key());
+            std::uint32_t value = this->intern(kv.value());
+            std::size_t j = i;
+            while (j != 0 && *this->strings_[key] < *this->strings_[out[2 * (j - 1)]]) {
+                out[2 * j] = out[2 * (j - 1)];
+                out[2 * j + 1] = out[2 * (j - 1) + 1];
+                j--;
+            }
+            out[2 * j] = key;
+            out[2 * j + 1] = value;
+        }
+        return out + 2 * count;
+    }
+
+    StreamHandle StreamTable::add(const grpcinterface::StreamDescriptor& descriptor) {
+        StreamHandle handle;
+        std::memcpy(handle.uuid, descriptor.uuid().data(), UUID_NUM_BYTES);
+
+        /* More than 65535 tags or annotations on one stream is not something BTrDB clients do; extras are dropped. */
+        std::uint16_t num_tags = (std::uint16_t) std::min(descriptor.tags_size(), 0xFFFF);
+        std::uint16_t num_annotations = (std::uint16_t) std::min(descriptor.annotations_size(), 0xFFFF);
+
+        std::lock_guard<std::mutex> lock(this->lock_);
+        record r;
+        r.collection = this->intern(descriptor.collection());
+        r.annotation_version = descriptor.annotationversion();
+        r.num_tags = num_tags;
+        r.num_annotations = num_annotations;
+        std::uint32_t* pairs = this->allocate(2 * ((std::size_t) num_tags + num_annotations));
+        this->addPairs(descriptor.annotations(), num_annotations, this->addPairs(descriptor.tags(), num_tags, pairs));
+        r.pairs = pairs;
+
+        handle.index = (std::uint32_t) this->records_.size();
+        this->records_.push_back(r);
+        return handle;
+    }
+
+    std::size_t StreamTable::size() {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        return this->records_.size();
+    }
+
+    std::size_t StreamTable::bytes() {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        return this->records_.size() * sizeof(record) +
+               this->arena_words_ * sizeof(std::uint32_t) +
+               this->strings_.capacity() * sizeof(const std::string*) +
+               this->string_bytes_;
+    }
+
+    std::string StreamTable::collection(const StreamHandle& handle) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        return *this->strings_[this->records_[handle.index].collection];
+    }
+
+    std::uint64_t StreamTable::annotationVersion(const StreamHandle& handle) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        return this->records_[handle.index].annotation_version;
+    }
+
+    bool StreamTable::find(const std::uint32_t* pairs, std::size_t count, const std::string& key, std::string* value) {
+        std::size_t lo = 0;
+        std::size_t hi = count;
+        while (lo < hi) {
+            std::size_t mid = lo + (hi - lo) / 2;
+            int cmp = this->strings_[pairs[2 * mid]]->compare(key);
+            if (cmp == 0) {
+                *value = *this->strings_[pairs[2 * mid + 1]];
+                return true;
+            } else if (cmp < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return false;
+    }
+
+    bool StreamTable::tag(const StreamHandle& handle, const std::string& key, std::string* value) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        const record& r = this->records_[handle.index];
+        return this->find(r.pairs, r.num_tags, key, value);
+    }
+
+    bool StreamTable::annotation(const StreamHandle& handle, const std::string& key, std::string* value) {
+        std::lock_guard<std::mutex> lock(this->lock_);
+        const record& r = this->records_[handle.index];
+        return this->find(r.pairs + 2 * r.num_tags, r.num_annotations, key, value);
+    }
+
+    std::map<std::string, std::string> StreamTable::tags(const StreamHandle& handle) {
+        return this->metadata(handle)->tags;
+    }
+
+    std::map<std::string, std::string> StreamTable::annotations(const StreamHandle& handle) {
+        return this->metadata(handle)->annotations;
+    }
+
+    std::shared_ptr<const StreamMetadata> StreamTable::metadata(const StreamHandle& handle) {
+        std::shared_ptr<StreamMetadata> metadata = std::make_shared<StreamMetadata>();
+        std::lock_guard<std::mutex> lock(this->lock_);
+        const record& r = this->records_[handle.index];
+        metadata->collection = *this->strings_[r.collection];
+        metadata->annotation_version = r.annotation_version;
+        /* The pairs are sorted by key, so each map can be built with end hints. */
+        const std::uint32_t* pair = r.pairs;
+        for (std::uint16_t i = 0; i != r.num_tags; i++, pair += 2) {
+            metadata->tags.emplace_hint(metadata->tags.end(), *this->strings_[pair[0]], *this->strings_[pair[1]]);
+        }
+        for (std::uint16_t i = 0; i != r.num_annotations; i++, pair += 2) {
+            metadata->annotations.emplace_hint(metadata->annotations.end(), *this->strings_[pair[0]], *this->strings_[pair[1]]);
+        }
+        return metadata;
+    }
+}
@@ -0,0 +1,85 @@
+#ifndef BTRDB_STREAMTABLE_H_
+#define BTRDB_STREAMTABLE_H_
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "btrdb.pb.h"
+#include "btrdb_metacache.h"
+#include "btrdb_util.h"
+
+namespace btrdb {
+    /*
+     * A stream as a UUID and the index of its metadata in a StreamTable.
+     * It is 20 bytes and owns nothing, so millions of them are cheap to
+     * hold and copy; BTrDB::streamFromHandle turns one into a Stream.
+     */
+    struct StreamHandle {
+        char uuid[UUID_NUM_BYTES];
+        std::uint32_t index;
+    };
+
+    /*
+     * Metadata of many streams, stored compactly. Every string (collection,
+     * tag and annotation keys and values) is stored once however many
+     * streams use it, and each stream's tags and annotations are runs of
+     * string ids, sorted by key, in a shared arena. Safe to use from
+     * several threads.
+     */
+    class StreamTable {
+    public:
+        StreamTable();
+        StreamTable(const StreamTable&) = delete;
+        StreamTable& operator=(const StreamTable&) = delete;
+
+        StreamHandle add(const grpcinterface::StreamDescriptor& descriptor);
+
+        std::size_t size();
+        /* Approximate heap used by the table, not counting the handles. */
+        std::size_t bytes();
+
+        std::string collection(const StreamHandle& handle);
+        std::uint64_t annotationVersion(const StreamHandle& handle);
+        /* Sets *value and returns true if the stream has the tag (annotation). */
+        bool tag(const StreamHandle& handle, const std::string& key, std::string* value);
+        bool annotation(const StreamHandle& handle, const std::string& key, std::string* value);
+        std::map<std::string, std::string> tags(const StreamHandle& handle);
+        std::map<std::string, std::string> annotations(const StreamHandle& handle);
+        std::shared_ptr<const StreamMetadata> metadata(const StreamHandle& handle);
+
+    private:
+        struct record {
+            /* num_tags tag pairs followed by num_annotations annotation pairs, as (key id, value id). */
+            const std::uint32_t* pairs;
+            std::uint64_t annotation_version;
+            std::uint32_t collection;
+            std::uint16_t num_tags;
+            std::uint16_t num_annotations;
+        };
+
+        std::uint32_t intern(const std::string& s);
+        std::uint32_t* allocate(std::size_t num_words);
+        /* Writes the first count of kvs to out, sorted by key, and returns the end of what it wrote. */
+        std::uint32_t* addPairs(const google::protobuf::RepeatedPtrField<grpcinterface::KeyValue>& kvs, std::size_t count, std::uint32_t* out);
+        bool find(const std::uint32_t* pairs, std::size_t count, const std::string& key, std::string* value);
+
+        std::mutex lock_;
+        std::unordered_map<std::string, std::uint32_t> ids_;
+        /* Points at the keys of ids_, whose nodes never move. */
+        std::vector<const std::string*> strings_;
+        std::size_t string_bytes_;
+        std::deque<record> records_;
+        std::vector<std::unique_ptr<std::uint32_t[]>> chunks_;
+        /* Words used in the last chunk, and in all chunks together. */
+        std::size_t chunk_used_;
+        std::size_t arena_words_;
+    };
+}
+
+#endif // BTRDB_STREAMTABLE_H_
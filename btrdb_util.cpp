@@ -1,8 +1,28 @@
 #include "btrdb_util.h"
+#include <fstream>
 #include <sstream>
 #include <grpc++/grpc++.h>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace btrdb {
+    static thread_local RequestClass current_class;
+
+    RequestClass current_request_class() {
+        return current_class;
+    }
+
+    RequestScope::RequestScope(const RequestClass& request_class) : previous_(current_class) {
+        current_class = request_class;
+    }
+
+    RequestScope::~RequestScope() {
+        current_class = this->previous_;
+    }
+
     std::vector<std::string> split_string(const std::string& str, char delimiter) {
         std::vector<std::string> parts;
 
@@ -15,14 +35,59 @@ namespace btrdb {
         return parts;
     }
 
-    Status::Status() : type_(Status::Type::StatusOK), code_(0), message_() {}
+    bool pin_current_thread(const std::vector<int>& cpus) {
+        if (cpus.empty()) {
+            return false;
+        }
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &set);
+            }
+        }
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        return false;
+#endif
+    }
+
+    std::vector<int> numa_node_cpus(int node) {
+        std::vector<int> cpus;
+
+        /* The kernel describes a node's CPUs as a list of ranges, e.g. "0-3,8-11". */
+        std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string line;
+        if (!std::getline(cpulist, line)) {
+            return cpus;
+        }
+        for (const std::string& range : split_string(line, ',')) {
+            int first;
+            int last;
+            char dash;
+            std::istringstream parser(range);
+            if (!(parser >> first)) {
+                continue;
+            }
+            if (!(parser >> dash >> last)) {
+                last = first;
+            }
+            for (int cpu = first; cpu <= last; cpu++) {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+    }
+
+    Status::Status() : type_(Status::Type::StatusOK), code_(0), grpc_code_(grpc::StatusCode::OK), message_() {}
 
     Status::Status(const grpc::Status& grpcstatus)
-        : type_(Status::Type::GRPCError), code_(0),
+        : type_(Status::Type::GRPCError), code_(0), grpc_code_(grpcstatus.error_code()),
           message_(grpcstatus.error_message()) {}
 
     Status::Status(std::uint32_t code, std::string message)
-        : type_(Status::Type::CodedError), code_(code), message_(message) {
+        : type_(Status::Type::CodedError), code_(code), grpc_code_(grpc::StatusCode::OK), message_(message) {
         if (code == 0) {
             type_ = Status::Type::StatusOK;
         }
@@ -35,6 +100,10 @@ namespace btrdb {
         return this->type_ != Status::Type::StatusOK;
     }
 
+    bool Status::isTransportError() const {
+        return this->type_ == Status::Type::GRPCError && this->grpc_code_ == grpc::StatusCode::UNAVAILABLE;
+    }
+
     std::uint32_t Status::code() const {
         return this->code_;
     }
@@ -59,6 +128,19 @@ namespace btrdb {
 
     const Status Status::ClusterDegraded(419, "Cluster is degraded");
     const Status Status::NoSuchStream(404, "No such stream");
+    const Status Status::Unhealthy(422, "Endpoint is unhealthy");
     const Status Status::WrongArgs(421, "Invalid arguments");
     const Status Status::Disconnected(421, "Driver is disconnected");
+
+    void insert_params(grpcinterface::InsertParams* params, const void* uuid, const std::int64_t* times, const double* values, std::size_t count, bool sync) {
+        params->set_uuid(uuid, 16);
+        params->set_sync(sync);
+        google::protobuf::RepeatedPtrField<grpcinterface::RawPoint>* points = params->mutable_values();
+        points->Reserve(points->size() + (int) count);
+        for (std::size_t i = 0; i != count; i++) {
+            grpcinterface::RawPoint* point = points->Add();
+            point->set_time(times[i]);
+            point->set_value(values[i]);
+        }
+    }
 }
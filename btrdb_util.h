@@ -1,8 +1,11 @@
 #ifndef BTRDB_UTIL_H_
 #define BTRDB_UTIL_H_
 
+#include <algorithm>
+#include <climits>
 #include <cstdlib>
 #include <functional>
+#include <iterator>
 #include <mutex>
 #include <condition_variable>
 #include <vector>
@@ -12,6 +15,8 @@
 namespace btrdb {
     /* Some useful constants. */
     const constexpr std::size_t UUID_NUM_BYTES = 16;
+    /* The most points one Insert can carry, since protobuf sizes repeated fields with an int. */
+    const constexpr std::size_t MAX_INSERT_POINTS = INT_MAX;
 
     /* Structures for BTrDB data. */
     struct RawPoint {
@@ -32,12 +37,54 @@ namespace btrdb {
         std::int64_t end;
     };
 
+    /* Scheduling class of an RPC (see AdmissionOptions). */
+    enum class Priority {
+        Interactive,
+        Batch
+    };
+
+    struct RequestClass {
+        Priority priority = Priority::Interactive;
+        /* Identifies the caller; callers of the same priority are served round-robin. */
+        std::uint64_t caller = 0;
+    };
+
+    /* The RequestClass of RPCs issued by this thread. */
+    RequestClass current_request_class();
+
+    /*
+     * Sets the RequestClass of RPCs issued by this thread until destroyed.
+     * Callbacks of async requests run with the class that was current when
+     * the request was issued, so retries keep it.
+     */
+    class RequestScope {
+    public:
+        explicit RequestScope(const RequestClass& request_class);
+        ~RequestScope();
+        RequestScope(const RequestScope&) = delete;
+        RequestScope& operator=(const RequestScope&) = delete;
+
+    private:
+        RequestClass previous_;
+    };
+
+    class Status;
+
     /* Interface to keep track of data for pending async requests. */
     class AsyncRequest {
     public:
+        AsyncRequest() : request_class(current_request_class()) {}
         virtual ~AsyncRequest() {}
         virtual bool process_batch() = 0;
         virtual void end_request() = 0;
+
+        /* Reports an error for a request that was never started. */
+        virtual void fail(const Status& status) {
+            (void) status;
+            this->end_request();
+        }
+
+        RequestClass request_class;
     };
 
     /* Status type. */
@@ -49,6 +96,12 @@ namespace btrdb {
         Status(const grpcinterface::Status& btrdbstatus);
 
         bool isError() const;
+        /*
+         * Whether the RPC failed to reach the server, rather than being
+         * refused by it. A timeout does not count: the deadline is the
+         * caller's, and a short one says nothing about the server.
+         */
+        bool isTransportError() const;
         std::uint32_t code() const;
         std::string message() const;
 
@@ -71,6 +124,7 @@ namespace btrdb {
         static const Status ClusterDegraded;
         static const Status WrongArgs;
         static const Status NoSuchStream;
+        static const Status Unhealthy;
 
     private:
         enum Type {
@@ -80,12 +134,22 @@ namespace btrdb {
         };
         Type type_;
         std::uint32_t code_;
+        grpc::StatusCode grpc_code_;
         std::string message_;
     };
 
     /* Some useful functions. */
     std::vector<std::string> split_string(const std::string& str, char delimiter);
 
+    /*
+     * Restricts the calling thread to the given CPUs. Returns false if the
+     * list is empty or if thread affinity is not supported on this platform.
+     */
+    bool pin_current_thread(const std::vector<int>& cpus);
+
+    /* Returns the CPUs that belong to a NUMA node, or nothing if unknown. */
+    std::vector<int> numa_node_cpus(int node);
+
     template <typename V, typename... ExtraArgs>
     Status async_to_sync(std::function<Status(std::function<void(bool, Status, V, ExtraArgs...)>)> async_fn, std::function<void(bool, Status, V, ExtraArgs...)> worker) {
         bool done = false;
@@ -120,15 +184,43 @@ namespace btrdb {
         return status;
     }
 
+    /* Fills in an Insert request from any random-access range of RawPoints, of at most MAX_INSERT_POINTS. */
+    template <typename Iterator>
+    void insert_params(grpcinterface::InsertParams* params, const void* uuid, Iterator data_start, Iterator data_end, bool sync) {
+        params->set_uuid(uuid, 16);
+        params->set_sync(sync);
+        google::protobuf::RepeatedPtrField<grpcinterface::RawPoint>* values = params->mutable_values();
+        values->Reserve(values->size() + (int) (data_end - data_start));
+        for (Iterator i = data_start; i != data_end; ++i) {
+            const struct RawPoint& point = *i;
+            grpcinterface::RawPoint* value = values->Add();
+            value->set_time(point.time);
+            value->set_value(point.value);
+        }
+    }
+
+    /* Fills in an Insert request from separate columns of times and values; count is at most MAX_INSERT_POINTS. */
+    void insert_params(grpcinterface::InsertParams* params, const void* uuid, const std::int64_t* times, const double* values, std::size_t count, bool sync);
+
+    /*
+     * Moves a batch onto the end of result. Capacity at least doubles when
+     * it runs out; reserving exactly what each batch needs would copy the
+     * whole result again for every batch.
+     */
+    template <typename V>
+    void append_batch(std::vector<V>* result, std::vector<V>& data) {
+        typename std::vector<V>::size_type needed = result->size() + data.size();
+        if (needed > result->capacity()) {
+            result->reserve(std::max(needed, 2 * result->capacity()));
+        }
+        result->insert(result->end(), std::make_move_iterator(data.begin()), std::make_move_iterator(data.end()));
+    }
+
     template <typename V>
     std::function<void(bool, Status, std::vector<V>&)> collect_worker(std::vector<V>* result) {
         return [=](bool finished, Status stat, std::vector<V>& data) {
             (void) finished;
-            auto num_points = data.size();
-            result->reserve(result->size() + num_points);
-            for (typename std::vector<V>::size_type i = 0; i != num_points; i++) {
-                result->push_back(std::move(data[i]));
-            }
+            append_batch(result, data);
         };
     }
 
@@ -136,11 +228,7 @@ namespace btrdb {
     std::function<void(bool, Status, std::vector<V>&, std::uint64_t)> collect_vernum_worker(std::vector<V>* result, std::uint64_t* version_ptr) {
         return [=](bool finished, Status stat, std::vector<V>& data, std::uint64_t version) {
             (void) finished;
-            auto num_points = data.size();
-            result->reserve(result->size() + num_points);
-            for (typename std::vector<V>::size_type i = 0; i != num_points; i++) {
-                result->push_back(std::move(data[i]));
-            }
+            append_batch(result, data);
             *version_ptr = version;
         };
     }
@@ -0,0 +1,931 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <malloc.h>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpc++/alarm.h>
+#include <grpc++/grpc++.h>
+
+#include <btrdb/btrdb.h>
+
+typedef std::chrono::steady_clock bench_clock;
+
+void bench_ctx(grpc::ClientContext* ctx) {
+}
+
+bool parse_uuid(const std::string& uuid_str, char* uuid_bytes) {
+    std::string hex;
+    for (char c : uuid_str) {
+        if (c != '-') {
+            hex.push_back(c);
+        }
+    }
+    if (hex.size() != 32) {
+        return false;
+    }
+    for (int i = 0; i != 16; i++) {
+        unsigned int byte;
+        if (std::sscanf(hex.c_str() + 2 * i, "%2x", &byte) != 1) {
+            return false;
+        }
+        uuid_bytes[i] = (char) byte;
+    }
+    return true;
+}
+
+template <typename T>
+bool parse_number(const std::string& s, T* number) {
+    std::stringstream parser(s);
+    parser >> *number;
+    return !parser.fail();
+}
+
+/* Prints the median and tail of a set of per-operation latencies. */
+void report_latencies(const std::string& label, std::vector<std::int64_t>& nanos) {
+    if (nanos.empty()) {
+        return;
+    }
+    std::sort(nanos.begin(), nanos.end());
+    auto percentile = [&](double p) {
+        return nanos[(std::size_t) (p * (nanos.size() - 1))] / 1000.0;
+    };
+    std::cout << label << ": n=" << nanos.size()
+              << " p50=" << percentile(0.50) << "us"
+              << " p99=" << percentile(0.99) << "us"
+              << " max=" << nanos.back() / 1000.0 << "us" << std::endl;
+}
+
+int bench_nearest(const std::vector<std::string>& args) {
+    if (args.size() < 2) {
+        std::cout << "Usage: nearest address:port UUID [iterations]" << std::endl;
+        return 1;
+    }
+
+    char uuid[16];
+    if (!parse_uuid(args[1], uuid)) {
+        std::cout << "Bad UUID" << std::endl;
+        return 1;
+    }
+
+    int iterations = 10000;
+    if (args.size() > 2 && !parse_number(args[2], &iterations)) {
+        std::cout << "Bad iterations" << std::endl;
+        return 1;
+    }
+
+    const btrdb::SyncMode modes[] = { btrdb::SyncMode::EventLoop, btrdb::SyncMode::Direct };
+    const char* mode_names[] = { "event loop", "direct" };
+    for (int m = 0; m != 2; m++) {
+        btrdb::ConnectOptions options;
+        options.sync_mode = modes[m];
+        std::shared_ptr<btrdb::BTrDB> b = btrdb::BTrDB::connect(bench_ctx, { args[0] }, options);
+        if (b == nullptr) {
+            std::cout << "Error: could not connect" << std::endl;
+            return 2;
+        }
+
+        std::unique_ptr<btrdb::Stream> s = b->streamFromUUID(uuid);
+        std::vector<std::int64_t> nanos;
+        nanos.reserve(iterations);
+        for (int i = 0; i != iterations + iterations / 10; i++) {
+            struct btrdb::RawPoint pt;
+            std::uint64_t version;
+            auto before = bench_clock::now();
+            btrdb::Status status = s->nearest(bench_ctx, &pt, &version, btrdb::BTrDB::MAX_TIME, true);
+            auto after = bench_clock::now();
+            if (status.isError()) {
+                std::cout << status.message() << std::endl;
+                return 3;
+            }
+            /* The first tenth of the iterations is warmup. */
+            if (i >= iterations / 10) {
+                nanos.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+            }
+        }
+        report_latencies(std::string("nearest (") + mode_names[m] + ")", nanos);
+    }
+    return 0;
+}
+
+/*
+ * A completion queue tag that records when the event loop delivered it. We
+ * arm an alarm on the BTrDB completion queue and measure how long after the
+ * alarm's deadline the event loop thread got around to processing it.
+ */
+class WakeupProbe : public btrdb::AsyncRequest {
+public:
+    WakeupProbe(std::atomic<std::int64_t>* delivered) : delivered_(delivered) {}
+
+    bool process_batch() override {
+        this->delivered_->store(bench_clock::now().time_since_epoch().count());
+        return true;
+    }
+
+    void end_request() override {
+        this->delivered_->store(-1);
+    }
+
+    std::unique_ptr<grpc::Alarm> alarm;
+
+private:
+    std::atomic<std::int64_t>* delivered_;
+};
+
+int bench_wakeup(const std::vector<std::string>& args) {
+    if (args.size() < 1) {
+        std::cout << "Usage: wakeup address:port [iterations] [cpu]" << std::endl;
+        return 1;
+    }
+
+    int iterations = 2000;
+    if (args.size() > 1 && !parse_number(args[1], &iterations)) {
+        std::cout << "Bad iterations" << std::endl;
+        return 1;
+    }
+
+    int cpu = -1;
+    if (args.size() > 2 && !parse_number(args[2], &cpu)) {
+        std::cout << "Bad cpu" << std::endl;
+        return 1;
+    }
+
+    struct {
+        const char* name;
+        btrdb::PollMode mode;
+        std::uint32_t max_backoff_us;
+    } configs[] = {
+        { "blocking", btrdb::PollMode::Blocking, 0 },
+        { "spin, backoff to 100us", btrdb::PollMode::Spin, 100 },
+        { "spin, no sleep", btrdb::PollMode::Spin, 0 },
+    };
+
+    for (auto& config : configs) {
+        btrdb::ConnectOptions options;
+        options.poll_mode = config.mode;
+        options.spin_max_backoff_us = config.max_backoff_us;
+        if (cpu >= 0) {
+            options.event_loop_cpus.push_back(cpu);
+        }
+        std::shared_ptr<btrdb::BTrDB> b = btrdb::BTrDB::connect(bench_ctx, { args[0] }, options);
+        if (b == nullptr) {
+            std::cout << "Error: could not connect" << std::endl;
+            return 2;
+        }
+
+        std::vector<std::int64_t> nanos;
+        for (int i = 0; i != iterations; i++) {
+            std::atomic<std::int64_t> delivered(0);
+            WakeupProbe* probe = new WakeupProbe(&delivered);
+
+            /* Leave the event loop idle for a while so that it backs off. */
+            auto deadline = bench_clock::now() + std::chrono::milliseconds(2);
+            auto system_deadline = std::chrono::system_clock::now() + std::chrono::milliseconds(2);
+            probe->alarm.reset(new grpc::Alarm(b->completion_queue, system_deadline, static_cast<btrdb::AsyncRequest*>(probe)));
+            while (delivered.load() == 0) {
+                std::this_thread::yield();
+            }
+            if (delivered.load() < 0) {
+                std::cout << "Alarm cancelled" << std::endl;
+                return 3;
+            }
+            nanos.push_back(delivered.load() - deadline.time_since_epoch().count());
+        }
+        report_latencies(std::string("wakeup (") + config.name + ")", nanos);
+    }
+    return 0;
+}
+
+/*
+ * Pulls [start, end) of a stream as NUM_STREAMS concurrent rawValuesAsync
+ * requests of equal width, returning the number of points received.
+ */
+std::uint64_t concurrent_raw_values(std::shared_ptr<btrdb::BTrDB> b, const char* uuid, std::int64_t start, std::int64_t end, int num_streams, btrdb::Status* status) {
+    std::mutex lock;
+    std::condition_variable done;
+    int outstanding = num_streams;
+    std::uint64_t num_points = 0;
+
+    std::vector<std::unique_ptr<btrdb::Stream>> streams;
+    std::int64_t width = (end - start) / num_streams;
+    for (int i = 0; i != num_streams; i++) {
+        std::int64_t sub_start = start + i * width;
+        std::int64_t sub_end = (i == num_streams - 1) ? end : sub_start + width;
+        streams.push_back(b->streamFromUUID(uuid));
+        streams.back()->rawValuesAsync(bench_ctx, [&](bool finished, btrdb::Status stat, std::vector<struct btrdb::RawPoint>& data, std::uint64_t version) {
+            std::lock_guard<std::mutex> guard(lock);
+            num_points += data.size();
+            if (stat.isError()) {
+                *status = stat;
+            }
+            if (finished && --outstanding == 0) {
+                done.notify_one();
+            }
+        }, sub_start, sub_end);
+    }
+
+    std::unique_lock<std::mutex> guard(lock);
+    while (outstanding != 0) {
+        done.wait(guard);
+    }
+    return num_points;
+}
+
+int bench_throughput(const std::vector<std::string>& args) {
+    if (args.size() < 4) {
+        std::cout << "Usage: throughput address:port UUID start end [concurrent requests] [max channels]" << std::endl;
+        return 1;
+    }
+
+    char uuid[16];
+    if (!parse_uuid(args[1], uuid)) {
+        std::cout << "Bad UUID" << std::endl;
+        return 1;
+    }
+
+    std::int64_t start;
+    std::int64_t end;
+    if (!parse_number(args[2], &start) || !parse_number(args[3], &end) || end <= start) {
+        std::cout << "Bad time range" << std::endl;
+        return 1;
+    }
+
+    int num_streams = 16;
+    if (args.size() > 4 && !parse_number(args[4], &num_streams)) {
+        std::cout << "Bad number of concurrent requests" << std::endl;
+        return 1;
+    }
+
+    std::size_t max_channels = 8;
+    if (args.size() > 5 && !parse_number(args[5], &max_channels)) {
+        std::cout << "Bad number of channels" << std::endl;
+        return 1;
+    }
+
+    for (std::size_t channels = 1; channels <= max_channels; channels *= 2) {
+        btrdb::ConnectOptions options;
+        options.channel.num_channels = channels;
+        std::shared_ptr<btrdb::BTrDB> b = btrdb::BTrDB::connect(bench_ctx, { args[0] }, options);
+        if (b == nullptr) {
+            std::cout << "Error: could not connect" << std::endl;
+            return 2;
+        }
+
+        btrdb::Status status;
+        auto before = bench_clock::now();
+        std::uint64_t num_points = concurrent_raw_values(b, uuid, start, end, num_streams, &status);
+        auto after = bench_clock::now();
+        if (status.isError()) {
+            std::cout << status.message() << std::endl;
+            return 3;
+        }
+
+        double seconds = std::chrono::duration<double>(after - before).count();
+        std::cout << "throughput (" << channels << " channels): "
+                  << num_points << " points in " << seconds << "s, "
+                  << (num_points / seconds / 1e6) << " Mpoints/s" << std::endl;
+    }
+    return 0;
+}
+
+int bench_tuning(const std::vector<std::string>& args) {
+    if (args.size() < 4) {
+        std::cout << "Usage: tuning address:port UUID start end [concurrent requests]" << std::endl;
+        return 1;
+    }
+
+    char uuid[16];
+    if (!parse_uuid(args[1], uuid)) {
+        std::cout << "Bad UUID" << std::endl;
+        return 1;
+    }
+
+    std::int64_t start;
+    std::int64_t end;
+    if (!parse_number(args[2], &start) || !parse_number(args[3], &end) || end <= start) {
+        std::cout << "Bad time range" << std::endl;
+        return 1;
+    }
+
+    int num_streams = 1;
+    if (args.size() > 4 && !parse_number(args[4], &num_streams)) {
+        std::cout << "Bad number of concurrent requests" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::pair<std::string, btrdb::ChannelOptions>> configs;
+    configs.emplace_back("defaults", btrdb::ChannelOptions());
+
+    btrdb::ChannelOptions large_window;
+    large_window.http2_stream_window_size = 16 << 20;
+    large_window.http2_bdp_probe = false;
+    configs.emplace_back("16 MiB stream window", large_window);
+
+    btrdb::ChannelOptions large_messages;
+    large_messages.max_receive_message_size = -1;
+    large_messages.http2_max_frame_size = 1 << 20;
+    configs.emplace_back("unlimited messages, 1 MiB frames", large_messages);
+
+    btrdb::ChannelOptions gzip;
+    gzip.compression = GRPC_COMPRESS_GZIP;
+    configs.emplace_back("gzip", gzip);
+
+    for (auto& config : configs) {
+        btrdb::ConnectOptions options;
+        options.channel = config.second;
+        std::shared_ptr<btrdb::BTrDB> b = btrdb::BTrDB::connect(bench_ctx, { args[0] }, options);
+        if (b == nullptr) {
+            std::cout << "Error: could not connect" << std::endl;
+            return 2;
+        }
+
+        btrdb::Status status;
+        auto before = bench_clock::now();
+        std::uint64_t num_points = concurrent_raw_values(b, uuid, start, end, num_streams, &status);
+        auto after = bench_clock::now();
+        if (status.isError()) {
+            std::cout << status.message() << std::endl;
+            return 3;
+        }
+
+        double seconds = std::chrono::duration<double>(after - before).count();
+        std::cout << "tuning (" << config.first << "): "
+                  << num_points << " points in " << seconds << "s, "
+                  << (num_points / seconds / 1e6) << " Mpoints/s" << std::endl;
+    }
+    return 0;
+}
+
+/*
+ * Routes random UUIDs over a synthetic MASH with evenly split hash ranges,
+ * one at a time with endpointFor and as one batch with route. No server is
+ * needed.
+ */
+int bench_route(const std::vector<std::string>& args) {
+    std::size_t num_uuids = 1000000;
+    if (args.size() > 0 && !parse_number(args[0], &num_uuids)) {
+        std::cout << "Bad number of UUIDs" << std::endl;
+        return 1;
+    }
+
+    int num_members = 16;
+    if (args.size() > 1 && (!parse_number(args[1], &num_members) || num_members <= 0)) {
+        std::cout << "Bad number of members" << std::endl;
+        return 1;
+    }
+
+    grpcinterface::Mash proto;
+    std::int64_t space = INT64_C(1) << 32;
+    for (int i = 0; i != num_members; i++) {
+        grpcinterface::Member* member = proto.add_members();
+        member->set_hash(i + 1);
+        member->set_in(true);
+        member->set_up(true);
+        member->set_start(space * i / num_members);
+        member->set_end(space * (i + 1) / num_members);
+        member->set_grpcendpoints("member" + std::to_string(i) + ":4410");
+    }
+    btrdb::MASH mash(proto);
+
+    std::mt19937_64 random(1);
+    std::vector<std::uint64_t> uuids(2 * num_uuids);
+    for (std::uint64_t& word : uuids) {
+        word = random();
+    }
+    const char* bytes = reinterpret_cast<const char*>(uuids.data());
+
+    auto start = bench_clock::now();
+    std::vector<std::string> addrs;
+    std::uint32_t hash;
+    std::uint64_t checksum = 0;
+    for (std::size_t i = 0; i != num_uuids; i++) {
+        mash.endpointFor(&bytes[i * btrdb::UUID_NUM_BYTES], &addrs, &hash);
+        checksum += hash;
+    }
+    double one_by_one = std::chrono::duration<double>(bench_clock::now() - start).count();
+
+    start = bench_clock::now();
+    std::vector<btrdb::MASH::route_group> groups;
+    mash.route(bytes, num_uuids, &groups);
+    double batched = std::chrono::duration<double>(bench_clock::now() - start).count();
+
+    std::uint64_t batch_checksum = 0;
+    for (const btrdb::MASH::route_group& group : groups) {
+        batch_checksum += (std::uint64_t) group.hash * group.indices.size();
+    }
+    if (batch_checksum != checksum) {
+        std::cout << "Error: route disagrees with endpointFor" << std::endl;
+        return 2;
+    }
+
+    std::cout << "route: " << num_uuids << " UUIDs over " << num_members << " members" << std::endl
+              << "  endpointFor: " << (one_by_one * 1e9 / num_uuids) << " ns/UUID" << std::endl
+              << "  route:       " << (batched * 1e9 / num_uuids) << " ns/UUID" << std::endl;
+    return 0;
+}
+
+/* Bytes currently allocated with malloc, or 0 if we cannot tell. */
+std::size_t heap_in_use() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Holds NUM_STREAMS streams with realistic metadata, first as Streams and
+ * then as handles into a StreamTable, and reports the memory each takes.
+ * Every tenth stream, the first included, has no tags or annotations yet;
+ * the table is checked against the descriptors afterwards. No server is
+ * needed.
+ */
+int bench_streams(const std::vector<std::string>& args) {
+    std::size_t num_streams = 1000000;
+    if (args.size() > 0 && !parse_number(args[0], &num_streams)) {
+        std::cout << "Bad number of streams" << std::endl;
+        return 1;
+    }
+
+    /* A few hundred collections, a handful of units, and a name unique to each stream. */
+    const char* units[] = { "volts", "amps", "degrees", "hz", "watts" };
+    auto descriptor = [&](std::size_t i, grpcinterface::StreamDescriptor* d) {
+        char uuid[btrdb::UUID_NUM_BYTES] = {};
+        std::memcpy(uuid, &i, sizeof(i));
+        d->set_uuid(uuid, btrdb::UUID_NUM_BYTES);
+        d->set_collection("sensors/site" + std::to_string(i % 300) + "/pmu" + std::to_string(i % 7));
+        if (i % 10 == 0) {
+            return;
+        }
+        grpcinterface::KeyValue* kv = d->add_tags();
+        kv->set_key("name");
+        kv->set_value("L" + std::to_string(i % 3 + 1) + "MAG_" + std::to_string(i));
+        kv = d->add_tags();
+        kv->set_key("unit");
+        kv->set_value(units[i % 5]);
+        kv = d->add_annotations();
+        kv->set_key("location");
+        kv->set_value("site" + std::to_string(i % 300));
+        kv = d->add_annotations();
+        kv->set_key("phase");
+        kv->set_value(std::to_string(i % 3 + 1));
+        d->set_annotationversion(1);
+    };
+
+    std::size_t before = heap_in_use();
+    auto start = bench_clock::now();
+    {
+        std::vector<std::unique_ptr<btrdb::Stream>> streams;
+        streams.reserve(num_streams);
+        grpcinterface::StreamDescriptor d;
+        for (std::size_t i = 0; i != num_streams; i++) {
+            d.Clear();
+            descriptor(i, &d);
+            streams.emplace_back(new btrdb::Stream(nullptr, d));
+        }
+        double seconds = std::chrono::duration<double>(bench_clock::now() - start).count();
+        std::size_t used = heap_in_use() - before;
+        std::cout << "Stream:       " << (used / (double) num_streams) << " bytes/stream, "
+                  << (seconds * 1e9 / num_streams) << " ns/stream to build" << std::endl;
+    }
+
+    before = heap_in_use();
+    start = bench_clock::now();
+    {
+        btrdb::StreamTable table;
+        std::vector<btrdb::StreamHandle> handles;
+        handles.reserve(num_streams);
+        grpcinterface::StreamDescriptor d;
+        for (std::size_t i = 0; i != num_streams; i++) {
+            d.Clear();
+            descriptor(i, &d);
+            handles.push_back(table.add(d));
+        }
+        double seconds = std::chrono::duration<double>(bench_clock::now() - start).count();
+        std::size_t used = heap_in_use() - before;
+        std::cout << "StreamHandle: " << (used / (double) num_streams) << " bytes/stream ("
+                  << ((table.bytes() + handles.size() * sizeof(btrdb::StreamHandle)) / (double) num_streams) << " estimated), "
+                  << (seconds * 1e9 / num_streams) << " ns/stream to build" << std::endl;
+
+        for (std::size_t i = 0; i != num_streams; i++) {
+            d.Clear();
+            descriptor(i, &d);
+            std::shared_ptr<const btrdb::StreamMetadata> metadata = table.metadata(handles[i]);
+            std::string phase;
+            bool has_phase = table.annotation(handles[i], "phase", &phase);
+            if (metadata->collection != d.collection() || metadata->tags.size() != (std::size_t) d.tags_size() ||
+                metadata->annotations.size() != (std::size_t) d.annotations_size() || has_phase != (d.annotations_size() != 0)) {
+                std::cout << "Stream " << i << " does not match its descriptor" << std::endl;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+ * Feeds points to collect_vernum_worker in batches the size the server
+ * sends, as rawValues would, and compares it with reserving exactly what
+ * each batch needs (what collection used to do) and with a result that
+ * was presized. The exact-reserve baseline is quadratic, so it only gets
+ * the first few million points. No server is needed.
+ */
+int bench_collect(const std::vector<std::string>& args) {
+    std::size_t num_points = 100000000;
+    if (args.size() > 0 && !parse_number(args[0], &num_points)) {
+        std::cout << "Bad number of points" << std::endl;
+        return 1;
+    }
+    std::size_t batch_size = 5000;
+    if (args.size() > 1 && (!parse_number(args[1], &batch_size) || batch_size == 0)) {
+        std::cout << "Bad batch size" << std::endl;
+        return 1;
+    }
+
+    auto run = [&](const char* label, std::size_t count, std::function<void(bool, btrdb::Status, std::vector<struct btrdb::RawPoint>&, std::uint64_t)> worker, std::vector<struct btrdb::RawPoint>* result) {
+        auto before = bench_clock::now();
+        for (std::size_t sent = 0; sent < count; sent += batch_size) {
+            std::vector<struct btrdb::RawPoint> batch(std::min(batch_size, count - sent));
+            for (std::size_t i = 0; i != batch.size(); i++) {
+                batch[i].time = (std::int64_t) (sent + i);
+                batch[i].value = (double) i;
+            }
+            worker(false, btrdb::Status(), batch, 1);
+        }
+        std::vector<struct btrdb::RawPoint> dummy;
+        worker(true, btrdb::Status(), dummy, 1);
+        auto after = bench_clock::now();
+        double seconds = std::chrono::duration<double>(after - before).count();
+        std::cout << label << ": " << result->size() << " points in " << seconds << "s ("
+                  << result->size() / seconds / 1e6 << "M points/s)" << std::endl;
+    };
+
+    {
+        std::vector<struct btrdb::RawPoint> result;
+        run("exact reserve per batch", std::min<std::size_t>(num_points, 2000000), [&](bool, btrdb::Status, std::vector<struct btrdb::RawPoint>& data, std::uint64_t) {
+            result.reserve(result.size() + data.size());
+            for (auto& point : data) {
+                result.push_back(point);
+            }
+        }, &result);
+    }
+    {
+        std::vector<struct btrdb::RawPoint> result;
+        std::uint64_t version;
+        run("geometric growth", num_points, btrdb::collect_vernum_worker(&result, &version), &result);
+    }
+    {
+        std::vector<struct btrdb::RawPoint> result;
+        result.reserve(num_points);
+        std::uint64_t version;
+        run("presized", num_points, btrdb::collect_vernum_worker(&result, &version), &result);
+    }
+    return 0;
+}
+
+/*
+ * Sorts and dedupes batches of points with prepare_points and with
+ * std::stable_sort (std::sort would not keep the last duplicate), for a
+ * few timestamp distributions a device might produce. No server is needed.
+ */
+int bench_prepare(const std::vector<std::string>& args) {
+    std::size_t num_points = 10000000;
+    if (args.size() > 0 && !parse_number(args[0], &num_points)) {
+        std::cout << "Bad number of points" << std::endl;
+        return 1;
+    }
+    std::uint32_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+    if (args.size() > 1 && !parse_number(args[1], &threads)) {
+        std::cout << "Bad number of threads" << std::endl;
+        return 1;
+    }
+
+    /* 120 Hz samples starting now, with 1% of them sent twice. */
+    const std::int64_t period = 1000000000 / 120;
+    const std::int64_t base = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    std::mt19937_64 rng(42);
+    auto generate = [&](const char* distribution) {
+        std::vector<struct btrdb::RawPoint> points(num_points);
+        for (std::size_t i = 0; i != num_points; i++) {
+            std::size_t sample = (rng() % 100 == 0 && i != 0) ? i - 1 : i;
+            points[i].time = base + (std::int64_t) sample * period;
+            points[i].value = (double) i;
+        }
+        if (std::strcmp(distribution, "late by up to a second") == 0) {
+            /* Each point arrives up to 120 samples after its neighbours. */
+            for (std::size_t i = 0; i != num_points; i++) {
+                std::size_t j = std::min(num_points - 1, i + (std::size_t) (rng() % 120));
+                std::swap(points[i], points[j]);
+            }
+        } else if (std::strcmp(distribution, "shuffled") == 0) {
+            std::shuffle(points.begin(), points.end(), rng);
+        }
+        return points;
+    };
+
+    const char* distributions[] = { "in order", "late by up to a second", "shuffled" };
+    for (const char* distribution : distributions) {
+        std::vector<struct btrdb::RawPoint> original = generate(distribution);
+        auto time = [&](const char* label, std::function<void(std::vector<struct btrdb::RawPoint>*)> prepare) {
+            std::vector<struct btrdb::RawPoint> points = original;
+            auto before = bench_clock::now();
+            prepare(&points);
+            auto after = bench_clock::now();
+            double seconds = std::chrono::duration<double>(after - before).count();
+            std::cout << distribution << ", " << label << ": " << points.size() << " points left, "
+                      << num_points / seconds / 1e6 << "M points/s" << std::endl;
+        };
+
+        time("std::stable_sort", [](std::vector<struct btrdb::RawPoint>* points) {
+            std::stable_sort(points->begin(), points->end(), [](const struct btrdb::RawPoint& a, const struct btrdb::RawPoint& b) {
+                return a.time < b.time;
+            });
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i != points->size(); i++) {
+                if (i + 1 != points->size() && (*points)[i + 1].time == (*points)[i].time) {
+                    continue;
+                }
+                (*points)[kept++] = (*points)[i];
+            }
+            points->resize(kept);
+        });
+        time("prepare_points", [](std::vector<struct btrdb::RawPoint>* points) {
+            btrdb::prepare_points(points);
+        });
+        time("prepare_points, parallel", [&](std::vector<struct btrdb::RawPoint>* points) {
+            btrdb::PrepareOptions options;
+            options.threads = threads;
+            btrdb::prepare_points(points, options);
+        });
+    }
+    return 0;
+}
+
+/*
+ * Lists every collection under a prefix with several page sizes, first
+ * through listCollections and then through iterateCollections. Given a
+ * count, first creates that many collections (one stream each) under it.
+ */
+int bench_collections(const std::vector<std::string>& args) {
+    if (args.size() < 2) {
+        std::cout << "Usage: collections address:port prefix [collections to create]" << std::endl;
+        return 1;
+    }
+
+    int to_create = 0;
+    if (args.size() > 2 && !parse_number(args[2], &to_create)) {
+        std::cout << "Bad number of collections" << std::endl;
+        return 1;
+    }
+
+    std::mt19937_64 rng(std::random_device{}());
+    if (to_create > 0) {
+        std::shared_ptr<btrdb::BTrDB> b = btrdb::BTrDB::connect(bench_ctx, { args[0] }, btrdb::ConnectOptions());
+        if (b == nullptr) {
+            std::cout << "Error: could not connect" << std::endl;
+            return 2;
+        }
+        for (int i = 0; i != to_create; i++) {
+            std::uint64_t uuid[2] = { rng(), rng() };
+            char name[32];
+            std::snprintf(name, sizeof(name), "/%08d", i);
+            btrdb::Status status = b->create(bench_ctx, uuid, args[1] + name, { { "name", "bench" } }, {});
+            if (status.isError()) {
+                std::cout << "Error: " << status.message() << std::endl;
+                return 3;
+            }
+        }
+    }
+
+    const std::uint32_t page_sizes[] = { 10, 100, 1000, 10000 };
+    for (std::uint32_t page_size : page_sizes) {
+        btrdb::ConnectOptions options;
+        options.collection_page_size = page_size;
+        std::shared_ptr<btrdb::BTrDB> b = btrdb::BTrDB::connect(bench_ctx, { args[0] }, options);
+        if (b == nullptr) {
+            std::cout << "Error: could not connect" << std::endl;
+            return 2;
+        }
+
+        std::vector<std::string> collections;
+        auto before = bench_clock::now();
+        btrdb::Status status = b->listCollections(bench_ctx, &collections, args[1]);
+        auto after = bench_clock::now();
+        if (status.isError()) {
+            std::cout << "Error: " << status.message() << std::endl;
+            return 3;
+        }
+        double list_ms = std::chrono::duration<double, std::milli>(after - before).count();
+
+        std::size_t iterated = 0;
+        std::string collection;
+        before = bench_clock::now();
+        std::unique_ptr<btrdb::CollectionIterator> it = b->iterateCollections(bench_ctx, args[1]);
+        while (it->next(&collection)) {
+            iterated++;
+        }
+        after = bench_clock::now();
+        if (it->status().isError()) {
+            std::cout << "Error: " << it->status().message() << std::endl;
+            return 3;
+        }
+        double iterate_ms = std::chrono::duration<double, std::milli>(after - before).count();
+
+        std::cout << "page size " << page_size << ": " << collections.size() << " collections, "
+                  << "listCollections " << list_ms << "ms, "
+                  << "iterator " << iterated << " in " << iterate_ms << "ms" << std::endl;
+    }
+    return 0;
+}
+
+/*
+ * The latest point of every stream in a collection prefix: one sync
+ * nearest per stream, against latestValues with and without its cache.
+ */
+int bench_latest(const std::vector<std::string>& args) {
+    if (args.size() < 2) {
+        std::cout << "Usage: latest address:port collection-prefix [rounds]" << std::endl;
+        return 1;
+    }
+
+    int rounds = 5;
+    if (args.size() > 2 && !parse_number(args[2], &rounds)) {
+        std::cout << "Bad rounds" << std::endl;
+        return 1;
+    }
+
+    btrdb::ConnectOptions options;
+    options.latest_value_ttl_ms = 60000;
+    std::shared_ptr<btrdb::BTrDB> b = btrdb::BTrDB::connect(bench_ctx, { args[0] }, options);
+    if (b == nullptr) {
+        std::cout << "Error: could not connect" << std::endl;
+        return 2;
+    }
+
+    std::vector<std::unique_ptr<btrdb::Stream>> streams;
+    btrdb::Status status = b->lookupStreams(bench_ctx, &streams, args[1], true, {}, {});
+    if (status.isError()) {
+        std::cout << "Error: " << status.message() << std::endl;
+        return 3;
+    }
+    std::vector<char> uuids(streams.size() * 16);
+    for (std::size_t i = 0; i != streams.size(); i++) {
+        std::memcpy(&uuids[i * 16], streams[i]->UUID(), 16);
+    }
+
+    for (int r = 0; r != rounds; r++) {
+        std::size_t found = 0;
+        auto before = bench_clock::now();
+        for (std::unique_ptr<btrdb::Stream>& s : streams) {
+            struct btrdb::RawPoint pt;
+            std::uint64_t version;
+            if (!s->nearest(bench_ctx, &pt, &version, btrdb::BTrDB::MAX_TIME, true).isError()) {
+                found++;
+            }
+        }
+        double one_by_one = std::chrono::duration<double, std::milli>(bench_clock::now() - before).count();
+
+        /* A stream without points is an error, so count successes rather than checking the result. */
+        std::vector<struct btrdb::RawPoint> points;
+        std::vector<btrdb::Status> statuses;
+        std::vector<double> bulk_ms;
+        for (int pass = 0; pass != 2; pass++) {
+            before = bench_clock::now();
+            b->latestValues(bench_ctx, uuids.data(), streams.size(), &points, nullptr, 64, &statuses);
+            bulk_ms.push_back(std::chrono::duration<double, std::milli>(bench_clock::now() - before).count());
+        }
+        std::size_t bulk_found = std::count_if(statuses.begin(), statuses.end(), [](const btrdb::Status& s) {
+            return !s.isError();
+        });
+
+        std::cout << streams.size() << " streams (" << found << " / " << bulk_found << " with points): "
+                  << "nearest " << one_by_one << "ms, "
+                  << "latestValues " << bulk_ms[0] << "ms, "
+                  << "cached " << bulk_ms[1] << "ms" << std::endl;
+    }
+    return 0;
+}
+
+/*
+ * The value of one stream at random times in [start, end): one sync
+ * nearest per timestamp, against valuesAt, for a growing number of
+ * timestamps so that both of valuesAt's plans come up.
+ */
+int bench_valuesat(const std::vector<std::string>& args) {
+    if (args.size() < 4) {
+        std::cout << "Usage: valuesat address:port UUID start end [max timestamps]" << std::endl;
+        return 1;
+    }
+
+    char uuid[16];
+    if (!parse_uuid(args[1], uuid)) {
+        std::cout << "Bad UUID" << std::endl;
+        return 1;
+    }
+
+    std::int64_t start;
+    std::int64_t end;
+    if (!parse_number(args[2], &start) || !parse_number(args[3], &end) || end <= start) {
+        std::cout << "Bad time range" << std::endl;
+        return 1;
+    }
+
+    std::size_t max_times = 10000;
+    if (args.size() > 4 && !parse_number(args[4], &max_times)) {
+        std::cout << "Bad number of timestamps" << std::endl;
+        return 1;
+    }
+
+    std::shared_ptr<btrdb::BTrDB> b = btrdb::BTrDB::connect(bench_ctx, { args[0] }, btrdb::ConnectOptions());
+    if (b == nullptr) {
+        std::cout << "Error: could not connect" << std::endl;
+        return 2;
+    }
+    std::unique_ptr<btrdb::Stream> s = b->streamFromUUID(uuid);
+
+    std::mt19937_64 rng(1);
+    for (std::size_t n = 10; n <= max_times; n *= 10) {
+        std::vector<std::int64_t> times(n);
+        for (std::int64_t& t : times) {
+            t = start + (std::int64_t) (rng() % (std::uint64_t) (end - start));
+        }
+        std::sort(times.begin(), times.end());
+
+        auto before = bench_clock::now();
+        for (std::int64_t t : times) {
+            struct btrdb::RawPoint pt;
+            std::uint64_t version;
+            s->nearest(bench_ctx, &pt, &version, t, true);
+        }
+        double one_by_one = std::chrono::duration<double, std::milli>(bench_clock::now() - before).count();
+
+        std::vector<struct btrdb::RawPoint> points;
+        std::uint64_t version;
+        before = bench_clock::now();
+        btrdb::Status status = s->valuesAt(bench_ctx, &points, &version, times, true);
+        double bulk = std::chrono::duration<double, std::milli>(bench_clock::now() - before).count();
+
+        std::cout << n << " timestamps: nearest " << one_by_one << "ms, valuesAt " << bulk << "ms"
+                  << (status.isError() ? " (" + status.message() + ")" : std::string()) << std::endl;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cout << "Usage: " << argv[0] << " benchmark [args...]" << std::endl
+                  << "Benchmarks:" << std::endl
+                  << "  nearest address:port UUID [iterations]" << std::endl
+                  << "  latest address:port collection-prefix [rounds]" << std::endl
+                  << "  wakeup address:port [iterations] [cpu]" << std::endl
+                  << "  throughput address:port UUID start end [concurrent requests] [max channels]" << std::endl
+                  << "  tuning address:port UUID start end [concurrent requests]" << std::endl
+                  << "  valuesat address:port UUID start end [max timestamps]" << std::endl
+                  << "  route [UUIDs] [members]" << std::endl
+                  << "  streams [streams]" << std::endl
+                  << "  collections address:port prefix [collections to create]" << std::endl
+                  << "  collect [points] [batch size]" << std::endl
+                  << "  prepare [points] [threads]" << std::endl;
+        return 1;
+    }
+
+    std::string benchmark(argv[1]);
+    std::vector<std::string> args(&argv[2], &argv[argc]);
+    if (benchmark == "nearest") {
+        return bench_nearest(args);
+    } else if (benchmark == "latest") {
+        return bench_latest(args);
+    } else if (benchmark == "wakeup") {
+        return bench_wakeup(args);
+    } else if (benchmark == "throughput") {
+        return bench_throughput(args);
+    } else if (benchmark == "tuning") {
+        return bench_tuning(args);
+    } else if (benchmark == "valuesat") {
+        return bench_valuesat(args);
+    } else if (benchmark == "route") {
+        return bench_route(args);
+    } else if (benchmark == "streams") {
+        return bench_streams(args);
+    } else if (benchmark == "collections") {
+        return bench_collections(args);
+    } else if (benchmark == "collect") {
+        return bench_collect(args);
+    } else if (benchmark == "prepare") {
+        return bench_prepare(args);
+    }
+
+    std::cout << "Unknown benchmark \"" << benchmark << "\"" << std::endl;
+    return 1;
+}